@@ -1,4 +1,5 @@
 #include "./GxB_Delete.h"
+#include <stdlib.h>
 
 GrB_Info GxB_Matrix_Delete
 (
@@ -23,3 +24,80 @@ GrB_Info GxB_Matrix_Delete
     GrB_Matrix_free(&Z);
     return info;
 }
+
+GrB_Info GxB_Matrix_Delete_Batch
+(
+    GrB_Matrix M,
+    const GrB_Index *rows,
+    const GrB_Index *cols,
+    GrB_Index n
+)
+{
+    if (n == 0) return GrB_SUCCESS ;
+    // A single entry is cheaper to remove without scanning M.
+    if (n == 1) return GxB_Matrix_Delete (M, rows[0], cols[0]) ;
+
+    GrB_Info info ;
+    GrB_Index nrows ;
+    GrB_Index ncols ;
+    GrB_Matrix_nrows (&nrows, M) ;
+    GrB_Matrix_ncols (&ncols, M) ;
+
+    // D[rows[k],cols[k]] = true, marks entries to delete.
+    bool *X = malloc (sizeof (bool) * n) ;
+    for (GrB_Index k = 0 ; k < n ; k++) X[k] = true ;
+
+    GrB_Matrix D ;
+    GrB_Matrix_new (&D, GrB_BOOL, nrows, ncols) ;
+    info = GrB_Matrix_build_BOOL (D, rows, cols, X, n, GrB_LOR) ;
+    free (X) ;
+    if (info != GrB_SUCCESS)
+    {
+        GrB_Matrix_free (&D) ;
+        return info ;
+    }
+
+    // M<!D> = M, entries masked by D are dropped.
+    GrB_Descriptor desc ;
+    GrB_Descriptor_new (&desc) ;
+    GrB_Descriptor_set (desc, GrB_MASK, GrB_SCMP) ;
+    GrB_Descriptor_set (desc, GrB_OUTP, GrB_REPLACE) ;
+
+    info = GrB_Matrix_assign (M, D, GrB_NULL, M, GrB_ALL, nrows, GrB_ALL,
+                              ncols, desc) ;
+
+    GrB_Descriptor_free (&desc) ;
+    GrB_Matrix_free (&D) ;
+    return info ;
+}
+
+GrB_Info GxB_Matrix_Delete_RowsCols
+(
+    GrB_Matrix M,
+    const GrB_Index *I,
+    GrB_Index n
+)
+{
+    if (n == 0) return GrB_SUCCESS ;
+
+    GrB_Info info ;
+    GrB_Index nrows ;
+    GrB_Index ncols ;
+    GrB_Matrix_nrows (&nrows, M) ;
+    GrB_Matrix_ncols (&ncols, M) ;
+
+    // Assigning an empty matrix clears the region M(I,:).
+    GrB_Matrix Z ;
+    GrB_Matrix_new (&Z, GrB_BOOL, n, ncols) ;
+    info = GxB_Matrix_subassign (M, GrB_NULL, GrB_NULL, Z, I, n, GrB_ALL,
+                                 ncols, GrB_NULL) ;
+    GrB_Matrix_free (&Z) ;
+    if (info != GrB_SUCCESS) return info ;
+
+    // Clear region M(:,I).
+    GrB_Matrix_new (&Z, GrB_BOOL, nrows, n) ;
+    info = GxB_Matrix_subassign (M, GrB_NULL, GrB_NULL, Z, GrB_ALL, nrows, I,
+                                 n, GrB_NULL) ;
+    GrB_Matrix_free (&Z) ;
+    return info ;
+}
@@ -20,4 +20,23 @@ GrB_Info GxB_Matrix_Delete
     GrB_Index col
 ) ;
 
+/* Clears entries at positions M[rows[k],cols[k]] for k in [0, n),
+ * removing all entries in a single pass over M. */
+GrB_Info GxB_Matrix_Delete_Batch
+(
+    GrB_Matrix M,
+    const GrB_Index *rows,
+    const GrB_Index *cols,
+    GrB_Index n
+) ;
+
+/* Clears every entry residing in rows I and columns I of M,
+ * I is expected to be sorted and free of duplicates. */
+GrB_Info GxB_Matrix_Delete_RowsCols
+(
+    GrB_Matrix M,
+    const GrB_Index *I,
+    GrB_Index n
+) ;
+
 #endif
@@ -81,6 +81,22 @@ TuplesIter_Info TuplesIter_next
     return TuplesIter_OK;
 }
 
+TuplesIter_Info TuplesIter_next_UINT64
+(
+    TuplesIter *iter,
+    GrB_Index *row,
+    GrB_Index *col,
+    uint64_t *val
+)
+{
+    assert (iter->A->type == GrB_UINT64) ;
+    GrB_Index nnz_idx = iter->nnz_idx ;
+
+    TuplesIter_Info info = TuplesIter_next (iter, row, col) ;
+    if (info == TuplesIter_OK && val) *val = ((uint64_t *) iter->A->x) [nnz_idx] ;
+    return info ;
+}
+
 void TuplesIter_reset
 (
     TuplesIter *iter
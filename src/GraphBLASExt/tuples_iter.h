@@ -44,6 +44,16 @@ TuplesIter_Info TuplesIter_next
     GrB_Index *col
 ) ;
 
+// Same as TuplesIter_next, in addition retrieves the value of the
+// current entry, iterated matrix must be of type GrB_UINT64.
+TuplesIter_Info TuplesIter_next_UINT64
+(
+    TuplesIter *iter,
+    GrB_Index *row,
+    GrB_Index *col,
+    uint64_t *val
+) ;
+
 void TuplesIter_reset
 (
     TuplesIter *iter
@@ -9,5 +9,10 @@
 #define _ALGORITHMS_H_
 
 #include "./all_paths.h"
+#include "./pagerank.h"
+#include "./wcc.h"
+#include "./triangles.h"
+#include "./lpa.h"
+#include "./khop.h"
 
 #endif
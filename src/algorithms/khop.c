@@ -0,0 +1,62 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#include "./khop.h"
+
+int KHop
+(
+    GrB_Vector *levels,
+    uint64_t *level_counts,
+    const GrB_Matrix A,
+    bool transpose,
+    GrB_Index source,
+    int k
+)
+{
+    GrB_Index n;
+    GrB_Matrix_nrows(&n, A);
+
+    GrB_Vector v;       // Level of each visited node.
+    GrB_Vector q;       // Frontier.
+    GrB_Vector visited; // Masks are valued, level 0 would read as unvisited.
+    GrB_Vector_new(&v, GrB_UINT64, n);
+    GrB_Vector_new(&q, GrB_BOOL, n);
+    GrB_Vector_new(&visited, GrB_BOOL, n);
+    GrB_Vector_setElement_BOOL(q, true, source);
+    GrB_Vector_setElement_BOOL(visited, true, source);
+    GrB_Vector_setElement_UINT64(v, 0, source);
+    *levels = v;
+
+    for(int i = 0; i <= k; i++) level_counts[i] = 0;
+    level_counts[0] = 1;
+
+    // Expand frontier onto nodes not visited yet, clearing the previous frontier.
+    GrB_Descriptor desc;
+    GrB_Descriptor_new(&desc);
+    GrB_Descriptor_set(desc, GrB_MASK, GrB_SCMP);
+    GrB_Descriptor_set(desc, GrB_OUTP, GrB_REPLACE);
+    if(transpose) GrB_Descriptor_set(desc, GrB_INP0, GrB_TRAN);
+
+    int level = 0;
+    while(level < k) {
+        GrB_mxv(q, visited, NULL, GxB_LOR_LAND_BOOL, A, q, desc);
+
+        GrB_Index discovered;
+        GrB_Vector_nvals(&discovered, q);
+        if(discovered == 0) break;
+
+        level++;
+        level_counts[level] = discovered;
+        GrB_Vector_assign_UINT64(v, q, NULL, level, GrB_ALL, n, NULL);
+        GrB_Vector_assign_BOOL(visited, q, NULL, true, GrB_ALL, n, NULL);
+    }
+
+    GrB_Descriptor_free(&desc);
+    GrB_Vector_free(&q);
+    GrB_Vector_free(&visited);
+    return level;
+}
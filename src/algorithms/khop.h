@@ -0,0 +1,31 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#ifndef _KHOP_H_
+#define _KHOP_H_
+
+#include "../../deps/GraphBLAS/Include/GraphBLAS.h"
+
+/* Breadth first search from source, up to k hops away.
+ * Each iteration expands the frontier by a single hop, q<!visited> = A*q,
+ * so previously visited nodes are never revisited and no paths are enumerated.
+ * A is an N X N boolean matrix, A[dest, src] is set when src links to dest,
+ * transpose follows links in reverse.
+ * levels[i] is the number of hops from source to node i, source included at 0.
+ * level_counts, of length k + 1, is set to the number of nodes discovered at each level.
+ * Returns the number of levels reached, lower than k if the frontier was exhausted. */
+int KHop
+(
+    GrB_Vector *levels,         // Output levels, levels[i] is node i's distance from source.
+    uint64_t *level_counts,     // Output number of nodes at each level.
+    const GrB_Matrix A,         // Links, A[dest, src].
+    bool transpose,             // Follow links from destination to source.
+    GrB_Index source,           // Node to start from.
+    int k                       // Maximum number of hops.
+);
+
+#endif
@@ -0,0 +1,132 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#include "./lpa.h"
+#include "../util/rmalloc.h"
+
+// Mixes community and seed, lower hash wins ties (splitmix64 finalizer).
+static inline uint64_t _LPA_TieBreak(uint64_t community, uint64_t seed) {
+    uint64_t z = community + seed * 0x9E3779B97F4A7C15ULL;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+int LabelPropagation
+(
+    GrB_Vector *communities,
+    const GrB_Matrix A,
+    const GrB_Vector nodes,
+    int max_iterations,
+    uint64_t seed
+)
+{
+    GrB_Index n;
+    GrB_Index node_count;
+    GrB_Matrix_nrows(&n, A);
+    GrB_Vector_nvals(&node_count, nodes);
+
+    GrB_Index *ids = rm_malloc(sizeof(GrB_Index) * node_count);
+    bool *present = rm_malloc(sizeof(bool) * node_count);
+    GrB_Vector_extractTuples_BOOL(ids, present, &node_count, nodes);
+
+    // S = A + A' + I, nodes vote for their own community as well.
+    GrB_Matrix S;
+    GrB_Descriptor desc;
+    GrB_Descriptor_new(&desc);
+    GrB_Descriptor_set(desc, GrB_INP1, GrB_TRAN);
+    GrB_Matrix_new(&S, GrB_BOOL, n, n);
+    GrB_eWiseAdd_Matrix_BinaryOp(S, NULL, NULL, GrB_LOR, A, A, desc);
+    GrB_Descriptor_free(&desc);
+
+    GrB_Matrix I;
+    GrB_Matrix_new(&I, GrB_BOOL, n, n);
+    GrB_Matrix_build_BOOL(I, ids, ids, present, node_count, GrB_LOR);
+    GrB_eWiseAdd_Matrix_BinaryOp(S, NULL, NULL, GrB_LOR, S, I, NULL);
+    GrB_Matrix_free(&I);
+
+    // Every node starts within its own community.
+    uint64_t *community = rm_malloc(sizeof(uint64_t) * n);
+    uint64_t *best_votes = rm_malloc(sizeof(uint64_t) * n);
+    uint64_t *best = rm_malloc(sizeof(uint64_t) * n);
+    uint64_t *ones = rm_malloc(sizeof(uint64_t) * node_count);
+    GrB_Index *cols = rm_malloc(sizeof(GrB_Index) * node_count);
+    for(GrB_Index i = 0; i < n; i++) community[i] = i;
+    for(GrB_Index i = 0; i < node_count; i++) ones[i] = 1;
+
+    GrB_Matrix Y;   // One-hot communities, Y[i, c] is set when node i is in community c.
+    GrB_Matrix C;   // C[i, c] number of votes node i received for community c.
+    GrB_Matrix_new(&Y, GrB_UINT64, n, n);
+    GrB_Matrix_new(&C, GrB_UINT64, n, n);
+
+    GrB_Index nvals = 0;
+    GrB_Index *rows = NULL;
+    GrB_Index *votes_cols = NULL;
+    uint64_t *votes = NULL;
+
+    int iteration = 0;
+    while(iteration < max_iterations) {
+        iteration++;
+
+        GrB_Matrix_clear(Y);
+        for(GrB_Index i = 0; i < node_count; i++) cols[i] = community[ids[i]];
+        GrB_Matrix_build_UINT64(Y, ids, cols, ones, node_count, GrB_PLUS_UINT64);
+        GrB_mxm(C, NULL, NULL, GxB_PLUS_TIMES_UINT64, S, Y, NULL);
+
+        GrB_Index c_nvals;
+        GrB_Matrix_nvals(&c_nvals, C);
+        if(c_nvals > nvals) {
+            nvals = c_nvals;
+            rows = rm_realloc(rows, sizeof(GrB_Index) * nvals);
+            votes_cols = rm_realloc(votes_cols, sizeof(GrB_Index) * nvals);
+            votes = rm_realloc(votes, sizeof(uint64_t) * nvals);
+        }
+        GrB_Matrix_extractTuples_UINT64(rows, votes_cols, votes, &c_nvals, C);
+
+        // Pick the most voted for community of each node.
+        for(GrB_Index i = 0; i < node_count; i++) best_votes[ids[i]] = 0;
+        for(GrB_Index i = 0; i < c_nvals; i++) {
+            GrB_Index node = rows[i];
+            uint64_t c = votes_cols[i];
+            if(votes[i] > best_votes[node] ||
+               (votes[i] == best_votes[node] &&
+                _LPA_TieBreak(c, seed) < _LPA_TieBreak(best[node], seed))) {
+                best_votes[node] = votes[i];
+                best[node] = c;
+            }
+        }
+
+        bool changed = false;
+        for(GrB_Index i = 0; i < node_count; i++) {
+            GrB_Index node = ids[i];
+            if(community[node] != best[node]) {
+                community[node] = best[node];
+                changed = true;
+            }
+        }
+        if(!changed) break;
+    }
+
+    for(GrB_Index i = 0; i < node_count; i++) cols[i] = community[ids[i]];
+    GrB_Vector_new(communities, GrB_UINT64, n);
+    GrB_Vector_build_UINT64(*communities, ids, cols, node_count, GrB_FIRST_UINT64);
+
+    rm_free(ids);
+    rm_free(present);
+    rm_free(community);
+    rm_free(best_votes);
+    rm_free(best);
+    rm_free(ones);
+    rm_free(cols);
+    rm_free(rows);
+    rm_free(votes_cols);
+    rm_free(votes);
+    GrB_Matrix_free(&Y);
+    GrB_Matrix_free(&C);
+    GrB_Matrix_free(&S);
+    return iteration;
+}
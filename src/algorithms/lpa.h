@@ -0,0 +1,32 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#ifndef _LPA_H_
+#define _LPA_H_
+
+#include "../../deps/GraphBLAS/Include/GraphBLAS.h"
+
+/* Detects communities by synchronous label propagation.
+ * Every node starts within its own community, identified by its ID,
+ * on each iteration nodes adopt the most frequent community among
+ * themselves and their neighbours, C = S*Y where Y is the one-hot
+ * node-community matrix. Ties are broken by a hash of the community
+ * and seed, so results are deterministic for a given seed.
+ * A is an N X N boolean matrix, A[dest, src] is set when src links to dest,
+ * direction is ignored, nodes holds an entry for each node considered.
+ * Iteration stops once no node changes community, or after max_iterations.
+ * Returns the number of iterations performed. */
+int LabelPropagation
+(
+    GrB_Vector *communities,    // Output communities, communities[i] is node i's community.
+    const GrB_Matrix A,         // Links, A[dest, src].
+    const GrB_Vector nodes,     // Nodes considered.
+    int max_iterations,         // Maximum number of iterations.
+    uint64_t seed               // Tie-break seed.
+);
+
+#endif
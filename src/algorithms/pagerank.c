@@ -0,0 +1,87 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#include <assert.h>
+#include "./pagerank.h"
+
+int PageRank
+(
+    GrB_Vector *ranks,
+    const GrB_Matrix A,
+    const GrB_Vector nodes,
+    int max_iterations,
+    double damping,
+    double tolerance
+)
+{
+    GrB_Index n;
+    GrB_Index node_count;
+    GrB_Matrix_nrows(&n, A);
+    GrB_Vector_nvals(&node_count, nodes);
+
+    GrB_Vector r;
+    GrB_Vector_new(&r, GrB_FP64, n);
+    *ranks = r;
+    if(node_count == 0) return 0;
+
+    // Out degree of each node, A is transposed as it's indexed by destination.
+    GrB_Descriptor desc;
+    GrB_Descriptor_new(&desc);
+    GrB_Descriptor_set(desc, GrB_INP0, GrB_TRAN);
+    GrB_Vector out_degree;
+    GrB_Vector_new(&out_degree, GrB_FP64, n);
+    GrB_Matrix_reduce_Monoid(out_degree, NULL, NULL, GxB_PLUS_FP64_MONOID, A, desc);
+    GrB_Descriptor_free(&desc);
+
+    // Start with a uniform distribution.
+    GrB_Vector_assign_FP64(r, nodes, NULL, 1.0 / node_count, GrB_ALL, n, NULL);
+
+    GrB_Vector w;           // Rank each node passes along every outgoing link.
+    GrB_Vector next;        // Ranks computed by current iteration.
+    GrB_Vector delta;       // Rank change per node.
+    GrB_Vector_new(&w, GrB_FP64, n);
+    GrB_Vector_new(&next, GrB_FP64, n);
+    GrB_Vector_new(&delta, GrB_FP64, n);
+
+    int iteration = 0;
+    while(iteration < max_iterations) {
+        iteration++;
+
+        // Rank held by nodes without outgoing links.
+        double total = 0;
+        double linked = 0;
+        GrB_Vector_reduce_FP64(&total, NULL, GxB_PLUS_FP64_MONOID, r, NULL);
+        GrB_eWiseMult_Vector_BinaryOp(w, NULL, NULL, GrB_FIRST_FP64, r, out_degree, NULL);
+        GrB_Vector_reduce_FP64(&linked, NULL, GxB_PLUS_FP64_MONOID, w, NULL);
+        double dangling = total - linked;
+
+        // next = damping * A * (r / out_degree) + teleport.
+        GrB_eWiseMult_Vector_BinaryOp(w, NULL, NULL, GrB_DIV_FP64, r, out_degree, NULL);
+        GrB_mxv(next, NULL, NULL, GxB_PLUS_TIMES_FP64, A, w, NULL);
+        GrB_Vector_assign_FP64(next, next, GrB_TIMES_FP64, damping, GrB_ALL, n, NULL);
+        double teleport = (1.0 - damping + damping * dangling) / node_count;
+        GrB_Vector_assign_FP64(next, nodes, GrB_PLUS_FP64, teleport, GrB_ALL, n, NULL);
+
+        // L1 norm of rank change.
+        double diff = 0;
+        GrB_eWiseAdd_Vector_BinaryOp(delta, NULL, NULL, GrB_MINUS_FP64, next, r, NULL);
+        GrB_Vector_apply(delta, NULL, NULL, GxB_ABS_FP64, delta, NULL);
+        GrB_Vector_reduce_FP64(&diff, NULL, GxB_PLUS_FP64_MONOID, delta, NULL);
+
+        GrB_Vector tmp = r;
+        r = next;
+        next = tmp;
+        if(diff < tolerance) break;
+    }
+
+    *ranks = r;
+    GrB_Vector_free(&w);
+    GrB_Vector_free(&next);
+    GrB_Vector_free(&delta);
+    GrB_Vector_free(&out_degree);
+    return iteration;
+}
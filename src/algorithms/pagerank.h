@@ -0,0 +1,30 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#ifndef _PAGERANK_H_
+#define _PAGERANK_H_
+
+#include "../../deps/GraphBLAS/Include/GraphBLAS.h"
+
+/* Computes the PageRank of each node by power iteration.
+ * A is an N X N boolean matrix, A[dest, src] is set when src links to dest,
+ * nodes holds an entry for each ranked node, links must be among them.
+ * Rank of nodes without outgoing links is spread evenly over all nodes.
+ * Iteration stops once the L1 norm of the rank difference between
+ * two iterations drops below tolerance, or after max_iterations.
+ * Returns the number of iterations performed. */
+int PageRank
+(
+    GrB_Vector *ranks,      // Output ranks, ranks[i] is node i's PageRank.
+    const GrB_Matrix A,     // Links, A[dest, src].
+    const GrB_Vector nodes, // Ranked nodes.
+    int max_iterations,     // Maximum number of iterations.
+    double damping,         // Probability of following a link.
+    double tolerance        // Convergence threshold.
+);
+
+#endif
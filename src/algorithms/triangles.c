@@ -0,0 +1,136 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#include "./triangles.h"
+#include "../util/rmalloc.h"
+
+// S = A + A' without its diagonal, undirected links between distinct nodes.
+static GrB_Matrix _Triangles_Symmetrise(const GrB_Matrix A) {
+    GrB_Index n;
+    GrB_Matrix_nrows(&n, A);
+
+    GrB_Matrix S;
+    GrB_Descriptor desc;
+    GrB_Descriptor_new(&desc);
+    GrB_Descriptor_set(desc, GrB_INP1, GrB_TRAN);
+    GrB_Matrix_new(&S, GrB_BOOL, n, n);
+    GrB_eWiseAdd_Matrix_BinaryOp(S, NULL, NULL, GrB_LOR, A, A, desc);
+    GrB_Descriptor_free(&desc);
+
+    int64_t diagonal = 0;
+    GxB_Matrix_select(S, NULL, NULL, GxB_OFFDIAG, S, &diagonal, NULL);
+    return S;
+}
+
+uint64_t TriangleCount
+(
+    const GrB_Matrix A
+)
+{
+    GrB_Index n;
+    GrB_Matrix_nrows(&n, A);
+    GrB_Matrix S = _Triangles_Symmetrise(A);
+
+    GrB_Matrix L;
+    GrB_Matrix U;
+    int64_t lower = -1;
+    int64_t upper = 1;
+    GrB_Matrix_new(&L, GrB_BOOL, n, n);
+    GrB_Matrix_new(&U, GrB_BOOL, n, n);
+    GxB_Matrix_select(L, NULL, NULL, GxB_TRIL, S, &lower, NULL);
+    GxB_Matrix_select(U, NULL, NULL, GxB_TRIU, S, &upper, NULL);
+
+    // C[i, j] number of nodes k < j closing a triangle with link i, j.
+    GrB_Matrix C;
+    GrB_Matrix_new(&C, GrB_UINT64, n, n);
+    GrB_mxm(C, L, NULL, GxB_PLUS_TIMES_UINT64, L, U, NULL);
+
+    uint64_t triangles = 0;
+    GrB_Matrix_reduce_UINT64(&triangles, NULL, GxB_PLUS_UINT64_MONOID, C, NULL);
+
+    GrB_Matrix_free(&C);
+    GrB_Matrix_free(&L);
+    GrB_Matrix_free(&U);
+    GrB_Matrix_free(&S);
+    return triangles;
+}
+
+void LocalTriangles
+(
+    GrB_Vector *triangles,
+    GrB_Vector *coefficients,
+    const GrB_Matrix A,
+    const GrB_Vector nodes
+)
+{
+    GrB_Index n;
+    GrB_Matrix_nrows(&n, A);
+    GrB_Matrix S = _Triangles_Symmetrise(A);
+
+    // C[i, j] number of common neighbours of linked nodes i and j.
+    GrB_Matrix C;
+    GrB_Matrix_new(&C, GrB_UINT64, n, n);
+    GrB_mxm(C, S, NULL, GxB_PLUS_TIMES_UINT64, S, S, NULL);
+
+    // Each of node i's triangles is counted twice, once per link.
+    GrB_Vector wedges;
+    GrB_Vector degree;
+    GrB_Vector_new(&wedges, GrB_UINT64, n);
+    GrB_Vector_new(&degree, GrB_UINT64, n);
+    GrB_Matrix_reduce_Monoid(wedges, NULL, NULL, GxB_PLUS_UINT64_MONOID, C, NULL);
+    GrB_Matrix_reduce_Monoid(degree, NULL, NULL, GxB_PLUS_UINT64_MONOID, S, NULL);
+
+    // Densify counts, nodes missing from either vector have none.
+    uint64_t *node_wedges = rm_calloc(n, sizeof(uint64_t));
+    uint64_t *node_degree = rm_calloc(n, sizeof(uint64_t));
+    GrB_Index *ids = rm_malloc(sizeof(GrB_Index) * n);
+    uint64_t *values = rm_malloc(sizeof(uint64_t) * n);
+    GrB_Index nvals;
+
+    GrB_Vector_nvals(&nvals, wedges);
+    GrB_Vector_extractTuples_UINT64(ids, values, &nvals, wedges);
+    for(GrB_Index i = 0; i < nvals; i++) node_wedges[ids[i]] = values[i];
+
+    GrB_Vector_nvals(&nvals, degree);
+    GrB_Vector_extractTuples_UINT64(ids, values, &nvals, degree);
+    for(GrB_Index i = 0; i < nvals; i++) node_degree[ids[i]] = values[i];
+
+    GrB_Index node_count;
+    GrB_Vector_nvals(&node_count, nodes);
+    bool *present = rm_malloc(sizeof(bool) * node_count);
+    uint64_t *t = rm_malloc(sizeof(uint64_t) * node_count);
+    double *cc = rm_malloc(sizeof(double) * node_count);
+    GrB_Vector_extractTuples_BOOL(ids, present, &node_count, nodes);
+
+    for(GrB_Index i = 0; i < node_count; i++) {
+        GrB_Index id = ids[i];
+        uint64_t d = node_degree[id];
+        t[i] = node_wedges[id] / 2;
+        cc[i] = (d < 2) ? 0 : (2.0 * t[i]) / (d * (d - 1));
+    }
+
+    if(triangles) {
+        GrB_Vector_new(triangles, GrB_UINT64, n);
+        GrB_Vector_build_UINT64(*triangles, ids, t, node_count, GrB_FIRST_UINT64);
+    }
+    if(coefficients) {
+        GrB_Vector_new(coefficients, GrB_FP64, n);
+        GrB_Vector_build_FP64(*coefficients, ids, cc, node_count, GrB_FIRST_FP64);
+    }
+
+    rm_free(node_wedges);
+    rm_free(node_degree);
+    rm_free(ids);
+    rm_free(values);
+    rm_free(present);
+    rm_free(t);
+    rm_free(cc);
+    GrB_Vector_free(&wedges);
+    GrB_Vector_free(&degree);
+    GrB_Matrix_free(&C);
+    GrB_Matrix_free(&S);
+}
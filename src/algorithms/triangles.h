@@ -0,0 +1,37 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#ifndef _TRIANGLES_H_
+#define _TRIANGLES_H_
+
+#include "../../deps/GraphBLAS/Include/GraphBLAS.h"
+
+/* Counts triangles within the graph, C<L> = L*U where L and U are
+ * the strictly lower and upper triangles of the symmetrised links,
+ * each triangle i > j > k is counted once at C[i, j].
+ * A is an N X N boolean matrix, A[dest, src] is set when src links to dest,
+ * link direction and self loops are ignored.
+ * Returns the number of triangles. */
+uint64_t TriangleCount
+(
+    const GrB_Matrix A      // Links, A[dest, src].
+);
+
+/* Computes the number of triangles each node participates in
+ * and its local clustering coefficient, the fraction of pairs
+ * of its neighbours which are linked to one another.
+ * Both outputs hold an entry for each node in nodes,
+ * either output may be NULL if it is not required. */
+void LocalTriangles
+(
+    GrB_Vector *triangles,      // Output triangles, triangles[i] is the number of triangles of node i.
+    GrB_Vector *coefficients,   // Output clustering coefficients.
+    const GrB_Matrix A,         // Links, A[dest, src].
+    const GrB_Vector nodes      // Nodes considered.
+);
+
+#endif
@@ -0,0 +1,107 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#include "./wcc.h"
+#include "../util/rmalloc.h"
+
+int WCC
+(
+    GrB_Vector *components,
+    const GrB_Matrix A,
+    const GrB_Vector nodes
+)
+{
+    GrB_Index n;
+    GrB_Matrix_nrows(&n, A);
+
+    // Links are followed in both directions.
+    GrB_Matrix S;
+    GrB_Descriptor desc;
+    GrB_Descriptor_new(&desc);
+    GrB_Descriptor_set(desc, GrB_INP1, GrB_TRAN);
+    GrB_Matrix_new(&S, GrB_BOOL, n, n);
+    GrB_eWiseAdd_Matrix_BinaryOp(S, NULL, NULL, GrB_LOR, A, A, desc);
+    GrB_Descriptor_free(&desc);
+
+    // Every node starts as its own parent, f[i] = i.
+    GrB_Index *ids = rm_malloc(sizeof(GrB_Index) * n);
+    GrB_Index *parents = rm_malloc(sizeof(GrB_Index) * n);
+    GrB_Index *hooks = rm_malloc(sizeof(GrB_Index) * n);
+    uint64_t *values = rm_malloc(sizeof(uint64_t) * n);
+    for(GrB_Index i = 0; i < n; i++) ids[i] = i;
+
+    GrB_Vector f;       // Parent of each node.
+    GrB_Vector gp;      // Grandparent of each node.
+    GrB_Vector mngp;    // Minimal grandparent among each node's neighbours.
+    GrB_Vector h;       // Minimal grandparent hooked onto each parent.
+    GrB_Vector changed;
+    GrB_Vector_new(&f, GrB_UINT64, n);
+    GrB_Vector_new(&mngp, GrB_UINT64, n);
+    GrB_Vector_new(&h, GrB_UINT64, n);
+    GrB_Vector_new(&changed, GrB_BOOL, n);
+    GrB_Vector_build_UINT64(f, ids, ids, n, GrB_FIRST_UINT64);
+    // Initially each node is its own grandparent.
+    GrB_Vector_dup(&gp, f);
+
+    int iteration = 0;
+    bool converged = (n == 0);
+    while(!converged) {
+        iteration++;
+        GrB_Index nvals = n;
+        GrB_Vector_extractTuples_UINT64(ids, parents, &nvals, f);
+
+        // mngp[i] = min(gp[j]) over i's neighbours j.
+        GrB_mxv(mngp, NULL, NULL, GxB_MIN_SECOND_UINT64, S, gp, NULL);
+
+        // Stochastic hooking, f[f[i]] = min(f[f[i]], mngp[i]).
+        // Parents may repeat, build resolves them to their minimum.
+        GrB_Vector_nvals(&nvals, mngp);
+        GrB_Vector_extractTuples_UINT64(ids, values, &nvals, mngp);
+        for(GrB_Index i = 0; i < nvals; i++) hooks[i] = parents[ids[i]];
+        GrB_Vector_clear(h);
+        GrB_Vector_build_UINT64(h, hooks, values, nvals, GrB_MIN_UINT64);
+        GrB_eWiseAdd_Vector_BinaryOp(f, NULL, NULL, GrB_MIN_UINT64, f, h, NULL);
+
+        // Aggressive hooking, f[i] = min(f[i], mngp[i]).
+        GrB_eWiseAdd_Vector_BinaryOp(f, NULL, NULL, GrB_MIN_UINT64, f, mngp, NULL);
+
+        // Shortcutting, f[i] = min(f[i], gp[i]).
+        GrB_eWiseAdd_Vector_BinaryOp(f, NULL, NULL, GrB_MIN_UINT64, f, gp, NULL);
+
+        // Recompute grandparents, gp[i] = f[f[i]].
+        nvals = n;
+        GrB_Vector_extractTuples_UINT64(ids, parents, &nvals, f);
+        GrB_Vector next_gp;
+        GrB_Vector_new(&next_gp, GrB_UINT64, n);
+        GrB_Vector_extract(next_gp, NULL, NULL, f, parents, n, NULL);
+
+        // Converged once grandparents no longer change.
+        GrB_eWiseMult_Vector_BinaryOp(changed, NULL, NULL, GrB_NE_UINT64, next_gp, gp, NULL);
+        bool any_changed = false;
+        GrB_Vector_reduce_BOOL(&any_changed, NULL, GxB_LOR_BOOL_MONOID, changed, NULL);
+        converged = !any_changed;
+
+        GrB_Vector_free(&gp);
+        gp = next_gp;
+    }
+
+    // Report components of considered nodes only.
+    GrB_Vector_new(components, GrB_UINT64, n);
+    GrB_Vector_apply(*components, nodes, NULL, GrB_IDENTITY_UINT64, f, NULL);
+
+    rm_free(ids);
+    rm_free(parents);
+    rm_free(hooks);
+    rm_free(values);
+    GrB_Vector_free(&f);
+    GrB_Vector_free(&gp);
+    GrB_Vector_free(&mngp);
+    GrB_Vector_free(&h);
+    GrB_Vector_free(&changed);
+    GrB_Matrix_free(&S);
+    return iteration;
+}
@@ -0,0 +1,27 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#ifndef _WCC_H_
+#define _WCC_H_
+
+#include "../../deps/GraphBLAS/Include/GraphBLAS.h"
+
+/* Finds weakly connected components using FastSV,
+ * nodes are hooked onto the minimal grandparent among their neighbours
+ * until the parent forest converges into stars.
+ * A is an N X N boolean matrix, A[dest, src] is set when src links to dest,
+ * direction is ignored, nodes holds an entry for each node considered.
+ * Each node's component is identified by the lowest node ID within it.
+ * Returns the number of iterations performed. */
+int WCC
+(
+    GrB_Vector *components,     // Output components, components[i] is node i's component.
+    const GrB_Matrix A,         // Links, A[dest, src].
+    const GrB_Vector nodes      // Nodes considered.
+);
+
+#endif
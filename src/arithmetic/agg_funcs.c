@@ -6,6 +6,7 @@
 */
 
 #include <float.h>
+#include <assert.h>
 #include "agg_funcs.h"
 #include "aggregate.h"
 #include "repository.h"
@@ -219,6 +220,12 @@ AggCtx* Agg_CountFunc() {
     return Agg_Reduce(ac, __agg_countStep, __agg_countReduceNext);
 }
 
+void Agg_CountAdd(AggCtx *ctx, size_t n) {
+    assert(ctx->Step == __agg_countStep);
+    __agg_countCtx *ac = Agg_FuncCtx(ctx);
+    ac->count += n;
+}
+
 //------------------------------------------------------------------------
 
 typedef struct {
@@ -8,6 +8,7 @@
 #ifndef __AGG_FUNCTIONS_H__
 #define __AGG_FUNCTIONS_H__
 
+#include <stddef.h>
 #include "agg_ctx.h"
 
 typedef AggCtx* (*AggFuncInit)(void);
@@ -21,6 +22,9 @@ AggCtx* Agg_PercContFunc();
 AggCtx* Agg_PercDiscFunc();
 AggCtx* Agg_stDev();
 
+/* Adds n to a count aggregation, as if it was stepped n times. */
+void Agg_CountAdd(AggCtx *ctx, size_t n);
+
 void Agg_RegisterFuncs();
 
 #endif
\ No newline at end of file
@@ -17,6 +17,7 @@ AlgebraicExpressionResult *_AlgebraicExpressionResult_New(GrB_Matrix M, Algebrai
     aer->m = M;
     aer->src_node = ae->src_node;
     aer->dest_node = ae->dest_node;
+    aer->edge_ids = false;
     /* Free either when a multiplication was performed,
      * or a single operand was transposed */
     aer->_free_m = (ae->operand_count > 1 || ae->operands[0].transpose);
@@ -190,6 +191,14 @@ AlgebraicExpression **_AlgebraicExpression_Intermidate_Expressions(AlgebraicExpr
     _referred_edge_ends(ref_entities, q);
     _referred_variable_length_edges(ref_entities, matchPattern, q);
 
+    // Locate last edge, no expression follows it.
+    int lastLinkIdx = 0;
+    for(int i = 0; i < Vector_Size(matchPattern); i++) {
+        AST_GraphEntity *match_element;
+        Vector_Get(matchPattern, i, &match_element);
+        if(match_element->t == N_LINK) lastLinkIdx = i;
+    }
+
     AlgebraicExpression *iexp = _AE_MUL(exp->operand_count);
     iexp->src_node = exp->src_node;
     iexp->dest_node = exp->dest_node;
@@ -242,8 +251,9 @@ AlgebraicExpression **_AlgebraicExpression_Intermidate_Expressions(AlgebraicExpr
             iexp->operands[iexp->operand_count++] = exp->operands[operandIdx++];
         }
 
-        /* If intermidate node is referenced, create a new algebraic expression. */
-        if(_intermidate_node(dest) && _referred_node(dest, ref_entities)) {
+        /* If intermidate node is referenced, create a new algebraic expression.
+         * A cyclic pattern's last node is intermidate, yet closes the pattern. */
+        if(i < lastLinkIdx && _intermidate_node(dest) && _referred_node(dest, ref_entities)) {
             // Finalize current expression.
             iexp->dest_node = dest;
 
@@ -261,18 +271,40 @@ AlgebraicExpression **_AlgebraicExpression_Intermidate_Expressions(AlgebraicExpr
     return expressions;
 }
 
-static inline void _AlgebraicExpression_Execute_MUL(GrB_Matrix C, GrB_Matrix A, GrB_Matrix B, GrB_Descriptor desc) {
+static inline void _AlgebraicExpression_Execute_MUL(GrB_Matrix C, GrB_Matrix A, GrB_Matrix B, GrB_Semiring semiring, GrB_Descriptor desc) {
     GrB_mxm(
         C,                  // Output
         NULL,               // Mask
         NULL,               // Accumulator
-        GxB_LOR_LAND_BOOL,  // Semiring
+        semiring,           // Semiring
         A,                  // First matrix
         B,                  // Second matrix
         desc                // Descriptor        
     );
 }
 
+/* Returns the edge matrix when evaluating expression can carry edge IDs
+ * through to the result, NULL otherwise.
+ * This is the case for a single hop over a typed relation, as relation
+ * matrices hold edge IDs, while the adjacency matrix (untyped edge) does not.
+ * All other operands are label (diagonal) or filter matrices, as such
+ * every result entry is contributed by exactly one relation matrix entry. */
+static GrB_Matrix _AlgebraicExpression_EdgeIDsOperand(const AlgebraicExpression *ae) {
+    if(!ae->edge || ae->edgeLength) return NULL;
+
+    GrB_Type t;
+    GrB_Matrix edgeMat = ae->edge->mat;
+    GxB_Matrix_type(&t, edgeMat);
+    if(t != GrB_UINT64) return NULL;
+
+    // Fixed length traversals, e.g. [e:R*2..2] introduce multiple edge operands.
+    int edgeOperands = 0;
+    for(int i = 0; i < ae->operand_count; i++) {
+        if(ae->operands[i].operand == edgeMat) edgeOperands++;
+    }
+    return (edgeOperands == 1) ? edgeMat : NULL;
+}
+
 // Reverse order of operand within expression,
 // A*B*C will become C*B*A. 
 void _AlgebraicExpression_ReverseOperandOrder(AlgebraicExpression *exp) {
@@ -386,6 +418,8 @@ AlgebraicExpressionResult *AlgebraicExpression_Execute(AlgebraicExpression *ae)
 
     GrB_Matrix A = operands[0].operand;
     GrB_Matrix C = A;
+    GrB_Matrix edgeMat = _AlgebraicExpression_EdgeIDsOperand(ae);
+    GrB_Type type = (edgeMat) ? GrB_UINT64 : GrB_BOOL;
 
     if(operand_count == 1) {
         /* When transposing we must duplicate, as graph matrices
@@ -394,7 +428,7 @@ AlgebraicExpressionResult *AlgebraicExpression_Execute(AlgebraicExpression *ae)
             GrB_Matrix transposed;
             GrB_Index nrows;
             GrB_Matrix_nrows(&nrows, A);
-            GrB_Matrix_new(&transposed, GrB_BOOL, nrows, nrows);
+            GrB_Matrix_new(&transposed, type, nrows, nrows);
             assert(GrB_transpose(transposed, NULL, NULL, A, NULL) == GrB_SUCCESS);
             C = transposed;
         }
@@ -404,6 +438,7 @@ AlgebraicExpressionResult *AlgebraicExpression_Execute(AlgebraicExpression *ae)
         GrB_Descriptor_new(&desc);
         AlgebraicExpressionOperand leftTerm;
         AlgebraicExpressionOperand rightTerm;
+        bool edgeIDs = false;   // C holds edge IDs.
 
         /* Multiply right to left,
          * A*B*C*D,
@@ -419,14 +454,25 @@ AlgebraicExpressionResult *AlgebraicExpression_Execute(AlgebraicExpression *ae)
                 GrB_Index ncols;
                 GrB_Matrix_nrows(&nrows, leftTerm.operand);
                 GrB_Matrix_ncols(&ncols, rightTerm.operand);
-                GrB_Matrix_new(&C, GrB_BOOL, nrows, ncols);
+                GrB_Matrix_new(&C, type, nrows, ncols);
+            }
+
+            /* Once the edge matrix is multiplied, keep its entries (edge IDs)
+             * by selecting them from whichever side they reside on. */
+            GrB_Semiring semiring = GxB_LOR_LAND_BOOL;
+            if(edgeMat && leftTerm.operand == edgeMat) {
+                semiring = GxB_MIN_FIRST_UINT64;
+                edgeIDs = true;
+            } else if(edgeMat && (rightTerm.operand == edgeMat || edgeIDs)) {
+                semiring = GxB_MIN_SECOND_UINT64;
+                edgeIDs = true;
             }
 
             // Multiply and reduce.
             if(leftTerm.transpose) GrB_Descriptor_set(desc, GrB_INP0, GrB_TRAN);
             if(rightTerm.transpose) GrB_Descriptor_set(desc, GrB_INP1, GrB_TRAN);
 
-            _AlgebraicExpression_Execute_MUL(C, leftTerm.operand, rightTerm.operand, desc);
+            _AlgebraicExpression_Execute_MUL(C, leftTerm.operand, rightTerm.operand, semiring, desc);
 
             // Quick return if C is ZERO, there's no way to make progress.
             GrB_Index nvals = 0;
@@ -446,7 +492,9 @@ AlgebraicExpressionResult *AlgebraicExpression_Execute(AlgebraicExpression *ae)
         GrB_Descriptor_free(&desc);
     }    
 
-    return _AlgebraicExpressionResult_New(C, ae);
+    AlgebraicExpressionResult *aer = _AlgebraicExpressionResult_New(C, ae);
+    aer->edge_ids = (edgeMat != NULL);
+    return aer;
 }
 
 void AlgebraicExpression_RemoveTerm(AlgebraicExpression *ae, int idx, AlgebraicExpressionOperand *operand) {
@@ -24,6 +24,7 @@ typedef struct {
     GrB_Matrix m;       // Resulting matrix.
     Node *src_node;     // Nodes represented by matrix rows.
     Node *dest_node;    // Nodes represented by matrix columns.
+    bool edge_ids;      // Entries of M hold the ID of the edge connecting row and column nodes.
     bool _free_m;       // Should M be freed or not.
 } AlgebraicExpressionResult;
 
@@ -9,6 +9,7 @@
 #include "../util/triemap/triemap.h"
 #include "./aggregate.h"
 #include "./repository.h"
+#include "../graph/graphcontext.h"
 
 #include "assert.h"
 #include <math.h>
@@ -581,6 +582,38 @@ SIValue AR_ID(SIValue *argv, int argc) {
     return SI_LongVal(ENTITY_GET_ID(graph_entity));
 }
 
+// Degree of node argv[0], optionally restricted to relationship type argv[1].
+static SIValue _AR_Degree(SIValue *argv, int argc, GRAPH_EDGE_DIR dir) {
+    assert(argc == 1 || argc == 2);
+    if(SIValue_IsNull(argv[0])) return SI_NullVal();
+    assert(argv[0].type == T_PTR);
+    Node *n = (Node*)argv[0].ptrval;
+    GraphContext *gc = GraphContext_GetFromTLS();
+    assert(gc);
+
+    int relation = GRAPH_NO_RELATION;
+    if(argc == 2) {
+        assert(argv[1].type == T_STRING);
+        relation = GraphContext_GetLabelID(gc, argv[1].stringval, STORE_EDGE);
+        // Unknown relationship type, node can't have any such edges.
+        if(relation == GRAPH_NO_RELATION) return SI_LongVal(0);
+    }
+
+    return SI_LongVal(Graph_GetNodeDegree(gc->g, ENTITY_GET_ID(n), dir, relation));
+}
+
+SIValue AR_INDEGREE(SIValue *argv, int argc) {
+    return _AR_Degree(argv, argc, GRAPH_EDGE_DIR_INCOMING);
+}
+
+SIValue AR_OUTDEGREE(SIValue *argv, int argc) {
+    return _AR_Degree(argv, argc, GRAPH_EDGE_DIR_OUTGOING);
+}
+
+SIValue AR_DEGREE(SIValue *argv, int argc) {
+    return _AR_Degree(argv, argc, GRAPH_EDGE_DIR_BOTH);
+}
+
 void AR_RegFunc(char *func_name, size_t func_name_len, AR_Func func) {
     if (__aeRegisteredFuncs == NULL) {
         __aeRegisteredFuncs = NewTrieMap();
@@ -697,4 +730,16 @@ void AR_RegisterFuncs() {
     _toLower("id", &lower_func_name[0], &lower_func_name_len);
     AR_RegFunc(lower_func_name, lower_func_name_len, AR_ID);
     lower_func_name_len = 32;
+
+    _toLower("indegree", &lower_func_name[0], &lower_func_name_len);
+    AR_RegFunc(lower_func_name, lower_func_name_len, AR_INDEGREE);
+    lower_func_name_len = 32;
+
+    _toLower("outdegree", &lower_func_name[0], &lower_func_name_len);
+    AR_RegFunc(lower_func_name, lower_func_name_len, AR_OUTDEGREE);
+    lower_func_name_len = 32;
+
+    _toLower("degree", &lower_func_name[0], &lower_func_name_len);
+    AR_RegFunc(lower_func_name, lower_func_name_len, AR_DEGREE);
+    lower_func_name_len = 32;
 }
\ No newline at end of file
@@ -70,6 +70,9 @@ SIValue AR_TRIM(SIValue *argv, int argc);      /* returns the original string wi
 SIValue AR_CONCAT(SIValue *argv, int argc);    /* returns a string concatenation of given values. */
 
 SIValue AR_ID(SIValue *argv, int argc);        /* returns the id of a relationship or node. */
+SIValue AR_INDEGREE(SIValue *argv, int argc);  /* returns the number of incoming edges of a node. */
+SIValue AR_OUTDEGREE(SIValue *argv, int argc); /* returns the number of outgoing edges of a node. */
+SIValue AR_DEGREE(SIValue *argv, int argc);    /* returns the number of edges connected to a node. */
 
 void AR_RegisterFuncs();                       /* Registers all arithmetic functions. */
 AR_Func AR_GetFunc(char *func_name);           /* Get arithmetic function. */
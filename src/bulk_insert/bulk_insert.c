@@ -91,8 +91,9 @@ RedisModuleString** _BulkInsert_Parse_Labels(RedisModuleCtx *ctx, GraphContext *
         }
 
         labels[label_idx].label_id = store->id;
-        LabelStore_UpdateSchema(store, labels[label_idx].attribute_count, labels[label_idx].attributes);
-        LabelStore_UpdateSchema(allStore, labels[label_idx].attribute_count, labels[label_idx].attributes);
+        int added = LabelStore_UpdateSchema(store, labels[label_idx].attribute_count, labels[label_idx].attributes);
+        added += LabelStore_UpdateSchema(allStore, labels[label_idx].attribute_count, labels[label_idx].attributes);
+        if(added) GraphContext_UpdateSchemaVersion(gc);
     }
 
     return argv;
@@ -184,6 +185,7 @@ RedisModuleString** _BulkInsert_Insert_Nodes(RedisModuleCtx *ctx, GraphContext *
                     argv = _BulkInsert_Read_Labeled_Node_Attributes(ctx, l.attribute_count, values, argv, argc);
                     if(argv == NULL) break;
                     GraphEntity_Add_Properties((GraphEntity*)&n, l.attribute_count, l.attributes, values);
+                    GraphContext_IndexNode(gc, l.label, &n);
                 }
             }
             number_of_labeled_nodes += l.node_count;
@@ -229,7 +231,7 @@ RedisModuleString** _BulkInsert_Insert_Nodes(RedisModuleCtx *ctx, GraphContext *
         argv = _BulkInsert_Read_Unlabeled_Node_Attributes(ctx, keys, values, attribute_count, argv, argc);
         if(argv == NULL) return NULL;
         GraphEntity_Add_Properties((GraphEntity*)&n, attribute_count, keys, values);
-        LabelStore_UpdateSchema(allStore, attribute_count, keys);
+        if(LabelStore_UpdateSchema(allStore, attribute_count, keys)) GraphContext_UpdateSchemaVersion(gc);
     }
 
     return argv;
@@ -0,0 +1,473 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#include <assert.h>
+#include <strings.h>
+#include "cmd_algo.h"
+#include "../graph/graphcontext.h"
+#include "../algorithms/algorithms.h"
+#include "../util/rmalloc.h"
+
+typedef enum {
+    ALGO_PAGERANK,
+    ALGO_WCC,
+    ALGO_TRIANGLES,
+    ALGO_CLUSTERING,
+    ALGO_TRIANGLE_COUNT,
+    ALGO_LPA,
+    ALGO_KHOP,
+} AlgoType;
+
+/* AlgoContext contains the graph to run an algorithm on,
+ * the algorithm's parameters and a blocked Redis client to interact with. */
+typedef struct {
+    AlgoType type;                  /* Algorithm to run. */
+    RedisModuleString *graph_name;  /* Name of graph to run algorithm on. */
+    char *label;                    /* Nodes considered, NULL for all nodes. */
+    char *relation;                 /* Edges considered, NULL for all edges. */
+    char *write_property;           /* Property results are written to, NULL to reply with results. */
+    long long iterations;           /* Maximum number of iterations. */
+    double damping;                 /* PageRank damping factor. */
+    double tolerance;               /* Convergence threshold. */
+    long long seed;                 /* Label propagation tie-break seed. */
+    long long source;               /* K-hop source node ID, -1 when unspecified. */
+    long long hops;                 /* K-hop maximum number of hops. */
+    GRAPH_EDGE_DIR direction;       /* K-hop direction links are followed in. */
+    bool reply_nodes;               /* K-hop replies with reached nodes rather than counts. */
+    RedisModuleBlockedClient *bc;   /* Redis blocked client. */
+} AlgoContext;
+
+AlgoContext* _AlgoContext_New(AlgoType type, RedisModuleString *graph_name) {
+    AlgoContext *ctx = malloc(sizeof(AlgoContext));
+    ctx->type = type;
+    ctx->graph_name = graph_name;
+    ctx->label = NULL;
+    ctx->relation = NULL;
+    ctx->write_property = NULL;
+    ctx->iterations = 20;
+    ctx->damping = 0.85;
+    ctx->tolerance = 1e-7;
+    ctx->seed = 0;
+    ctx->source = -1;
+    ctx->hops = 1;
+    ctx->direction = GRAPH_EDGE_DIR_OUTGOING;
+    ctx->reply_nodes = false;
+    ctx->bc = NULL;
+    return ctx;
+}
+
+void _AlgoContext_Free(AlgoContext *ctx) {
+    free(ctx->label);
+    free(ctx->relation);
+    free(ctx->write_property);
+    free(ctx);
+}
+
+/* Parses algorithm options, name value pairs.
+ * On failure an error is replied and 0 returned. */
+int _AlgoContext_ParseOptions(RedisModuleCtx *ctx, AlgoContext *aCtx, RedisModuleString **argv, int argc) {
+    if(argc % 2) {
+        RedisModule_ReplyWithError(ctx, "ERR Algorithm options must be name value pairs.");
+        return 0;
+    }
+
+    for(int i = 0; i < argc; i += 2) {
+        const char *option = RedisModule_StringPtrLen(argv[i], NULL);
+        const char *value = RedisModule_StringPtrLen(argv[i+1], NULL);
+        bool valid = true;
+
+        if(!strcasecmp(option, "LABEL")) {
+            free(aCtx->label);
+            aCtx->label = strdup(value);
+        } else if(!strcasecmp(option, "RELATION")) {
+            free(aCtx->relation);
+            aCtx->relation = strdup(value);
+        } else if(!strcasecmp(option, "WRITE")) {
+            free(aCtx->write_property);
+            aCtx->write_property = strdup(value);
+        } else if(!strcasecmp(option, "ITERATIONS")) {
+            valid = (RedisModule_StringToLongLong(argv[i+1], &aCtx->iterations) == REDISMODULE_OK &&
+                     aCtx->iterations > 0);
+        } else if(!strcasecmp(option, "DAMPING")) {
+            valid = (RedisModule_StringToDouble(argv[i+1], &aCtx->damping) == REDISMODULE_OK &&
+                     aCtx->damping >= 0 && aCtx->damping <= 1);
+        } else if(!strcasecmp(option, "TOLERANCE")) {
+            valid = (RedisModule_StringToDouble(argv[i+1], &aCtx->tolerance) == REDISMODULE_OK &&
+                     aCtx->tolerance >= 0);
+        } else if(!strcasecmp(option, "SEED")) {
+            valid = (RedisModule_StringToLongLong(argv[i+1], &aCtx->seed) == REDISMODULE_OK);
+        } else if(!strcasecmp(option, "SOURCE")) {
+            valid = (RedisModule_StringToLongLong(argv[i+1], &aCtx->source) == REDISMODULE_OK &&
+                     aCtx->source >= 0);
+        } else if(!strcasecmp(option, "HOPS")) {
+            valid = (RedisModule_StringToLongLong(argv[i+1], &aCtx->hops) == REDISMODULE_OK &&
+                     aCtx->hops > 0);
+        } else if(!strcasecmp(option, "DIRECTION")) {
+            if(!strcasecmp(value, "OUT")) aCtx->direction = GRAPH_EDGE_DIR_OUTGOING;
+            else if(!strcasecmp(value, "IN")) aCtx->direction = GRAPH_EDGE_DIR_INCOMING;
+            else if(!strcasecmp(value, "BOTH")) aCtx->direction = GRAPH_EDGE_DIR_BOTH;
+            else valid = false;
+        } else if(!strcasecmp(option, "OUTPUT")) {
+            if(!strcasecmp(value, "COUNTS")) aCtx->reply_nodes = false;
+            else if(!strcasecmp(value, "NODES")) aCtx->reply_nodes = true;
+            else valid = false;
+        } else {
+            char *reply;
+            asprintf(&reply, "ERR Unknown algorithm option %s.", option);
+            RedisModule_ReplyWithError(ctx, reply);
+            free(reply);
+            return 0;
+        }
+
+        if(!valid) {
+            char *reply;
+            asprintf(&reply, "ERR Invalid value %s for option %s.", value, option);
+            RedisModule_ReplyWithError(ctx, reply);
+            free(reply);
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/* Builds a boolean matrix A[dest, src] of edges of given relation type
+ * connecting nodes of given label, and a vector holding an entry for each node. */
+void _Algo_BuildMatrix(const Graph *g, int label, int relation, GrB_Matrix *A, GrB_Vector *nodes) {
+    GrB_Index n = Graph_RequiredMatrixDim(g);
+    GrB_Matrix R = (relation == GRAPH_NO_RELATION) ?
+                   Graph_GetAdjacencyMatrix(g) : Graph_GetRelationMatrix(g, relation);
+
+    // Relation matrices hold edge IDs, zero included, keep structure only.
+    GrB_Matrix_new(A, GrB_BOOL, n, n);
+    GrB_Matrix_apply(*A, NULL, NULL, GxB_ONE_BOOL, R, NULL);
+
+    GrB_Vector_new(nodes, GrB_BOOL, n);
+    if(label == GRAPH_NO_LABEL) {
+        size_t node_count = Graph_NodeCount(g);
+        GrB_Index *ids = rm_malloc(sizeof(GrB_Index) * node_count);
+        bool *values = rm_malloc(sizeof(bool) * node_count);
+
+        Entity *en;
+        size_t i = 0;
+        DataBlockIterator *it = Graph_ScanNodes(g);
+        while((en = (Entity*)DataBlockIterator_Next(it))) {
+            ids[i] = en->id;
+            values[i] = true;
+            i++;
+        }
+        DataBlockIterator_Free(it);
+
+        GrB_Vector_build_BOOL(*nodes, ids, values, i, GrB_LOR);
+        rm_free(ids);
+        rm_free(values);
+    } else {
+        // Discard edges leading to or from nodes of other labels.
+        GrB_Matrix L = Graph_GetLabel(g, label);
+        GrB_mxm(*A, NULL, NULL, GxB_LOR_LAND_BOOL, L, *A, NULL);
+        GrB_mxm(*A, NULL, NULL, GxB_LOR_LAND_BOOL, *A, L, NULL);
+        GrB_Matrix_reduce_Monoid(*nodes, NULL, NULL, GxB_LOR_BOOL_MONOID, L, NULL);
+    }
+}
+
+/* Extracts algorithm results, each result is either
+ * a floating point score or an integer, such as a component ID. */
+GrB_Index _Algo_ExtractResults(GrB_Vector results, GrB_Index **ids, SIValue **values) {
+    GrB_Type type;
+    GrB_Index nvals;
+    GxB_Vector_type(&type, results);
+    GrB_Vector_nvals(&nvals, results);
+    *ids = rm_malloc(sizeof(GrB_Index) * nvals);
+    *values = rm_malloc(sizeof(SIValue) * nvals);
+
+    if(type == GrB_FP64) {
+        double *x = rm_malloc(sizeof(double) * nvals);
+        GrB_Vector_extractTuples_FP64(*ids, x, &nvals, results);
+        for(GrB_Index i = 0; i < nvals; i++) (*values)[i] = SI_DoubleVal(x[i]);
+        rm_free(x);
+    } else {
+        assert(type == GrB_UINT64);
+        uint64_t *x = rm_malloc(sizeof(uint64_t) * nvals);
+        GrB_Vector_extractTuples_UINT64(*ids, x, &nvals, results);
+        for(GrB_Index i = 0; i < nvals; i++) (*values)[i] = SI_LongVal(x[i]);
+        rm_free(x);
+    }
+
+    return nvals;
+}
+
+// Replies with an array of node ID, result pairs.
+void _Algo_ReplyWithResults(RedisModuleCtx *ctx, GrB_Vector results) {
+    GrB_Index *ids;
+    SIValue *values;
+    GrB_Index nvals = _Algo_ExtractResults(results, &ids, &values);
+
+    RedisModule_ReplyWithArray(ctx, nvals);
+    for(GrB_Index i = 0; i < nvals; i++) {
+        RedisModule_ReplyWithArray(ctx, 2);
+        RedisModule_ReplyWithLongLong(ctx, ids[i]);
+        if(values[i].type == T_DOUBLE) RedisModule_ReplyWithDouble(ctx, values[i].doubleval);
+        else RedisModule_ReplyWithLongLong(ctx, values[i].longval);
+    }
+
+    rm_free(ids);
+    rm_free(values);
+}
+
+/* Sets each node's property to its result, keeping indices on the
+ * property current, replies with the number of properties set. */
+void _Algo_WriteResults(RedisModuleCtx *ctx, GraphContext *gc, AlgoContext *aCtx, GrB_Vector results) {
+    char *property = aCtx->write_property;
+    GrB_Index *ids;
+    SIValue *values;
+    GrB_Index nvals = _Algo_ExtractResults(results, &ids, &values);
+
+    // Index on property per label, resolved on first write to a node of the label.
+    int label_count = Graph_LabelTypeCount(gc->g);
+    Index **indices = rm_malloc(sizeof(Index*) * label_count);
+    bool *written = rm_calloc(label_count, sizeof(bool));
+
+    Node n;
+    for(GrB_Index i = 0; i < nvals; i++) {
+        // Numeric properties are stored as doubles, keep results comparable.
+        if(values[i].type == T_INT64) values[i] = SI_DoubleVal(values[i].longval);
+        Graph_GetNode(gc->g, ids[i], &n);
+
+        int label = Graph_GetNodeLabel(gc->g, ids[i]);
+        if(label != GRAPH_NO_LABEL) {
+            if(!written[label]) {
+                written[label] = true;
+                indices[label] = GraphContext_GetIndex(gc, gc->node_stores[label]->label, property,
+                                                       STORE_NODE);
+            }
+            // Index is updated while the node still holds its previous value.
+            if(indices[label]) Index_UpdateNode(indices[label], &n, values + i);
+        }
+
+        SIValue *current = GraphEntity_Get_Property((GraphEntity*)&n, property);
+        if(current == PROPERTY_NOTFOUND) {
+            GraphEntity_Add_Properties((GraphEntity*)&n, 1, &property, values + i);
+        } else {
+            SIValue_Free(current);
+            *current = values[i];
+        }
+    }
+
+    // Track newly introduced property, within the schema of every written label.
+    if(nvals > 0) {
+        LabelStore *allStore = GraphContext_AllStore(gc, STORE_NODE);
+        if(LabelStore_UpdateSchema(allStore, 1, &property)) GraphContext_UpdateSchemaVersion(gc);
+        for(int label = 0; label < label_count; label++) {
+            if(!written[label]) continue;
+            LabelStore *store = gc->node_stores[label];
+            if(LabelStore_UpdateSchema(store, 1, &property)) GraphContext_UpdateSchemaVersion(gc);
+        }
+    }
+
+    RedisModule_ReplyWithLongLong(ctx, nvals);
+    rm_free(indices);
+    rm_free(written);
+    rm_free(ids);
+    rm_free(values);
+}
+
+/* Finds nodes within aCtx->hops of the source node, sets levels to
+ * each reached node's distance. Replies with the number of nodes
+ * reached at each level, unless nodes are written or replied with. */
+void _Algo_KHop(RedisModuleCtx *ctx, AlgoContext *aCtx, GrB_Matrix A, GrB_Vector *levels) {
+    bool transpose = (aCtx->direction == GRAPH_EDGE_DIR_INCOMING);
+    if(aCtx->direction == GRAPH_EDGE_DIR_BOTH) {
+        GrB_Descriptor desc;
+        GrB_Descriptor_new(&desc);
+        GrB_Descriptor_set(desc, GrB_INP1, GrB_TRAN);
+        GrB_eWiseAdd_Matrix_BinaryOp(A, NULL, NULL, GrB_LOR, A, A, desc);
+        GrB_Descriptor_free(&desc);
+    }
+
+    uint64_t *level_counts = rm_malloc(sizeof(uint64_t) * (aCtx->hops + 1));
+    KHop(levels, level_counts, A, transpose, aCtx->source, aCtx->hops);
+
+    if(!aCtx->write_property && !aCtx->reply_nodes) {
+        RedisModule_ReplyWithArray(ctx, aCtx->hops);
+        for(long long i = 1; i <= aCtx->hops; i++) RedisModule_ReplyWithLongLong(ctx, level_counts[i]);
+    }
+    rm_free(level_counts);
+}
+
+/* Runs algorithm under the graph's read lock, unless results are written
+ * back to the graph, in which case the Redis global lock and the graph's
+ * write lock are held. */
+void _MGraph_Algo(void *args) {
+    AlgoContext *aCtx = args;
+    RedisModuleBlockedClient *bc = aCtx->bc;
+    RedisModuleCtx *ctx = RedisModule_GetThreadSafeContext(bc);
+    bool write = (aCtx->write_property != NULL);
+    if(write) RedisModule_ThreadSafeContextLock(ctx);
+
+    GraphContext *gc = GraphContext_Retrieve(ctx, aCtx->graph_name);
+    if(!gc) {
+        RedisModule_ReplyWithError(ctx, "key doesn't contains a graph object.");
+        goto cleanup;
+    }
+
+    if(write && gc->read_only) {
+        RedisModule_ReplyWithError(ctx, "ERR Graph is a read-only projection.");
+        goto cleanup;
+    }
+
+    (write) ? Graph_AcquireWriteLock(gc->g) : Graph_AcquireReadLock(gc->g);
+
+    int label = GRAPH_NO_LABEL;
+    int relation = GRAPH_NO_RELATION;
+    if(aCtx->label) label = GraphContext_GetLabelID(gc, aCtx->label, STORE_NODE);
+    if(aCtx->relation) relation = GraphContext_GetLabelID(gc, aCtx->relation, STORE_EDGE);
+    if((aCtx->label && label == GRAPH_NO_LABEL) || (aCtx->relation && relation == GRAPH_NO_RELATION)) {
+        char *reply;
+        if(label == GRAPH_NO_LABEL && aCtx->label) asprintf(&reply, "ERR No such label %s.", aCtx->label);
+        else asprintf(&reply, "ERR No such relationship type %s.", aCtx->relation);
+        RedisModule_ReplyWithError(ctx, reply);
+        free(reply);
+        Graph_ReleaseLock(gc->g);
+        goto cleanup;
+    }
+
+    GrB_Matrix A;
+    GrB_Vector nodes;
+    GrB_Vector results = NULL;
+    _Algo_BuildMatrix(gc->g, label, relation, &A, &nodes);
+
+    // Global triangle count is replied as a single integer.
+    if(aCtx->type == ALGO_TRIANGLE_COUNT) {
+        RedisModule_ReplyWithLongLong(ctx, TriangleCount(A));
+        goto release;
+    }
+
+    if(aCtx->type == ALGO_KHOP) {
+        bool source_exists = false;
+        if((GrB_Index)aCtx->source < Graph_RequiredMatrixDim(gc->g)) {
+            GrB_Vector_extractElement_BOOL(&source_exists, nodes, aCtx->source);
+        }
+        if(!source_exists) {
+            char *reply;
+            asprintf(&reply, "ERR Invalid source node %lld.", aCtx->source);
+            RedisModule_ReplyWithError(ctx, reply);
+            free(reply);
+            goto release;
+        }
+    }
+
+    switch(aCtx->type) {
+        case ALGO_PAGERANK:
+            PageRank(&results, A, nodes, aCtx->iterations, aCtx->damping, aCtx->tolerance);
+            break;
+        case ALGO_WCC:
+            WCC(&results, A, nodes);
+            break;
+        case ALGO_TRIANGLES:
+            LocalTriangles(&results, NULL, A, nodes);
+            break;
+        case ALGO_CLUSTERING:
+            LocalTriangles(NULL, &results, A, nodes);
+            break;
+        case ALGO_LPA:
+            LabelPropagation(&results, A, nodes, aCtx->iterations, aCtx->seed);
+            break;
+        case ALGO_KHOP:
+            _Algo_KHop(ctx, aCtx, A, &results);
+            // Unless reached nodes are required, per level counts were replied.
+            if(!write && !aCtx->reply_nodes) goto release;
+            break;
+        default:
+            assert(false);
+    }
+
+    if(write) _Algo_WriteResults(ctx, gc, aCtx, results);
+    else _Algo_ReplyWithResults(ctx, results);
+
+release:
+    GrB_Vector_free(&results);
+    GrB_Vector_free(&nodes);
+    GrB_Matrix_free(&A);
+    Graph_ReleaseLock(gc->g);
+
+cleanup:
+    if(write) RedisModule_ThreadSafeContextUnlock(ctx);
+    _AlgoContext_Free(aCtx);
+    RedisModule_UnblockClient(bc, NULL);
+    RedisModule_FreeThreadSafeContext(ctx);
+}
+
+/* Runs a graph algorithm
+ * Args:
+ * argv[1] graph name
+ * argv[2] algorithm, PAGERANK, WCC, TRIANGLES, CLUSTERING, TRIANGLECOUNT, LPA or KHOP
+ * argv[3...] algorithm options, name value pairs:
+ *     LABEL <label> consider only nodes of label
+ *     RELATION <type> consider only edges of relationship type
+ *     ITERATIONS <n> maximum number of iterations
+ *     DAMPING <d> PageRank damping factor
+ *     TOLERANCE <t> convergence threshold
+ *     SEED <s> label propagation tie-break seed
+ *     SOURCE <id> k-hop source node
+ *     HOPS <k> k-hop maximum number of hops
+ *     DIRECTION <OUT|IN|BOTH> k-hop direction links are followed in
+ *     OUTPUT <COUNTS|NODES> k-hop replies with per level counts or reached nodes
+ *     WRITE <property> store results as node property rather than replying with them */
+int MGraph_Algo(RedisModuleCtx *ctx, RedisModuleString **argv, int argc) {
+    if (argc < 3) return RedisModule_WrongArity(ctx);
+
+    AlgoType type;
+    const char *algorithm = RedisModule_StringPtrLen(argv[2], NULL);
+    if(!strcasecmp(algorithm, "PAGERANK")) {
+        type = ALGO_PAGERANK;
+    } else if(!strcasecmp(algorithm, "WCC")) {
+        type = ALGO_WCC;
+    } else if(!strcasecmp(algorithm, "TRIANGLES")) {
+        type = ALGO_TRIANGLES;
+    } else if(!strcasecmp(algorithm, "CLUSTERING")) {
+        type = ALGO_CLUSTERING;
+    } else if(!strcasecmp(algorithm, "TRIANGLECOUNT")) {
+        type = ALGO_TRIANGLE_COUNT;
+    } else if(!strcasecmp(algorithm, "LPA")) {
+        type = ALGO_LPA;
+    } else if(!strcasecmp(algorithm, "KHOP")) {
+        type = ALGO_KHOP;
+    } else {
+        char *reply;
+        asprintf(&reply, "ERR Unknown algorithm %s.", algorithm);
+        RedisModule_ReplyWithError(ctx, reply);
+        free(reply);
+        return REDISMODULE_OK;
+    }
+
+    AlgoContext *aCtx = _AlgoContext_New(type, argv[1]);
+    if(!_AlgoContext_ParseOptions(ctx, aCtx, argv + 3, argc - 3)) {
+        _AlgoContext_Free(aCtx);
+        return REDISMODULE_OK;
+    }
+
+    if(type == ALGO_KHOP && aCtx->source == -1) {
+        RedisModule_ReplyWithError(ctx, "ERR KHOP requires a SOURCE node.");
+        _AlgoContext_Free(aCtx);
+        return REDISMODULE_OK;
+    }
+
+    // Triangle count is a graph wide figure, there's no node property to write.
+    if(type == ALGO_TRIANGLE_COUNT && aCtx->write_property) {
+        RedisModule_ReplyWithError(ctx, "ERR TRIANGLECOUNT does not support WRITE.");
+        _AlgoContext_Free(aCtx);
+        return REDISMODULE_OK;
+    }
+
+    // Replicate only if algorithm modifies the graph.
+    if(aCtx->write_property) RedisModule_ReplicateVerbatim(ctx);
+
+    // Algorithms process the entire graph, run them on a worker thread.
+    aCtx->bc = RedisModule_BlockClient(ctx, NULL, NULL, NULL, 0);
+    thpool_add_work(_thpool, _MGraph_Algo, aCtx);
+    return REDISMODULE_OK;
+}
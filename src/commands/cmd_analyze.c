@@ -0,0 +1,112 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#include "cmd_analyze.h"
+#include "../graph/graphcontext.h"
+
+/* AnalyzeContext contains the graph to analyze,
+ * an optional label to restrict analysis to
+ * and a blocked Redis client to interact with. */
+typedef struct {
+    RedisModuleString *graph_name;  /* Name of graph to analyze. */
+    RedisModuleString *label;       /* Label to analyze, NULL for all labels. */
+    RedisModuleBlockedClient *bc;   /* Redis blocked client. */
+} AnalyzeContext;
+
+AnalyzeContext* _AnalyzeContext_New(RedisModuleString *graph_name, RedisModuleString *label,
+                                    RedisModuleBlockedClient *bc) {
+    AnalyzeContext *ctx = malloc(sizeof(AnalyzeContext));
+    ctx->bc = bc;
+    ctx->label = label;
+    ctx->graph_name = graph_name;
+    return ctx;
+}
+
+void _AnalyzeContext_Free(AnalyzeContext *ctx) {
+    free(ctx);
+}
+
+/* Replies with an array of label, property, null fraction
+ * and distinct values count for each statistics of label. */
+void _ReplyWithLabelStats(RedisModuleCtx *ctx, GraphContext *gc, const char *label) {
+    int count = 0;
+    RedisModule_ReplyWithArray(ctx, REDISMODULE_POSTPONED_ARRAY_LEN);
+    for(int i = 0; i < gc->stats_count; i++) {
+        PropertyStats *stats = gc->stats[i];
+        if(label && strcmp(label, stats->label)) continue;
+
+        double null_fraction = (stats->entity_count) ?
+                               (double)stats->null_count / stats->entity_count : 0;
+        RedisModule_ReplyWithArray(ctx, 4);
+        RedisModule_ReplyWithStringBuffer(ctx, stats->label, strlen(stats->label));
+        RedisModule_ReplyWithStringBuffer(ctx, stats->property, strlen(stats->property));
+        RedisModule_ReplyWithDouble(ctx, null_fraction);
+        RedisModule_ReplyWithLongLong(ctx, (long long)(stats->distinct + 0.5));
+        count++;
+    }
+    RedisModule_ReplySetArrayLength(ctx, count);
+}
+
+/* Collects statistics, holding the same locks as index construction,
+ * as statistics are read by concurrent queries. */
+void _MGraph_Analyze(void *args) {
+    AnalyzeContext *aCtx = args;
+    RedisModuleBlockedClient *bc = aCtx->bc;
+    RedisModuleCtx *ctx = RedisModule_GetThreadSafeContext(bc);
+    RedisModule_ThreadSafeContextLock(ctx);
+
+    const char *label = NULL;
+    GraphContext *gc = GraphContext_Retrieve(ctx, aCtx->graph_name);
+    if(!gc) {
+        RedisModule_ReplyWithError(ctx, "key doesn't contains a graph object.");
+        goto cleanup;
+    }
+
+    Graph_AcquireWriteLock(gc->g);
+    if(aCtx->label) {
+        label = RedisModule_StringPtrLen(aCtx->label, NULL);
+        int label_id = GraphContext_GetLabelID(gc, label, STORE_NODE);
+        if(label_id == GRAPH_NO_LABEL) {
+            char *reply;
+            asprintf(&reply, "ERR Unable to analyze :%s: no such label.", label);
+            RedisModule_ReplyWithError(ctx, reply);
+            free(reply);
+        } else {
+            GraphContext_AnalyzeLabel(gc, label_id);
+            _ReplyWithLabelStats(ctx, gc, label);
+        }
+    } else {
+        for(int i = 0; i < gc->label_count; i++) GraphContext_AnalyzeLabel(gc, i);
+        _ReplyWithLabelStats(ctx, gc, NULL);
+    }
+    Graph_ReleaseLock(gc->g);
+
+cleanup:
+    RedisModule_ThreadSafeContextUnlock(ctx);
+    _AnalyzeContext_Free(aCtx);
+    RedisModule_UnblockClient(bc, NULL);
+    RedisModule_FreeThreadSafeContext(ctx);
+}
+
+/* Collects property statistics used by the query optimizer
+ * Args:
+ * argv[1] graph name
+ * argv[2] label to analyze, optional, defaults to all labels */
+int MGraph_Analyze(RedisModuleCtx *ctx, RedisModuleString **argv, int argc) {
+    if (argc < 2 || argc > 3) return RedisModule_WrongArity(ctx);
+
+    RedisModuleString *label = (argc == 3) ? argv[2] : NULL;
+    RedisModuleBlockedClient *bc = RedisModule_BlockClient(ctx, NULL, NULL, NULL, 0);
+    AnalyzeContext *aCtx = _AnalyzeContext_New(argv[1], label, bc);
+
+    // Analysis scans the entire graph, perform it on a worker thread.
+    thpool_add_work(_thpool, _MGraph_Analyze, aCtx);
+
+    // Statistics are persisted, replicas collect their own.
+    RedisModule_ReplicateVerbatim(ctx);
+    return REDISMODULE_OK;
+}
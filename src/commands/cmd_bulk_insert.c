@@ -94,6 +94,11 @@ void _MGraph_BulkInsert(void *args) {
             RedisModule_ReplyWithError(ctx, "Bulk insert query did not include a BEGIN token and graph was not found.");
             goto cleanup;
         }
+        if (gc->read_only) {
+            RedisModule_ReplyWithError(ctx, "ERR Graph is a read-only projection.");
+            gc = NULL;
+            goto cleanup;
+        }
     }
 
     // Lock the graph for writing.
@@ -32,8 +32,8 @@ void _DeleteContext_Free(DeleteContext *ctx) {
     free(ctx);
 }
 
-/* Delete graph, removing the key from Redis and
- * freeing every resource allocated by the graph. */
+/* Delete graph, removing the key from Redis,
+ * graph resources are reclaimed in the background, see lazyfree.h */
 void _MGraph_Delete(void *args) {
     double tic[2];
     simple_tic(tic);
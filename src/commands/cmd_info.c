@@ -0,0 +1,39 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#include "cmd_info.h"
+#include "../query_cache.h"
+#include "../graph/lazyfree.h"
+
+/* Reports module wide statistics as a flat array of field, value pairs.
+ * Args:
+ * none */
+int MGraph_Info(RedisModuleCtx *ctx, RedisModuleString **argv, int argc) {
+    if (argc != 1) return RedisModule_WrongArity(ctx);
+
+    LazyFreeStats stats;
+    LazyFree_GetStats(&stats);
+    QueryCacheStats cache_stats;
+    QueryCache_GetStats(&cache_stats);
+
+    RedisModule_ReplyWithArray(ctx, 14);
+    RedisModule_ReplyWithSimpleString(ctx, "lazyfree_pending_graphs");
+    RedisModule_ReplyWithLongLong(ctx, stats.pending_graphs);
+    RedisModule_ReplyWithSimpleString(ctx, "lazyfree_freed_graphs");
+    RedisModule_ReplyWithLongLong(ctx, stats.freed_graphs);
+    RedisModule_ReplyWithSimpleString(ctx, "lazyfree_freed_entities");
+    RedisModule_ReplyWithLongLong(ctx, stats.freed_entities);
+    RedisModule_ReplyWithSimpleString(ctx, "lazyfree_reclaimed_bytes");
+    RedisModule_ReplyWithLongLong(ctx, stats.reclaimed_bytes);
+    RedisModule_ReplyWithSimpleString(ctx, "query_cache_hits");
+    RedisModule_ReplyWithLongLong(ctx, cache_stats.hits);
+    RedisModule_ReplyWithSimpleString(ctx, "query_cache_misses");
+    RedisModule_ReplyWithLongLong(ctx, cache_stats.misses);
+    RedisModule_ReplyWithSimpleString(ctx, "query_cache_size");
+    RedisModule_ReplyWithLongLong(ctx, cache_stats.size);
+    return REDISMODULE_OK;
+}
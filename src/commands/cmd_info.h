@@ -0,0 +1,15 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#ifndef GRAPH_INFO_H
+#define GRAPH_INFO_H
+
+#include "../redismodule.h"
+
+int MGraph_Info(RedisModuleCtx *ctx, RedisModuleString **argv, int argc);
+
+#endif
@@ -0,0 +1,298 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#include <assert.h>
+#include <strings.h>
+#include "cmd_project.h"
+#include "../graph/graphcontext.h"
+#include "../util/rmalloc.h"
+
+/* ProjectContext contains the graph to project, the labels and
+ * relationship types to project and a blocked Redis client to interact with. */
+typedef struct {
+    RedisModuleString *graph_name;      /* Name of graph to project. */
+    RedisModuleString *projection_name; /* Name of projected graph. */
+    RedisModuleString **labels;         /* Labels to project, NULL for all labels. */
+    int label_count;                    /* Number of labels to project. */
+    RedisModuleString **relations;      /* Relationship types to project, NULL for all types. */
+    int relation_count;                 /* Number of relationship types to project. */
+    RedisModuleBlockedClient *bc;       /* Redis blocked client. */
+} ProjectContext;
+
+ProjectContext* _ProjectContext_New(RedisModuleString *graph_name, RedisModuleString *projection_name) {
+    ProjectContext *ctx = malloc(sizeof(ProjectContext));
+    ctx->graph_name = graph_name;
+    ctx->projection_name = projection_name;
+    ctx->labels = NULL;
+    ctx->label_count = 0;
+    ctx->relations = NULL;
+    ctx->relation_count = 0;
+    ctx->bc = NULL;
+    return ctx;
+}
+
+void _ProjectContext_Free(ProjectContext *ctx) {
+    free(ctx);
+}
+
+/* Resolves names to label or relationship type IDs, all of gc's when names is NULL.
+ * On failure an error is replied and NULL returned. */
+int* _Project_ResolveIDs(RedisModuleCtx *ctx, const GraphContext *gc, RedisModuleString **names,
+                         int *count, LabelStoreType t) {
+    if(!names) *count = (t == STORE_NODE) ? gc->label_count : gc->relation_count;
+    int *ids = rm_malloc(sizeof(int) * (*count + 1));
+
+    for(int i = 0; i < *count; i++) {
+        if(!names) {
+            ids[i] = i;
+            continue;
+        }
+
+        const char *name = RedisModule_StringPtrLen(names[i], NULL);
+        ids[i] = GraphContext_GetLabelID(gc, name, t);
+        if(ids[i] == GRAPH_NO_LABEL) {
+            char *reply;
+            if(t == STORE_NODE) asprintf(&reply, "ERR No such label %s.", name);
+            else asprintf(&reply, "ERR No such relationship type %s.", name);
+            RedisModule_ReplyWithError(ctx, reply);
+            free(reply);
+            rm_free(ids);
+            return NULL;
+        }
+    }
+
+    return ids;
+}
+
+/* Collects the IDs of projected nodes in ascending order, along with
+ * each node's label within the projection, GRAPH_NO_LABEL if it has none.
+ * Returns the number of projected nodes. */
+GrB_Index _Project_CollectNodes(const GraphContext *gc, const int *labels, int label_count,
+                                bool all_nodes, GrB_Index **ids, uint64_t **node_labels) {
+    Graph *g = gc->g;
+    GrB_Index n = Graph_RequiredMatrixDim(g);
+    GrB_Index node_count;
+
+    if(all_nodes) {
+        node_count = Graph_NodeCount(g);
+        *ids = rm_malloc(sizeof(GrB_Index) * node_count);
+        *node_labels = rm_malloc(sizeof(uint64_t) * node_count);
+
+        // Labels are projected as is.
+        Entity *en;
+        GrB_Index i = 0;
+        DataBlockIterator *it = Graph_ScanNodes(g);
+        while((en = (Entity*)DataBlockIterator_Next(it))) {
+            (*ids)[i] = en->id;
+            (*node_labels)[i] = Graph_GetNodeLabel(g, en->id);
+            i++;
+        }
+        DataBlockIterator_Free(it);
+        return i;
+    }
+
+    // projected[i] is node i's label within the projection.
+    GrB_Vector projected;
+    GrB_Vector labeled;
+    GrB_Vector_new(&projected, GrB_UINT64, n);
+    GrB_Vector_new(&labeled, GrB_BOOL, n);
+    for(int i = 0; i < label_count; i++) {
+        GrB_Matrix L = Graph_GetLabel(g, labels[i]);
+        GrB_Matrix_reduce_Monoid(labeled, NULL, NULL, GxB_LOR_BOOL_MONOID, L, NULL);
+        GrB_Vector_assign_UINT64(projected, labeled, NULL, i, GrB_ALL, n, NULL);
+    }
+
+    GrB_Vector_nvals(&node_count, projected);
+    *ids = rm_malloc(sizeof(GrB_Index) * node_count);
+    *node_labels = rm_malloc(sizeof(uint64_t) * node_count);
+    GrB_Vector_extractTuples_UINT64(*ids, *node_labels, &node_count, projected);
+
+    GrB_Vector_free(&projected);
+    GrB_Vector_free(&labeled);
+    return node_count;
+}
+
+// Copies entity properties, tracking them within the projection's schemas.
+void _Project_CopyProperties(GraphEntity *src, GraphEntity *dest, LabelStore *allstore, LabelStore *store) {
+    int prop_count = src->entity->prop_count;
+    if(prop_count == 0) return;
+
+    char *keys[prop_count];
+    SIValue values[prop_count];
+    for(int i = 0; i < prop_count; i++) {
+        keys[i] = src->entity->properties[i].name;
+        values[i] = SI_Clone(src->entity->properties[i].value);
+    }
+
+    GraphEntity_Add_Properties(dest, prop_count, keys, values);
+    LabelStore_UpdateSchema(allstore, prop_count, keys);
+    if(store) LabelStore_UpdateSchema(store, prop_count, keys);
+}
+
+/* Builds the projection under the Redis global lock, as a key is introduced,
+ * and the source graph's read lock. */
+void _MGraph_Project(void *args) {
+    ProjectContext *pCtx = args;
+    RedisModuleBlockedClient *bc = pCtx->bc;
+    RedisModuleCtx *ctx = RedisModule_GetThreadSafeContext(bc);
+    RedisModule_ThreadSafeContextLock(ctx);
+
+    GraphContext *gc = GraphContext_Retrieve(ctx, pCtx->graph_name);
+    if(!gc) {
+        RedisModule_ReplyWithError(ctx, "key doesn't contains a graph object.");
+        goto cleanup;
+    }
+
+    Graph_AcquireReadLock(gc->g);
+
+    int label_count = pCtx->label_count;
+    int relation_count = pCtx->relation_count;
+    int *labels = _Project_ResolveIDs(ctx, gc, pCtx->labels, &label_count, STORE_NODE);
+    int *relations = NULL;
+    if(labels) relations = _Project_ResolveIDs(ctx, gc, pCtx->relations, &relation_count, STORE_EDGE);
+    if(!labels || !relations) {
+        rm_free(labels);
+        Graph_ReleaseLock(gc->g);
+        goto cleanup;
+    }
+
+    GrB_Index *ids;
+    uint64_t *node_labels;
+    GrB_Index node_count = _Project_CollectNodes(gc, labels, label_count, (pCtx->labels == NULL),
+                                                 &ids, &node_labels);
+
+    GraphContext *projection = GraphContext_New(ctx, pCtx->projection_name, node_count, GRAPH_DEFAULT_EDGE_CAP);
+    if(!projection) {
+        RedisModule_ReplyWithError(ctx, "Graph name already in use as a Redis key.");
+        goto release;
+    }
+    projection->read_only = true;
+    Graph *pg = projection->g;
+
+    // Projected labels and relationship types are renumbered in order.
+    for(int i = 0; i < label_count; i++) {
+        GraphContext_AddLabel(projection, gc->node_stores[labels[i]]->label);
+    }
+    for(int i = 0; i < relation_count; i++) {
+        GraphContext_AddRelationType(projection, gc->relation_stores[relations[i]]->label);
+    }
+
+    // Projected node i is source node ids[i].
+    Graph_AllocateNodes(pg, node_count);
+    for(GrB_Index i = 0; i < node_count; i++) {
+        Node src;
+        Node node;
+        int label = (int)node_labels[i];
+        Graph_GetNode(gc->g, ids[i], &src);
+        Graph_CreateNode(pg, label, &node);
+        assert(ENTITY_GET_ID(&node) == i);
+
+        LabelStore *store = (label == GRAPH_NO_LABEL) ? NULL : projection->node_stores[label];
+        _Project_CopyProperties((GraphEntity*)&src, (GraphEntity*)&node, projection->node_allstore, store);
+    }
+
+    // Edges among projected nodes, R(ids, ids) is indexed by projected node IDs.
+    size_t edge_count = 0;
+    for(int i = 0; i < relation_count && node_count > 0; i++) {
+        GrB_Matrix R = Graph_GetRelationMatrix(gc->g, relations[i]);
+        GrB_Matrix P;
+        GrB_Matrix_new(&P, GrB_UINT64, node_count, node_count);
+        GrB_extract(P, NULL, NULL, R, ids, node_count, ids, node_count, NULL);
+
+        GrB_Index nvals;
+        GrB_Matrix_nvals(&nvals, P);
+        GrB_Index *dests = rm_malloc(sizeof(GrB_Index) * nvals);
+        GrB_Index *srcs = rm_malloc(sizeof(GrB_Index) * nvals);
+        uint64_t *edge_ids = rm_malloc(sizeof(uint64_t) * nvals);
+        GrB_Matrix_extractTuples_UINT64(dests, srcs, edge_ids, &nvals, P);
+
+        LabelStore *store = projection->relation_stores[i];
+        Graph_AllocateEdges(pg, nvals);
+        for(GrB_Index j = 0; j < nvals; j++) {
+            Edge src;
+            Edge edge;
+            Graph_GetEdge(gc->g, edge_ids[j], &src);
+            Graph_ConnectNodes(pg, srcs[j], dests[j], i, &edge);
+            _Project_CopyProperties((GraphEntity*)&src, (GraphEntity*)&edge, projection->relation_allstore, store);
+        }
+        edge_count += nvals;
+
+        rm_free(dests);
+        rm_free(srcs);
+        rm_free(edge_ids);
+        GrB_Matrix_free(&P);
+    }
+
+    // Indices over projected labels and relationship types are rebuilt.
+    for(int i = 0; i < gc->index_count; i++) {
+        Index *idx = gc->indices[i];
+        if(GraphContext_GetLabelID(projection, idx->label, idx->entity_type) == GRAPH_NO_LABEL) continue;
+        GraphContext_AddIndex(projection, idx->label, idx->property, idx->entity_type, idx->trigrams != NULL);
+    }
+
+    char *reply;
+    asprintf(&reply, "%llu Nodes projected, %zu Edges projected", (unsigned long long)node_count, edge_count);
+    RedisModule_ReplyWithStringBuffer(ctx, reply, strlen(reply));
+    free(reply);
+
+release:
+    rm_free(ids);
+    rm_free(node_labels);
+    rm_free(labels);
+    rm_free(relations);
+    Graph_ReleaseLock(gc->g);
+
+cleanup:
+    RedisModule_ThreadSafeContextUnlock(ctx);
+    _ProjectContext_Free(pCtx);
+    RedisModule_UnblockClient(bc, NULL);
+    RedisModule_FreeThreadSafeContext(ctx);
+}
+
+/* Projects a graph onto a new read-only graph, holding the nodes of the
+ * given labels and the edges of the given relationship types connecting them.
+ * Projected nodes are renumbered densely, such that the projection's matrices
+ * are sized by the projected node count. A projection is queried like any
+ * other graph, and dropped with GRAPH.DELETE.
+ * Args:
+ * argv[1] graph name
+ * argv[2] projection name
+ * argv[3...] LABELS <label ...> nodes projected, defaults to all nodes
+ *            RELATIONS <type ...> relationship types projected, defaults to all types */
+int MGraph_Project(RedisModuleCtx *ctx, RedisModuleString **argv, int argc) {
+    if (argc < 3) return RedisModule_WrongArity(ctx);
+
+    ProjectContext *pCtx = _ProjectContext_New(argv[1], argv[2]);
+    int *list_count = NULL;   // Length of the list currently parsed.
+    for(int i = 3; i < argc; i++) {
+        const char *arg = RedisModule_StringPtrLen(argv[i], NULL);
+        if(!strcasecmp(arg, "LABELS") && !pCtx->labels) {
+            pCtx->labels = argv + i + 1;
+            list_count = &pCtx->label_count;
+        } else if(!strcasecmp(arg, "RELATIONS") && !pCtx->relations) {
+            pCtx->relations = argv + i + 1;
+            list_count = &pCtx->relation_count;
+        } else if(list_count) {
+            (*list_count)++;
+        } else {
+            char *reply;
+            asprintf(&reply, "ERR Unknown projection argument %s.", arg);
+            RedisModule_ReplyWithError(ctx, reply);
+            free(reply);
+            _ProjectContext_Free(pCtx);
+            return REDISMODULE_OK;
+        }
+    }
+
+    // Projections are persisted, replicas build their own.
+    RedisModule_ReplicateVerbatim(ctx);
+
+    // Projection scans the entire graph, perform it on a worker thread.
+    pCtx->bc = RedisModule_BlockClient(ctx, NULL, NULL, NULL, 0);
+    thpool_add_work(_thpool, _MGraph_Project, pCtx);
+    return REDISMODULE_OK;
+}
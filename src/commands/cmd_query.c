@@ -8,21 +8,38 @@
 #include "cmd_query.h"
 #include "../graph/graph.h"
 #include "../query_executor.h"
+#include "../parser/parser_common.h"
 #include "../util/simple_timer.h"
 #include "../execution_plan/execution_plan.h"
 
-QueryContext* _queryContext_New(RedisModuleBlockedClient *bc, AST_Query* ast, RedisModuleString *graphName) {
+QueryContext* _queryContext_New(RedisModuleBlockedClient *bc, CachedQuery *query, bool readonly,
+                                RedisModuleString **argv, int argc) {
     QueryContext* context = malloc(sizeof(QueryContext));
     context->bc = bc;
-    context->ast = ast;
-    context->graphName = graphName;
+    context->query = query;
+    context->params = NULL;
+    context->graphName = argv[1];
+    context->queryStr = argv[2];
+    context->argv = argv + 3;
+    context->argc = argc - 3;
+    context->readonly = readonly;
     return context;
 }
 
 void _queryContext_Free(QueryContext* ctx) {
+    QueryCache_Release(ctx->query);
+    QueryParams_Free(ctx->params);
     free(ctx);
 }
 
+/* Indices are built on node labels, or on relationship types when
+ * no such label exists. */
+LabelStoreType _index_entity_type(GraphContext *gc, const char *label) {
+  if (GraphContext_GetLabelID(gc, label, STORE_NODE) == GRAPH_NO_LABEL &&
+      GraphContext_GetLabelID(gc, label, STORE_EDGE) != GRAPH_NO_RELATION) return STORE_EDGE;
+  return STORE_NODE;
+}
+
 void _index_operation(RedisModuleCtx *ctx, GraphContext *gc, AST_IndexNode *indexNode) {
   /* Set up nested array response for index creation and deletion.
    * As we need no result set, there is only one top-level element, for statistics.
@@ -31,13 +48,14 @@ void _index_operation(RedisModuleCtx *ctx, GraphContext *gc, AST_IndexNode *inde
   RedisModule_ReplyWithArray(ctx, 1);
   RedisModule_ReplyWithArray(ctx, 2);
 
+  LabelStoreType t = _index_entity_type(gc, indexNode->label);
   switch(indexNode->operation) {
     case CREATE_INDEX:
-      if (GraphContext_GetIndex(gc, indexNode->label, indexNode->property)) {
+      if (GraphContext_GetIndex(gc, indexNode->label, indexNode->property, t)) {
         // Index already exists on label-property pair.
         RedisModule_ReplyWithSimpleString(ctx, "(no changes, no records)");
       } else {
-        if (GraphContext_AddIndex(gc, indexNode->label, indexNode->property) != INDEX_OK) {
+        if (GraphContext_AddIndex(gc, indexNode->label, indexNode->property, t, indexNode->trigrams) != INDEX_OK) {
           // Index creation may have failed if the specified label or property was invalid.
           RedisModule_ReplyWithSimpleString(ctx, "(no changes, no records)");
           break;
@@ -46,7 +64,7 @@ void _index_operation(RedisModuleCtx *ctx, GraphContext *gc, AST_IndexNode *inde
       }
       break;
     case DROP_INDEX:
-      if (GraphContext_DeleteIndex(gc, indexNode->label, indexNode->property) == INDEX_OK) {
+      if (GraphContext_DeleteIndex(gc, indexNode->label, indexNode->property, t) == INDEX_OK) {
         RedisModule_ReplyWithSimpleString(ctx, "Removed 1 index.");
       } else {
         char *reply;
@@ -60,13 +78,45 @@ void _index_operation(RedisModuleCtx *ctx, GraphContext *gc, AST_IndexNode *inde
   }
 }
 
+/* Parses query parameters and query text, unless an AST was retrieved from cache.
+ * On failure an error is replied and 0 returned. */
+int _queryContext_Parse(RedisModuleCtx *ctx, QueryContext *qctx) {
+    char *errMsg = NULL;
+    qctx->params = QueryParams_Parse(qctx->argv, qctx->argc, &errMsg);
+    if (!qctx->params) {
+        RedisModule_ReplyWithError(ctx, errMsg);
+        free(errMsg);
+        return 0;
+    }
+
+    if (qctx->query) return 1;
+
+    size_t queryLen;
+    const char *graphName = RedisModule_StringPtrLen(qctx->graphName, NULL);
+    const char *queryStr = RedisModule_StringPtrLen(qctx->queryStr, &queryLen);
+    AST_Query* ast = ParseQuery(queryStr, queryLen, &errMsg);
+    if (!ast) {
+        RedisModule_Log(ctx, "debug", "Error parsing query: %s", errMsg);
+        RedisModule_ReplyWithError(ctx, errMsg);
+        free(errMsg);
+        return 0;
+    }
+    qctx->query = CachedQuery_New(graphName, queryStr, ast);
+    return 1;
+}
+
 void _MGraph_Query(void *args) {
     QueryContext *qctx = (QueryContext*)args;
     RedisModuleCtx *ctx = RedisModule_GetThreadSafeContext(qctx->bc);
-    AST_Query* ast = qctx->ast;
     ResultSet* resultSet = NULL;
+    bool readonly = qctx->readonly;
+
+    // Parsing is done prior to acquiring any lock.
+    if (!_queryContext_Parse(ctx, qctx)) goto unblock;
+
+    CachedQuery *query = qctx->query;
+    AST_Query* ast = query->ast;
 
-    bool readonly = AST_ReadOnly(ast);
     // If the query modifies the keyspace, acquire the Redis global lock
     if (!readonly) RedisModule_ThreadSafeContextLock(ctx);
 
@@ -84,15 +134,20 @@ void _MGraph_Query(void *args) {
             goto cleanup;
         }
         /* TODO: free graph if no entities were created. */
+    } else if (!readonly && gc->read_only) {
+        // Projections can only be queried.
+        RedisModule_ReplyWithError(ctx, "ERR Graph is a read-only projection.");
+        gc = NULL;
+        goto cleanup;
     }
     // Acquire the appropriate lock.
     (readonly) ? Graph_AcquireReadLock(gc->g) : Graph_AcquireWriteLock(gc->g);
+    GraphContext_SetTLS(gc);
 
-    // Perform query validations before and after ModifyAST
-    if (AST_PerformValidations(ctx, ast) != AST_VALID) goto cleanup;
-
-    ModifyAST(gc, ast);
-    if (AST_PerformValidations(ctx, ast) != AST_VALID) goto cleanup;
+    // Validate and modify AST, unless it was already prepared by a previous query.
+    if (CachedQuery_Prepare(ctx, query, gc) != AST_VALID) goto cleanup;
+    ast = query->ast;
+    if (!CachedQuery_Bind(ctx, query, qctx->params)) goto cleanup;
 
     if (ast->indexNode) { // index operation
         _index_operation(ctx, gc, ast->indexNode);
@@ -113,10 +168,11 @@ void _MGraph_Query(void *args) {
     // Clean up.
 cleanup:
     // Release the read-write lock
+    GraphContext_SetTLS(NULL);
     if (gc) Graph_ReleaseLock(gc->g);
     // Release Redis global lock if it was acquired
     if (!readonly) RedisModule_ThreadSafeContextUnlock(ctx);
-    Free_AST_Query(ast);
+unblock:
     ResultSet_Free(resultSet);
     RedisModule_UnblockClient(qctx->bc, NULL);
     RedisModule_FreeThreadSafeContext(ctx);
@@ -126,32 +182,28 @@ cleanup:
 /* Queries graph
  * Args:
  * argv[1] graph name
- * argv[2] query to execute */
+ * argv[2] query to execute
+ * argv[3...] query parameters, name value pairs
+ * Parsing, validation and execution are all done by a worker thread. */
 int MGraph_Query(RedisModuleCtx *ctx, RedisModuleString **argv, int argc) {
     double tic[2];
     if (argc < 3) return RedisModule_WrongArity(ctx);
 
     simple_tic(tic);
 
-    // Parse AST.
-    // TODO: support concurrent parsing.
-    char *errMsg = NULL;
-    const char *query = RedisModule_StringPtrLen(argv[2], NULL);
-    AST_Query* ast = ParseQuery(query, strlen(query), &errMsg);
-    if (!ast) {
-        RedisModule_Log(ctx, "debug", "Error parsing query: %s", errMsg);
-        RedisModule_ReplyWithError(ctx, errMsg);
-        free(errMsg);
-        return REDISMODULE_OK;
-    }
-
-    bool readonly = AST_ReadOnly(ast);
+    /* Reuse a previously parsed AST, otherwise query is parsed by the worker,
+     * a scan of query tokens determines whether query is read only. */
+    size_t queryLen;
+    const char *graphName = RedisModule_StringPtrLen(argv[1], NULL);
+    const char *queryStr = RedisModule_StringPtrLen(argv[2], &queryLen);
+    CachedQuery *query = QueryCache_Checkout(graphName, queryStr);
+    bool readonly = (query) ? AST_ReadOnly(query->ast) : Query_ReadOnly(queryStr, queryLen);
 
     // Construct concurent query context.
     RedisModuleBlockedClient *bc =
         RedisModule_BlockClient(ctx, NULL, NULL, NULL, 0);
 
-    QueryContext *context = _queryContext_New(bc, ast, argv[1]);
+    QueryContext *context = _queryContext_New(bc, query, readonly, argv, argc);
 
     context->tic[0] = tic[0];
     context->tic[1] = tic[1];    
@@ -11,6 +11,8 @@
 #define REDISMODULE_EXPERIMENTAL_API    // Required for block client.
 #include "../redismodule.h"
 #include "../parser/ast.h"
+#include "../query_cache.h"
+#include "../query_params.h"
 #include "../util/thpool/thpool.h"
 
 extern threadpool _thpool;
@@ -18,8 +20,13 @@ extern threadpool _thpool;
 /* Query context, used for concurent query processing. */
 typedef struct {
     RedisModuleBlockedClient *bc;   // Blocked client.
-    AST_Query* ast;                 // Parsed AST.
+    CachedQuery *query;             // Parsed AST, NULL until query is parsed.
+    QueryParam *params;             // Query parameters.
     RedisModuleString *graphName;   // Graph ID.
+    RedisModuleString *queryStr;    // Query text.
+    RedisModuleString **argv;       // Query parameters, unparsed.
+    int argc;                       // Number of unparsed query parameters.
+    bool readonly;                  // Query doesn't modify the graph.
     double tic[2];                  // timings.
 } QueryContext;
 
@@ -13,3 +13,7 @@
 #include "cmd_delete.h"
 #include "cmd_explain.h"
 #include "cmd_bulk_insert.h"
+#include "cmd_info.h"
+#include "cmd_analyze.h"
+#include "cmd_algo.h"
+#include "cmd_project.h"
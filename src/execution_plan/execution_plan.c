@@ -205,8 +205,23 @@ void ExecutionPlan_AddOp(OpBase *parent, OpBase *newOp) {
 }
 
 void ExecutionPlan_ReplaceOp(OpBase *a, OpBase *b) {
-    _OpBase_PushAbove(a->parent, b);
-    ExecutionPlan_RemoveOp(a);
+    assert(a->parent && !(b->parent || b->children));
+
+    /* B takes A's position among its parent's children,
+     * leaving A's siblings in place. */
+    OpBase *parent = a->parent;
+    int i = 0;
+    while(parent->children[i] != a) i++;
+    parent->children[i] = b;
+    b->parent = parent;
+    a->parent = NULL;
+
+    /* Move each child of A to B. */
+    while(a->childCount) {
+        OpBase *child = a->children[0];
+        _OpBase_RemoveChild(a, child);
+        _OpBase_AddChild(b, child);
+    }
 }
 
 void ExecutionPlan_RemoveOp(OpBase *op) {
@@ -222,6 +237,11 @@ void ExecutionPlan_RemoveOp(OpBase *op) {
     }
 }
 
+void ExecutionPlan_DetachOp(OpBase *op) {
+    assert(op->parent != NULL);
+    _OpBase_RemoveChild(op->parent, op);
+}
+
 OpBase* ExecutionPlan_Locate_References(OpBase *root, Vector *references) {
     OpBase *op = NULL;    
     Vector *temp = _ExecutionPlan_Locate_References(root, &op, references);
@@ -283,64 +303,51 @@ ExecutionPlan* NewExecutionPlan(RedisModuleCtx *ctx,
                 size_t expCount = 0;
                 AlgebraicExpression **exps = AlgebraicExpression_From_Query(ast, pattern, q, &expCount);
 
-                TRAVERSE_ORDER order = determineTraverseOrder(filter_tree, exps, expCount);
-                if(order == TRAVERSE_ORDER_FIRST) {
-                    AlgebraicExpression *exp = exps[0];
-                    selectEntryPoint(exp, filter_tree);
+                orderTraversal(gc, filter_tree, exps, expCount);
+                AlgebraicExpression *exp = exps[0];
 
-                    // Create SCAN operation.
-                    if(exp->src_node->label) {
-                        /* There's no longer need for the last matrix operand
-                         * as it's been replaced by label scan. */
+                // Create SCAN operation.
+                if(exp->src_node->label) {
+                    /* There's no longer need for the source label matrix operand
+                     * as it's been replaced by label scan. */
+                    if(exp->operand_count > 0 &&
+                       exp->operands[exp->operand_count-1].operand == exp->src_node->mat) {
                         AlgebraicExpression_RemoveTerm(exp, exp->operand_count-1, NULL);
-                        op = NewNodeByLabelScanOp(gc, exp->src_node);
-                        Vector_Push(traversals, op);
-                    } else {
-                        op = NewAllNodeScanOp(g, exp->src_node);
-                        Vector_Push(traversals, op);
-                    }
-                    for(int i = 0; i < expCount; i++) {
-                        if(exps[i]->operand_count == 0) continue;
-                        if(exps[i]->edgeLength) {
-                            op = NewCondVarLenTraverseOp(exps[i],
-                                                         exps[i]->edgeLength->minHops,
-                                                         exps[i]->edgeLength->maxHops,
-                                                         g);
-                        }
-                        else {
-                            op = NewCondTraverseOp(g, exps[i]);
-                        }
-                        Vector_Push(traversals, op);
                     }
+                    op = NewNodeByLabelScanOp(gc, exp->src_node);
+                    Vector_Push(traversals, op);
                 } else {
-                    AlgebraicExpression *exp = exps[expCount-1];
-                    selectEntryPoint(exp, filter_tree);
-                    // Create SCAN operation.
-                    if(exp->dest_node->label) {
-                        /* There's no longer need for the last matrix operand
-                         * as it's been replaced by label scan. */
-                        AlgebraicExpression_RemoveTerm(exp, exp->operand_count-1, NULL);
-                        op = NewNodeByLabelScanOp(gc, exp->dest_node);
-                        Vector_Push(traversals, op);
-                    } else {
-                        op = NewAllNodeScanOp(g, exp->dest_node);
-                        Vector_Push(traversals, op);
+                    op = NewAllNodeScanOp(g, exp->src_node);
+                    Vector_Push(traversals, op);
+                }
+                // Nodes resolved by preceding operations.
+                Node *resolved[expCount + 1];
+                int resolvedCount = 0;
+                resolved[resolvedCount++] = exp->src_node;
+
+                for(int i = 0; i < expCount; i++) {
+                    if(exps[i]->operand_count == 0) continue;
+
+                    bool destResolved = false;
+                    for(int j = 0; j < resolvedCount; j++) {
+                        if(resolved[j] == exps[i]->dest_node) destResolved = true;
                     }
 
-                    for(int i = expCount-1; i >= 0; i--) {
-                        if(exps[i]->operand_count == 0) continue;
-                        AlgebraicExpression_Transpose(exps[i]);
-                        if(exps[i]->edgeLength) {
-                            op = NewCondVarLenTraverseOp(exps[i],
-                                                         exps[i]->edgeLength->minHops,
-                                                         exps[i]->edgeLength->maxHops,
-                                                         g);
-                        }
-                        else {
-                            op = NewCondTraverseOp(g, exps[i]);
-                        }
-                        Vector_Push(traversals, op);
+                    if(destResolved && !exps[i]->edgeLength) {
+                        /* Both ends are resolved, e.g. a cycle closing on a previously
+                         * visited node, check connectivity rather than expand. */
+                        op = NewExpandIntoOp(g, exps[i]);
+                    } else if(exps[i]->edgeLength) {
+                        op = NewCondVarLenTraverseOp(exps[i],
+                                                     exps[i]->edgeLength->minHops,
+                                                     exps[i]->edgeLength->maxHops,
+                                                     g);
+                    }
+                    else {
+                        op = NewCondTraverseOp(g, exps[i]);
                     }
+                    Vector_Push(traversals, op);
+                    if(!destResolved) resolved[resolvedCount++] = exps[i]->dest_node;
                 }
             } else {
                 /* Node scan. */
@@ -390,7 +397,7 @@ ExecutionPlan* NewExecutionPlan(RedisModuleCtx *ctx,
     }
 
     if(ast->deleteNode) {
-        OpBase *opDelete = NewDeleteOp(ast->deleteNode, q, g, execution_plan->result_set);
+        OpBase *opDelete = NewDeleteOp(ast->deleteNode, q, gc, execution_plan->result_set);
         Vector_Push(ops, opDelete);
     }
 
@@ -458,7 +465,7 @@ ExecutionPlan* NewExecutionPlan(RedisModuleCtx *ctx,
 
 void _ExecutionPlanPrint(const OpBase *op, char **strPlan, int ident) {
     char strOp[512] = {0};
-    sprintf(strOp, "%*s%s\n", ident, "", op->name);
+    sprintf(strOp, "%*s%s | Estimated records: %.2f\n", ident, "", op->name, op->cardinality);
     
     if(*strPlan == NULL) {
         *strPlan = calloc(strlen(strOp) + 1, sizeof(char));
@@ -45,12 +45,19 @@ char* ExecutionPlanPrint(const ExecutionPlan *plan);
 /* Removes operation from execution plan. */
 void ExecutionPlan_RemoveOp(OpBase *op);
 
+/* Disconnects operation, along with its children, from its parent. */
+void ExecutionPlan_DetachOp(OpBase *op);
+
 /* Adds operation to execution plan as a child of parent. */
 void ExecutionPlan_AddOp(OpBase *parent, OpBase *newOp);
 
 /* Replace a with b. */
 void ExecutionPlan_ReplaceOp(OpBase *a, OpBase *b);
 
+/* Locates the earliest operation along the plan rooted at root,
+ * at which all references are resolved, NULL if there's no such operation. */
+OpBase* ExecutionPlan_Locate_References(OpBase *root, Vector *references);
+
 /* Executes plan */
 ResultSet* ExecutionPlan_Execute(ExecutionPlan *plan);
 
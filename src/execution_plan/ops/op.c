@@ -12,6 +12,7 @@ void OpBase_Init(OpBase *op) {
     op->childCount = 0;
     op->children = NULL;
     op->parent = NULL;
+    op->cardinality = 0;
 }
 
 void OpBase_Free(OpBase *op) {
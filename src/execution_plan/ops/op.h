@@ -27,12 +27,15 @@ OPType_CONDITIONAL_VAR_LEN_TRAVERSE,
 OPType_FILTER,
 OPType_NODE_BY_LABEL_SCAN,
 OPType_INDEX_SCAN,
+OPType_EDGE_INDEX_SCAN,
 OPType_PRODUCE_RESULTS,
 OPType_CREATE,
 OPType_UPDATE,
 OPType_DELETE,
 OPType_CARTESIAN_PRODUCT,
-OPType_MERGE
+OPType_MERGE,
+OPType_HASH_JOIN,
+OPType_EXPAND_INTO
 } OPType;
 
 typedef enum {
@@ -57,6 +60,7 @@ struct OpBase {
     struct OpBase **children;   // Child operations.
     int childCount;             // Number of children.
     struct OpBase *parent;      // Parent operations.
+    double cardinality;         // Estimated number of records produced.
 };
 typedef struct OpBase OpBase;
 
@@ -7,6 +7,7 @@
 
 #include "op_aggregate.h"
 #include "../../arithmetic/aggregate.h"
+#include "../../arithmetic/agg_funcs.h"
 #include "../../grouping/group.h"
 #include "../../grouping/group_cache.h"
 #include "../../query_executor.h"
@@ -19,6 +20,10 @@ OpBase* NewAggregateOp(AST_Query *ast, TrieMap *groups) {
     aggregate->none_aggregated_expressions = NULL;
     aggregate->group_keys = NULL;
     aggregate->groups = groups;
+    aggregate->g = NULL;
+    aggregate->count_expression = NULL;
+    aggregate->count_group_node = NULL;
+    aggregate->count_entities = false;
 
     OpBase_Init(&aggregate->op);
     aggregate->op.name = "Aggregate";
@@ -67,8 +72,8 @@ char* _computeGroupKey(Aggregate *op, SIValue *group_keys, Record r) {
     return str_group;
 }
 
-void _aggregateRecord(Aggregate *op, Record r) {
-    /* Get group */
+/* Retrieves record's group, creates group if missing. */
+Group* _getGroup(Aggregate *op, Record r) {
     Group* group = NULL;
     char *group_key = _computeGroupKey(op, op->group_keys, r);
     CacheGroupGet(op->groups, group_key, &group);
@@ -88,7 +93,13 @@ void _aggregateRecord(Aggregate *op, Record r) {
         group = NewGroup(key_count, group_keys, agg_exps);
         CacheGroupAdd(op->groups, group_key, group);
     }
-    
+
+    return group;
+}
+
+void _aggregateRecord(Aggregate *op, Record r) {
+    Group *group = _getGroup(op, r);
+
     // Aggregate group expressions.
     for(int i = 0; i < Vector_Size(group->aggregationFunctions); i++) {
         AR_ExpNode *exp;
@@ -97,9 +108,112 @@ void _aggregateRecord(Aggregate *op, Record r) {
     }
 }
 
+// Adds count to each of the group's count functions.
+void _aggregateCount(Aggregate *op, Record r, size_t count) {
+    Group *group = _getGroup(op, r);
+
+    for(int i = 0; i < Vector_Size(group->aggregationFunctions); i++) {
+        AR_ExpNode *exp;
+        Vector_Get(group->aggregationFunctions, i, &exp);
+        Agg_CountAdd(exp->op.agg_func, count);
+    }
+}
+
+/* Counts entries of the count expression, each entry corresponds
+ * to a record which would have been produced by traversal. */
+void _aggregateCountExpression(Aggregate *op) {
+    Record r = Record_Empty();
+    AlgebraicExpressionResult *res = AlgebraicExpression_Execute(op->count_expression);
+    GrB_Matrix M = res->m;
+
+    if(op->count_group_node == NULL) {
+        GrB_Index nvals;
+        GrB_Matrix_nvals(&nvals, M);
+        // Empty pattern produces no groups.
+        if(nvals > 0) _aggregateCount(op, r, nvals);
+    } else {
+        /* M[dest, src], reduce each row to count by destination,
+         * reduce each column to count by source. */
+        Node *n = op->count_group_node;
+        GrB_Index nrows;
+        GrB_Index ncols;
+        GrB_Matrix_nrows(&nrows, M);
+        GrB_Matrix_ncols(&ncols, M);
+
+        GrB_Descriptor desc = NULL;
+        GrB_Index dim = nrows;
+        if(n == op->count_expression->src_node) {
+            GrB_Descriptor_new(&desc);
+            GrB_Descriptor_set(desc, GrB_INP0, GrB_TRAN);
+            dim = ncols;
+        }
+
+        /* Entries may hold edge IDs, zero included,
+         * count structure rather than values. */
+        GrB_Matrix ones;
+        GrB_Matrix_new(&ones, GrB_UINT64, nrows, ncols);
+        GrB_apply(ones, NULL, NULL, GxB_ONE_UINT64, M, NULL);
+
+        GrB_Vector counts;
+        GrB_Vector_new(&counts, GrB_UINT64, dim);
+        GrB_Matrix_reduce_Monoid(counts, NULL, NULL, GxB_PLUS_UINT64_MONOID, ones, desc);
+        GrB_Matrix_free(&ones);
+
+        GrB_Index nvals;
+        GrB_Vector_nvals(&nvals, counts);
+        GrB_Index *ids = malloc(sizeof(GrB_Index) * nvals);
+        uint64_t *values = malloc(sizeof(uint64_t) * nvals);
+        GrB_Vector_extractTuples_UINT64(ids, values, &nvals, counts);
+
+        Record_AddEntry(&r, n->alias, SI_PtrVal(n));
+        for(GrB_Index i = 0; i < nvals; i++) {
+            Graph_GetNode(op->g, ids[i], n);
+            _aggregateCount(op, r, values[i]);
+        }
+
+        free(ids);
+        free(values);
+        GrB_Vector_free(&counts);
+        if(desc) GrB_Descriptor_free(&desc);
+    }
+
+    AlgebraicExpressionResult_Free(res);
+    Record_Free(r);
+}
+
+void Aggregate_SetCountExpression(Aggregate *op, Graph *g, AlgebraicExpression *exp, Node *group_node) {
+    op->g = g;
+    op->count_expression = exp;
+    op->count_group_node = group_node;
+    op->op.name = "Count";
+}
+
+// Reads counted entities from graph, all of which belong to a single group.
+void _aggregateEntityCount(Aggregate *op) {
+    size_t count;
+    if(op->count_entity_type == STORE_NODE) {
+        count = Graph_LabeledNodeCount(op->g, op->count_entity_schema);
+    } else {
+        count = Graph_RelationEdgeCount(op->g, op->count_entity_schema);
+    }
+
+    // Empty pattern produces no groups.
+    if(count == 0) return;
+    Record r = Record_Empty();
+    _aggregateCount(op, r, count);
+    Record_Free(r);
+}
+
+void Aggregate_SetEntityCount(Aggregate *op, Graph *g, LabelStoreType t, int schema) {
+    op->g = g;
+    op->count_entities = true;
+    op->count_entity_type = t;
+    op->count_entity_schema = schema;
+    op->op.name = "Count";
+}
+
 OpResult AggregateConsume(OpBase *opBase, Record *r) {
     Aggregate *op = (Aggregate*)opBase;
-    OpBase *child = op->op.children[0];
 
     if(!op->init) {
         Build_None_Aggregated_Arithmetic_Expressions(op->ast->returnNode,
@@ -110,8 +224,14 @@ OpResult AggregateConsume(OpBase *opBase, Record *r) {
             op->group_keys = malloc(sizeof(SIValue) * op->none_aggregated_expression_count);
         }
         op->init = 1;
+        if(op->count_expression) _aggregateCountExpression(op);
+        else if(op->count_entities) _aggregateEntityCount(op);
     }
 
+    // Counts are computed at once.
+    if(op->count_expression || op->count_entities) return OP_DEPLETED;
+
+    OpBase *child = op->op.children[0];
     OpResult res = child->consume(child, r);
     if(res != OP_OK) return res;
 
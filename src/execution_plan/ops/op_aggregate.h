@@ -12,7 +12,9 @@
 #include "../../parser/ast.h"
 #include "../../redismodule.h"
 #include "../../graph/query_graph.h"
+#include "../../stores/store.h"
 #include "../../arithmetic/arithmetic_expression.h"
+#include "../../arithmetic/algebraic_expression.h"
 
 /* Aggregate
  * aggregates graph according to  
@@ -25,9 +27,25 @@
      SIValue *group_keys;   /* Array of values composing an aggregated group. */
      TrieMap *groups;
      int init;
+     Graph *g;
+     AlgebraicExpression *count_expression; /* Counted pattern, replaces child operations. */
+     Node *count_group_node;                /* Node counts are grouped by, NULL for a single group. */
+     bool count_entities;                   /* Count is read from graph's entity counters. */
+     LabelStoreType count_entity_type;      /* Counting nodes or edges. */
+     int count_entity_schema;               /* Counted label or relation type ID. */
  } Aggregate;
 
 OpBase* NewAggregateOp(AST_Query *ast, TrieMap *groups);
+
+/* Evaluates the aggregation by counting entries of exp, rather than
+ * aggregating records produced by child operations.
+ * Each aggregated return term must be a count of either pattern end,
+ * when group_node is specified, grouping terms must only refer to it. */
+void Aggregate_SetCountExpression(Aggregate *op, Graph *g, AlgebraicExpression *exp, Node *group_node);
+/* Evaluates the aggregation by reading the number of nodes of given label,
+ * or the number of edges of given relation type, maintained by the graph.
+ * Aggregation must consist of a single count term without grouping terms. */
+void Aggregate_SetEntityCount(Aggregate *op, Graph *g, LabelStoreType t, int schema);
 OpResult AggregateConsume(OpBase *opBase, Record *r);
 OpResult AggregateReset(OpBase *opBase);
 void AggregateFree(OpBase *opBase);
@@ -82,8 +82,9 @@ OpResult CondVarLenTraverseReset(OpBase *ctx) {
     CondVarLenTraverse *op = (CondVarLenTraverse*)ctx;
     for(int i = 0; i < op->pathsCount; i++) Path_free(op->paths[i]);
     op->pathsCount = 0;
-    // TODO: I think Reset should propegate to child nodes.
-    return OP_OK;
+
+    OpBase *child = op->op.children[0];
+    return child->reset(child);
 }
 
 void CondVarLenTraverseFree(OpBase *ctx) {
@@ -23,6 +23,67 @@ OpResult _CondTraverse_SetEdge(CondTraverse *op, Record *r) {
     return OP_OK;
 }
 
+// Updates query graph edge, using the edge ID carried by the traversal result.
+void _CondTraverse_SetEdgeByID(CondTraverse *op, EdgeID id) {
+    Edge *e = op->algebraic_expression->edge;
+    Graph_GetEdge(op->graph, id, e);
+    e->srcNodeID = ENTITY_GET_ID(e->src);
+    e->destNodeID = ENTITY_GET_ID(e->dest);
+}
+
+/* Closing expression is evaluated against its resolved node, replace
+ * transposed operands by their transpose, such that evaluation extracts
+ * columns rather than scanning entire matrices. */
+static void _CondTraverse_MaterializeClosing(CondTraverse *op) {
+    AlgebraicExpression *closing = op->closing_expression;
+    for(int i = 0; i < closing->operand_count; i++) {
+        AlgebraicExpressionOperand *operand = closing->operands + i;
+        if(!operand->transpose) continue;
+
+        // Label matrices are diagonal.
+        if(operand->operand == closing->src_node->mat || operand->operand == closing->dest_node->mat) {
+            operand->transpose = false;
+            continue;
+        }
+
+        GrB_Type t;
+        GrB_Index nrows;
+        GrB_Index ncols;
+        GrB_Matrix transposed;
+        GxB_Matrix_type(&t, operand->operand);
+        GrB_Matrix_nrows(&nrows, operand->operand);
+        GrB_Matrix_ncols(&ncols, operand->operand);
+        GrB_Matrix_new(&transposed, t, ncols, nrows);
+        GrB_transpose(transposed, NULL, NULL, operand->operand, NULL);
+
+        operand->operand = transposed;
+        operand->transpose = false;
+        operand->free = true;
+    }
+
+    GrB_Matrix_new(&op->closing_F, GrB_BOOL, Graph_RequiredMatrixDim(op->graph), 1);
+}
+
+// Intersects reachable destinations with nodes closing the pattern.
+static void _CondTraverse_ApplyClosingMask(CondTraverse *op, const Record r) {
+    AlgebraicExpression *closing = op->closing_expression;
+    if(op->closing_F == NULL) _CondTraverse_MaterializeClosing(op);
+
+    Node *n = Record_GetNode(r, closing->src_node->alias);
+    NodeID id = ENTITY_GET_ID(n);
+    GrB_Matrix_setElement_BOOL(op->closing_F, true, id, 0);
+
+    AlgebraicExpression_AppendTerm(closing, op->closing_F, false, false);
+    AlgebraicExpressionResult *mask = AlgebraicExpression_Execute(closing);
+    AlgebraicExpression_RemoveTerm(closing, closing->operand_count-1, NULL);
+    GxB_Matrix_Delete(op->closing_F, id, 0);
+
+    // Keep reachable entries, edge IDs included.
+    GrB_BinaryOp first = (op->algebraic_results->edge_ids) ? GrB_FIRST_UINT64 : GrB_FIRST_BOOL;
+    GrB_eWiseMult_Matrix_BinaryOp(op->M, NULL, NULL, first, op->M, mask->m, NULL);
+    AlgebraicExpressionResult_Free(mask);
+}
+
 void _extractColumn(CondTraverse *op, const Record r) {
     Node *n = Record_GetNode(r, op->algebraic_expression->src_node->alias);
     NodeID srcId = ENTITY_GET_ID(n);
@@ -38,6 +99,7 @@ void _extractColumn(CondTraverse *op, const Record r) {
     op->M = op->algebraic_results->m;
     // Remove operand.
     AlgebraicExpression_RemoveTerm(op->algebraic_expression, op->algebraic_expression->operand_count-1, NULL);
+    if(op->closing_expression) _CondTraverse_ApplyClosingMask(op, r);
 
     if(op->iter == NULL) op->iter = TuplesIter_new(op->M);
     else TuplesIter_reuse(op->iter, op->M);
@@ -46,6 +108,11 @@ void _extractColumn(CondTraverse *op, const Record r) {
     GxB_Matrix_Delete(op->F, srcId, 0);
 }
 
+static inline TuplesIter_Info _CondTraverse_NextTuple(CondTraverse *op, NodeID *dest_id, EdgeID *edge_id) {
+    if(op->algebraic_results->edge_ids) return TuplesIter_next_UINT64(op->iter, dest_id, NULL, edge_id);
+    return TuplesIter_next(op->iter, dest_id, NULL);
+}
+
 OpBase* NewCondTraverseOp(Graph *g, AlgebraicExpression *algebraic_expression) {
     CondTraverse *traverse = calloc(1, sizeof(CondTraverse));
     traverse->graph = g;
@@ -53,6 +120,8 @@ OpBase* NewCondTraverseOp(Graph *g, AlgebraicExpression *algebraic_expression) {
     traverse->algebraic_results = NULL;
     traverse->iter = NULL;
     traverse->edges = NULL;
+    traverse->closing_expression = NULL;
+    traverse->closing_F = NULL;
     
     // Set our Op operations
     OpBase_Init(&traverse->op);
@@ -77,6 +146,14 @@ OpBase* NewCondTraverseOp(Graph *g, AlgebraicExpression *algebraic_expression) {
     return (OpBase*)traverse;
 }
 
+void CondTraverse_SetClosingExpression(CondTraverse *op, AlgebraicExpression *closing) {
+    // Evaluate closing expression from its resolved node.
+    AlgebraicExpression_Transpose(closing);
+    op->closing_expression = closing;
+    op->closing_F = NULL;
+    op->op.name = "Conditional Traverse Into";
+}
+
 /* CondTraverseConsume next operation 
  * each call will update the graph
  * returns OP_DEPLETED when no additional updates are available */
@@ -88,7 +165,7 @@ OpResult CondTraverseConsume(OpBase *opBase, Record *r) {
     if(op->iter == NULL) {
         if(child->consume(child, r) == OP_DEPLETED) return OP_DEPLETED;
 
-        GrB_Matrix_new(&op->F, GrB_BOOL, Graph_RequiredMatrixDim(op->graph), 1);
+        if(op->F == NULL) GrB_Matrix_new(&op->F, GrB_BOOL, Graph_RequiredMatrixDim(op->graph), 1);
 
         /* Pick a column. */
         _extractColumn(op, *r);
@@ -111,7 +188,8 @@ OpResult CondTraverseConsume(OpBase *opBase, Record *r) {
     }
     
     NodeID dest_id;
-    while(TuplesIter_next(op->iter, &dest_id, NULL) == TuplesIter_DEPLETED) {
+    EdgeID edge_id;
+    while(_CondTraverse_NextTuple(op, &dest_id, &edge_id) == TuplesIter_DEPLETED) {
         OpResult res = child->consume(child, r);
         if(res != OP_OK) return res;
         _extractColumn(op, *r);
@@ -120,6 +198,12 @@ OpResult CondTraverseConsume(OpBase *opBase, Record *r) {
     /* Get node from current column. */
     Graph_GetNode(op->graph, dest_id, op->algebraic_expression->dest_node);
 
+    /* Result entries hold edge IDs, no need to look edge up. */
+    if(op->algebraic_results->edge_ids) {
+        _CondTraverse_SetEdgeByID(op, edge_id);
+        return OP_OK;
+    }
+
     if(op->algebraic_expression->edge != NULL) {
         // We're guarantee to have at least one edge.
         Node *srcNode;
@@ -147,8 +231,15 @@ OpResult CondTraverseConsume(OpBase *opBase, Record *r) {
 OpResult CondTraverseReset(OpBase *ctx) {
     CondTraverse *op = (CondTraverse*)ctx;
     if(op->edges) array_clear(op->edges);
-    TuplesIter_reset(op->iter);
-    return OP_OK;
+
+    // Next call to consume will pull a new source node from child.
+    if(op->iter) {
+        TuplesIter_free(op->iter);
+        op->iter = NULL;
+    }
+
+    OpBase *child = op->op.children[0];
+    return child->reset(child);
 }
 
 /* Frees CondTraverse */
@@ -156,6 +247,17 @@ void CondTraverseFree(OpBase *ctx) {
     CondTraverse *op = (CondTraverse*)ctx;
     if(op->iter) TuplesIter_free(op->iter);
     if(op->F) GrB_Matrix_free(&op->F);
+    if(op->closing_F) GrB_Matrix_free(&op->closing_F);
+    if(op->closing_expression) {
+        // Free materialized transposes.
+        AlgebraicExpression *closing = op->closing_expression;
+        for(int i = 0; i < closing->operand_count; i++) {
+            if(closing->operands[i].free) {
+                GrB_Matrix_free(&closing->operands[i].operand);
+                closing->operands[i].free = false;
+            }
+        }
+    }
     if(op->edges) array_free(op->edges);
     if(op->algebraic_results) AlgebraicExpressionResult_Free(op->algebraic_results);
 }
@@ -25,11 +25,19 @@ typedef struct {
     int edgeRelationType;
     Edge *edges;
     TuplesIter *iter;
+    AlgebraicExpression *closing_expression;    // Masks reachable destinations, optional.
+    GrB_Matrix closing_F;                       // Filter vector, marks closing node.
 } CondTraverse;
 
 /* Creates a new Traverse operation */
 OpBase* NewCondTraverseOp(Graph *g, AlgebraicExpression *algebraic_expression);
 
+/* Restricts traversal to destinations from which closing expression
+ * reaches its destination node, which is resolved prior to traversal,
+ * e.g. traversing (b)->(c) in the cycle (a)->(b)->(c)->(a), closing
+ * expression (c)->(a) limits c to a's in-neighbors. */
+void CondTraverse_SetClosingExpression(CondTraverse *op, AlgebraicExpression *closing);
+
 /* TraverseConsume next operation 
  * each call will update the graph
  * returns OP_DEPLETED when no additional updates are available */
@@ -170,16 +170,20 @@ static void _CommitNodes(OpCreate *op) {
                     Vector_Get(entity->properties, prop_idx, &key);
                     Vector_Get(entity->properties, prop_idx+1, &value);
 
-                    values[prop_idx/2] = *value;
+                    // Entities keep a copy, AST values outlive this query and may be bound parameters.
+                    values[prop_idx/2] = SI_Clone(*value);
                     keys[prop_idx/2] = key->stringval;
                 }
 
                 GraphEntity_Add_Properties((GraphEntity*)n, propCount/2, keys, values);
-                if(store) LabelStore_UpdateSchema(store, propCount/2, keys);
-                LabelStore_UpdateSchema(allStore, propCount/2, keys);
+                int added = LabelStore_UpdateSchema(allStore, propCount/2, keys);
+                if(store) added += LabelStore_UpdateSchema(store, propCount/2, keys);
+                if(added) GraphContext_UpdateSchemaVersion(op->gc);
                 op->result_set->stats.properties_set += propCount/2;
             }
         }
+
+        GraphContext_IndexNode(op->gc, n->label, n);
     }
 
     TrieMap_Free(createEntities, TrieMap_NOP_CB);
@@ -231,16 +235,20 @@ static void _CommitEdges(OpCreate *op) {
                     Vector_Get(entity->properties, prop_idx, &key);
                     Vector_Get(entity->properties, prop_idx+1, &value);
 
-                    values[prop_idx/2] = *value;
+                    // Entities keep a copy, AST values outlive this query and may be bound parameters.
+                    values[prop_idx/2] = SI_Clone(*value);
                     keys[prop_idx/2] = key->stringval;
                 }
 
                 GraphEntity_Add_Properties((GraphEntity*)e, propCount/2, keys, values);
-                LabelStore_UpdateSchema(store, propCount/2, keys);
-                LabelStore_UpdateSchema(allStore, propCount/2, keys);
+                int added = LabelStore_UpdateSchema(store, propCount/2, keys);
+                added += LabelStore_UpdateSchema(allStore, propCount/2, keys);
+                if(added) GraphContext_UpdateSchemaVersion(op->gc);
                 op->result_set->stats.properties_set += propCount/2;
             }
         }
+
+        GraphContext_IndexEdge(op->gc, e->relationship, e, srcNodeID, destNodeID);
         relationships_created++;
     }
 
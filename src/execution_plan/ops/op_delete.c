@@ -19,10 +19,11 @@
 /* Forward declarations. */
 void _LocateEntities(OpDelete *op_delete, QueryGraph *graph, AST_DeleteNode *ast_delete_node);
 
-OpBase* NewDeleteOp(AST_DeleteNode *ast_delete_node, QueryGraph *qg, Graph *g, ResultSet *result_set) {
+OpBase* NewDeleteOp(AST_DeleteNode *ast_delete_node, QueryGraph *qg, GraphContext *gc, ResultSet *result_set) {
     OpDelete *op_delete = malloc(sizeof(OpDelete));
 
-    op_delete->g = g;
+    op_delete->gc = gc;
+    op_delete->g = gc->g;
     op_delete->qg = qg;
     op_delete->node_count = 0;
     op_delete->edge_count = 0;
@@ -86,19 +87,27 @@ EntityID *_SortNRemoveDups(EntityID *entities, size_t entityCount, size_t *dupFr
 }
 
 void _DeleteEntities(OpDelete *op) {
-    /* We must start with edge deletion as node deletion moves nodes around. */
-    size_t deletedEdgeCount = array_len(op->deleted_edges);
-    for(int i = 0; i < deletedEdgeCount; i++) {
-        Edge *e = op->deleted_edges + i;
-        if(Graph_DeleteEdge(op->g, e))
-            if(op->result_set) op->result_set->stats.relationships_deleted++;
+    size_t node_deleted = 0;
+    size_t edge_deleted = 0;
+
+    /* Indices refer to entities by ID, which are reused once deleted,
+     * remove deleted entities while their properties are still available. */
+    if(GraphContext_HasIndices(op->gc)) {
+        for(int i = 0; i < array_len(op->deleted_nodes); i++) {
+            GraphContext_UnindexNode(op->gc, op->deleted_nodes + i);
+        }
+        for(int i = 0; i < array_len(op->deleted_edges); i++) {
+            GraphContext_UnindexEdge(op->gc, op->deleted_edges + i);
+        }
     }
 
-    size_t deletedNodeCount = array_len(op->deleted_nodes);
-    for(int i = 0; i < deletedNodeCount; i++) {
-        Node *n = op->deleted_nodes + i;
-        if(Graph_DeleteNode(op->g, n))
-            if(op->result_set) op->result_set->stats.nodes_deleted++;
+    Graph_BulkDelete(op->g, op->deleted_nodes, array_len(op->deleted_nodes),
+                     op->deleted_edges, array_len(op->deleted_edges),
+                     &node_deleted, &edge_deleted);
+
+    if(op->result_set) {
+        op->result_set->stats.nodes_deleted += node_deleted;
+        op->result_set->stats.relationships_deleted += edge_deleted;
     }
 }
 
@@ -0,0 +1,77 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#include "op_edge_index_scan.h"
+
+OpBase *NewEdgeIndexScanOp(Graph *g, Edge *edge, Index *idx, IndexIter *iter) {
+  EdgeIndexScan *edgeIndexScan = malloc(sizeof(EdgeIndexScan));
+  edgeIndexScan->g = g;
+  edgeIndexScan->edge = edge;
+  edgeIndexScan->idx = idx;
+  edgeIndexScan->iter = iter;
+
+  // Set our Op operations
+  OpBase_Init(&edgeIndexScan->op);
+  edgeIndexScan->op.name = "Edge Index Scan";
+  edgeIndexScan->op.type = OPType_EDGE_INDEX_SCAN;
+  edgeIndexScan->op.consume = EdgeIndexScanConsume;
+  edgeIndexScan->op.reset = EdgeIndexScanReset;
+  edgeIndexScan->op.free = EdgeIndexScanFree;
+
+  edgeIndexScan->op.modifies = NewVector(char*, 3);
+  Vector_Push(edgeIndexScan->op.modifies, edge->src->alias);
+  Vector_Push(edgeIndexScan->op.modifies, edge->dest->alias);
+  Vector_Push(edgeIndexScan->op.modifies, edge->alias);
+
+  return (OpBase*)edgeIndexScan;
+}
+
+// Checks node resides within the label matrix, if node is labeled.
+static bool _EdgeIndexScan_LabelMatch(const Node *n, NodeID id) {
+  if (!n->label) return true;
+  bool x = false;
+  return (GrB_Matrix_extractElement_BOOL(&x, n->mat, id, id) == GrB_SUCCESS && x);
+}
+
+OpResult EdgeIndexScanConsume(OpBase *opBase, Record *r) {
+  EdgeIndexScan *op = (EdgeIndexScan*)opBase;
+  Edge *e = op->edge;
+
+  GrB_Index *val;
+  IndexedEdge *indexed = NULL;
+  while ((val = IndexIter_Next(op->iter))) {
+    indexed = Index_GetEdge(op->idx, val);
+    // Edge endpoints must match the pattern's labels.
+    if (_EdgeIndexScan_LabelMatch(e->src, indexed->src) &&
+        _EdgeIndexScan_LabelMatch(e->dest, indexed->dest)) break;
+  }
+  if (!val) return OP_DEPLETED;
+
+  Graph_GetEdge(op->g, indexed->id, e);
+  Graph_GetNode(op->g, indexed->src, e->src);
+  Graph_GetNode(op->g, indexed->dest, e->dest);
+  e->srcNodeID = indexed->src;
+  e->destNodeID = indexed->dest;
+
+  Record_AddEntry(r, e->src->alias, SI_PtrVal(e->src));
+  Record_AddEntry(r, e->dest->alias, SI_PtrVal(e->dest));
+  Record_AddEntry(r, e->alias, SI_PtrVal(e));
+
+  return OP_OK;
+}
+
+OpResult EdgeIndexScanReset(OpBase *ctx) {
+  EdgeIndexScan *edgeIndexScan = (EdgeIndexScan*)ctx;
+  IndexIter_Reset(edgeIndexScan->iter);
+
+  return OP_OK;
+}
+
+void EdgeIndexScanFree(OpBase *op) {
+  EdgeIndexScan *edgeIndexScan = (EdgeIndexScan *)op;
+  if (edgeIndexScan->iter) IndexIter_Free(edgeIndexScan->iter);
+}
@@ -0,0 +1,39 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#ifndef __OP_EDGE_INDEX_SCAN_H
+#define __OP_EDGE_INDEX_SCAN_H
+
+#include "op.h"
+#include "../../graph/graph.h"
+#include "../../graph/entities/edge.h"
+#include "../../index/index.h"
+
+/* EdgeIndexScan, scans a relationship index, resolving
+ * each edge along with its source and destination nodes. */
+typedef struct {
+    OpBase op;
+    Edge *edge;            /* edge being scanned, its src and dest nodes are resolved along */
+    Graph *g;
+    Index *idx;            /* relationship index, resolves iterated edges */
+    IndexIter *iter;
+} EdgeIndexScan;
+
+/* Creates a new EdgeIndexScan operation */
+OpBase *NewEdgeIndexScanOp(Graph *g, Edge *edge, Index *idx, IndexIter *iter);
+
+/* EdgeIndexScan next operation
+ * called each time a new edge is required */
+OpResult EdgeIndexScanConsume(OpBase *opBase, Record *r);
+
+/* Restart iterator */
+OpResult EdgeIndexScanReset(OpBase *ctx);
+
+/* Frees EdgeIndexScan */
+void EdgeIndexScanFree(OpBase *ctx);
+
+#endif
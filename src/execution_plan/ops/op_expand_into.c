@@ -0,0 +1,154 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#include "op_expand_into.h"
+#include "../../util/arr.h"
+#include "../../GraphBLASExt/GxB_Delete.h"
+
+/* Both source and destination nodes are resolved, their labels
+ * had been applied when they were resolved, drop their label operands. */
+static void _ExpandInto_RemoveLabels(AlgebraicExpression *ae) {
+    // A label expression (src == dest) applies a label to a resolved node.
+    if(ae->src_node == ae->dest_node) return;
+
+    Node *src = ae->src_node;
+    Node *dest = ae->dest_node;
+    if(ae->operand_count > 1 && dest->mat && ae->operands[0].operand == dest->mat) {
+        AlgebraicExpression_RemoveTerm(ae, 0, NULL);
+    }
+    if(ae->operand_count > 1 && src->mat && ae->operands[ae->operand_count-1].operand == src->mat) {
+        AlgebraicExpression_RemoveTerm(ae, ae->operand_count-1, NULL);
+    }
+}
+
+OpBase* NewExpandIntoOp(Graph *g, AlgebraicExpression *algebraic_expression) {
+    ExpandInto *expandInto = calloc(1, sizeof(ExpandInto));
+    expandInto->graph = g;
+    expandInto->algebraic_expression = algebraic_expression;
+    expandInto->F = NULL;
+    expandInto->edges = NULL;
+    _ExpandInto_RemoveLabels(algebraic_expression);
+
+    // Set our Op operations
+    OpBase_Init(&expandInto->op);
+    expandInto->op.name = "Expand Into";
+    expandInto->op.type = OPType_EXPAND_INTO;
+    expandInto->op.consume = ExpandIntoConsume;
+    expandInto->op.reset = ExpandIntoReset;
+    expandInto->op.free = ExpandIntoFree;
+    expandInto->op.modifies = NewVector(char*, 1);
+
+    if(algebraic_expression->edge) {
+        char *modified = algebraic_expression->edge->alias;
+        Vector_Push(expandInto->op.modifies, modified);
+        expandInto->edges = array_new(Edge, 1);
+        expandInto->edgeRelationType = Edge_GetRelationID(algebraic_expression->edge);
+    }
+
+    return (OpBase*)expandInto;
+}
+
+// Checks if dest is reachable from src through the algebraic expression.
+static bool _ExpandInto_Connected(ExpandInto *op, NodeID srcId, NodeID destId) {
+    AlgebraicExpression *ae = op->algebraic_expression;
+    if(ae->operand_count == 0) return true;
+
+    bool connected = false;
+    GrB_Info info;
+
+    if(ae->operand_count == 1) {
+        /* Single operand, look up entry directly,
+         * matrices are indexed [dest, src]. */
+        AlgebraicExpressionOperand *operand = ae->operands;
+        if(operand->transpose) info = GrB_Matrix_extractElement_BOOL(&connected, operand->operand, srcId, destId);
+        else info = GrB_Matrix_extractElement_BOOL(&connected, operand->operand, destId, srcId);
+        return (info == GrB_SUCCESS);
+    }
+
+    // Evaluate expression against source node, inspect destination.
+    if(op->F == NULL) GrB_Matrix_new(&op->F, GrB_BOOL, Graph_RequiredMatrixDim(op->graph), 1);
+    GrB_Matrix_setElement_BOOL(op->F, true, srcId, 0);
+
+    AlgebraicExpression_AppendTerm(ae, op->F, false, false);
+    AlgebraicExpressionResult *res = AlgebraicExpression_Execute(ae);
+    AlgebraicExpression_RemoveTerm(ae, ae->operand_count-1, NULL);
+
+    info = GrB_Matrix_extractElement_BOOL(&connected, res->m, destId, 0);
+    AlgebraicExpressionResult_Free(res);
+    GxB_Matrix_Delete(op->F, srcId, 0);
+    return (info == GrB_SUCCESS);
+}
+
+// Updates query graph edge with the next edge connecting current pair.
+static OpResult _ExpandInto_SetEdge(ExpandInto *op) {
+    if(!array_len(op->edges)) return OP_DEPLETED;
+
+    Edge *e = op->edges + (array_len(op->edges)-1);
+    op->algebraic_expression->edge->entity = e->entity;
+    op->algebraic_expression->edge->srcNodeID = e->srcNodeID;
+    op->algebraic_expression->edge->destNodeID = e->destNodeID;
+
+    array_pop(op->edges);
+    return OP_OK;
+}
+
+// Collects edges connecting source and destination nodes.
+static void _ExpandInto_CollectEdges(ExpandInto *op, NodeID srcId, NodeID destId) {
+    AlgebraicExpression *ae = op->algebraic_expression;
+
+    // Edge matrix operand is transposed when edge is traversed from its destination.
+    for(int i = 0; i < ae->operand_count; i++) {
+        if(ae->operands[i].operand == ae->edge->mat && ae->operands[i].transpose) {
+            NodeID t = srcId;
+            srcId = destId;
+            destId = t;
+            break;
+        }
+    }
+
+    Graph_GetEdgesConnectingNodes(op->graph, srcId, destId, op->edgeRelationType, &op->edges);
+}
+
+OpResult ExpandIntoConsume(OpBase *opBase, Record *r) {
+    ExpandInto *op = (ExpandInto*)opBase;
+    OpBase *child = op->op.children[0];
+    AlgebraicExpression *ae = op->algebraic_expression;
+
+    // Pass current pair once for each remaining connecting edge.
+    if(ae->edge && _ExpandInto_SetEdge(op) == OP_OK) return OP_OK;
+
+    while(true) {
+        OpResult res = child->consume(child, r);
+        if(res != OP_OK) return res;
+
+        NodeID srcId = ENTITY_GET_ID(Record_GetNode(*r, ae->src_node->alias));
+        NodeID destId = ENTITY_GET_ID(Record_GetNode(*r, ae->dest_node->alias));
+        if(!_ExpandInto_Connected(op, srcId, destId)) continue;
+        if(!ae->edge) return OP_OK;
+
+        _ExpandInto_CollectEdges(op, srcId, destId);
+        if(_ExpandInto_SetEdge(op) == OP_OK) {
+            Record_AddEntry(r, ae->edge->alias, SI_PtrVal(ae->edge));
+            return OP_OK;
+        }
+    }
+}
+
+OpResult ExpandIntoReset(OpBase *ctx) {
+    ExpandInto *op = (ExpandInto*)ctx;
+    if(op->edges) array_clear(op->edges);
+
+    OpBase *child = op->op.children[0];
+    return child->reset(child);
+}
+
+/* Frees ExpandInto */
+void ExpandIntoFree(OpBase *ctx) {
+    ExpandInto *op = (ExpandInto*)ctx;
+    if(op->F) GrB_Matrix_free(&op->F);
+    if(op->edges) array_free(op->edges);
+}
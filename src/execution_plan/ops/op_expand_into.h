@@ -0,0 +1,42 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#ifndef __OP_EXPAND_INTO_H__
+#define __OP_EXPAND_INTO_H__
+
+#include "op.h"
+#include "../../arithmetic/algebraic_expression.h"
+
+/* ExpandInto traverses an algebraic expression whose source and destination
+ * nodes are both resolved by the time it runs, as in cyclic patterns.
+ * Rather than expanding the source node's entire neighborhood and
+ * overwriting the destination, each (source, destination) pair is checked
+ * for connectivity, passing only connected pairs. */
+typedef struct {
+    OpBase op;
+    Graph *graph;
+    AlgebraicExpression *algebraic_expression;
+    GrB_Matrix F;               /* Filter vector, marks source node. */
+    int edgeRelationType;       /* Relation type of referenced edge. */
+    Edge *edges;                /* Edges connecting current pair. */
+} ExpandInto;
+
+/* Creates a new ExpandInto operation */
+OpBase* NewExpandIntoOp(Graph *g, AlgebraicExpression *algebraic_expression);
+
+/* ExpandIntoConsume next operation
+ * passes each record whose source and destination are connected,
+ * once for each connecting edge, if the edge is referenced. */
+OpResult ExpandIntoConsume(OpBase *opBase, Record *r);
+
+/* Restart iterator */
+OpResult ExpandIntoReset(OpBase *ctx);
+
+/* Frees ExpandInto */
+void ExpandIntoFree(OpBase *ctx);
+
+#endif
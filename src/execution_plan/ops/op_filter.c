@@ -43,7 +43,8 @@ OpResult FilterConsume(OpBase *opBase, Record *r) {
 /* Restart iterator */
 OpResult FilterReset(OpBase *ctx) {
     Filter *filter = (Filter*)ctx;
-    return OP_OK;
+    OpBase *child = filter->op.children[0];
+    return child->reset(child);
 }
 
 /* Frees Filter*/
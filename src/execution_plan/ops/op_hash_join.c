@@ -0,0 +1,210 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#include "op_hash_join.h"
+#include <ctype.h>
+#include "../../util/arr.h"
+
+OpBase* NewHashJoinOp(QueryGraph *qg, AR_ExpNode *probe_exp, AR_ExpNode *build_exp) {
+    HashJoin *join = malloc(sizeof(HashJoin));
+    join->qg = qg;
+    join->probe_exp = probe_exp;
+    join->build_exp = build_exp;
+    join->init = true;
+    join->aliases = NULL;
+    join->targets = NULL;
+    join->is_edge = NULL;
+    join->table = NewTrieMap();
+    join->bucket = NULL;
+    join->bucket_idx = 0;
+    join->key_cap = 64;
+    join->key_buf = malloc(join->key_cap);
+
+    // Set our Op operations
+    OpBase_Init(&join->op);
+    join->op.name = "Hash Join";
+    join->op.type = OPType_HASH_JOIN;
+    join->op.consume = HashJoinConsume;
+    join->op.reset = HashJoinReset;
+    join->op.free = HashJoinFree;
+
+    return (OpBase*)join;
+}
+
+/* Computes join key string representation,
+ * values which compare equal share the same representation. */
+static tm_len_t _HashJoin_Key(HashJoin *op, SIValue v) {
+    size_t len;
+    double d;
+
+    if(v.type == T_STRING) {
+        // Strings are compared case insensitive.
+        len = strlen(v.stringval) + 1;
+        if(len > op->key_cap) {
+            op->key_cap = len;
+            op->key_buf = realloc(op->key_buf, op->key_cap);
+        }
+        op->key_buf[0] = 's';
+        for(size_t i = 1; i < len; i++) op->key_buf[i] = tolower(v.stringval[i-1]);
+    } else if(SIValue_ToDouble(&v, &d)) {
+        // Numerics of different types are compared as doubles.
+        if(d == 0) d = 0;   // -0 == 0
+        len = snprintf(op->key_buf, op->key_cap, "n%.17g", d);
+    } else {
+        len = snprintf(op->key_buf, op->key_cap, "t%d", v.type);
+    }
+
+    // Collisions are resolved by comparing keys.
+    return (len > UINT16_MAX) ? UINT16_MAX : len;
+}
+
+static inline bool _HashJoin_KeysMatch(SIValue a, SIValue b) {
+    // Same semantics as filter's equality predicate.
+    return SI_COMPARABLE(a, b) && SIValue_Compare(a, b) == 0;
+}
+
+static void* _HashJoin_ReplaceBucket(void *oldval, void *newval) {
+    // Old bucket had been reallocated.
+    return newval;
+}
+
+static void _HashJoin_FreeBucket(void *value) {
+    HashJoinRecord **bucket = value;
+    for(int i = 0; i < array_len(bucket); i++) {
+        SIValue_Free(&bucket[i]->key);
+        free(bucket[i]->entities);
+        free(bucket[i]);
+    }
+    array_free(bucket);
+}
+
+// Collects aliases modified by op and its children.
+static void _HashJoin_CollectAliases(const OpBase *op, char ***aliases) {
+    if(op->modifies) {
+        for(int i = 0; i < Vector_Size(op->modifies); i++) {
+            char *alias;
+            Vector_Get(op->modifies, i, &alias);
+            int j = 0;
+            for(; j < array_len(*aliases); j++) {
+                if(strcmp((*aliases)[j], alias) == 0) break;
+            }
+            if(j == array_len(*aliases)) *aliases = array_append(*aliases, alias);
+        }
+    }
+
+    for(int i = 0; i < op->childCount; i++) {
+        _HashJoin_CollectAliases(op->children[i], aliases);
+    }
+}
+
+// Locates query graph entities set by the build stream.
+static void _HashJoin_ResolveTargets(HashJoin *op, const Record r) {
+    op->aliases = array_new(char*, 4);
+    _HashJoin_CollectAliases(op->op.children[1], &op->aliases);
+
+    int alias_count = array_len(op->aliases);
+    op->targets = malloc(sizeof(GraphEntity*) * alias_count);
+    op->is_edge = malloc(sizeof(bool) * alias_count);
+    for(int i = 0; i < alias_count; i++) {
+        op->targets[i] = Record_GetEntry(r, op->aliases[i]).ptrval;
+        op->is_edge[i] = (QueryGraph_GetEdgeByAlias(op->qg, op->aliases[i]) != NULL);
+    }
+}
+
+// Consumes build stream entirely, populating hash table.
+static OpResult _HashJoin_Build(HashJoin *op, Record *r) {
+    OpBase *build = op->op.children[1];
+    OpResult res;
+
+    while((res = build->consume(build, r)) == OP_OK) {
+        if(op->targets == NULL) _HashJoin_ResolveTargets(op, *r);
+
+        int alias_count = array_len(op->aliases);
+        HashJoinRecord *rec = malloc(sizeof(HashJoinRecord));
+        rec->key = SI_Clone(AR_EXP_Evaluate(op->build_exp, *r));
+        rec->entities = malloc(sizeof(HashJoinEntity) * alias_count);
+        for(int i = 0; i < alias_count; i++) {
+            if(op->is_edge[i]) rec->entities[i].edge = *(Edge*)op->targets[i];
+            else rec->entities[i].node = *(Node*)op->targets[i];
+        }
+
+        tm_len_t len = _HashJoin_Key(op, rec->key);
+        HashJoinRecord **bucket = TrieMap_Find(op->table, op->key_buf, len);
+        HashJoinRecord **updated;
+        if(bucket == TRIEMAP_NOTFOUND) updated = array_new(HashJoinRecord*, 1);
+        else updated = bucket;
+
+        updated = array_append(updated, rec);
+        if(updated != bucket) {
+            TrieMap_Add(op->table, op->key_buf, len, updated, _HashJoin_ReplaceBucket);
+        }
+    }
+
+    return (res == OP_DEPLETED) ? OP_OK : res;
+}
+
+// Sets query graph entities as they were when rec was produced.
+static void _HashJoin_Restore(HashJoin *op, const HashJoinRecord *rec, Record *r) {
+    for(int i = 0; i < array_len(op->aliases); i++) {
+        if(op->is_edge[i]) *(Edge*)op->targets[i] = rec->entities[i].edge;
+        else *(Node*)op->targets[i] = rec->entities[i].node;
+        Record_AddEntry(r, op->aliases[i], SI_PtrVal(op->targets[i]));
+    }
+}
+
+OpResult HashJoinConsume(OpBase *opBase, Record *r) {
+    HashJoin *op = (HashJoin*)opBase;
+    OpBase *probe = op->op.children[0];
+
+    if(op->init) {
+        op->init = false;
+        OpResult res = _HashJoin_Build(op, r);
+        if(res != OP_OK) return res;
+    }
+
+    // Build stream is empty.
+    if(op->targets == NULL) return OP_DEPLETED;
+
+    while(true) {
+        // Scan candidates for current probe record.
+        while(op->bucket && op->bucket_idx < array_len(op->bucket)) {
+            HashJoinRecord *rec = op->bucket[op->bucket_idx++];
+            if(!_HashJoin_KeysMatch(op->probe_key, rec->key)) continue;
+            _HashJoin_Restore(op, rec, r);
+            return OP_OK;
+        }
+
+        OpResult res = probe->consume(probe, r);
+        if(res != OP_OK) return res;
+
+        op->probe_key = AR_EXP_Evaluate(op->probe_exp, *r);
+        tm_len_t len = _HashJoin_Key(op, op->probe_key);
+        op->bucket = TrieMap_Find(op->table, op->key_buf, len);
+        if(op->bucket == TRIEMAP_NOTFOUND) op->bucket = NULL;
+        op->bucket_idx = 0;
+    }
+}
+
+OpResult HashJoinReset(OpBase *opBase) {
+    HashJoin *op = (HashJoin*)opBase;
+    /* Build stream doesn't depend on records produced
+     * outside of this op, hash table remains valid. */
+    op->bucket = NULL;
+    op->bucket_idx = 0;
+
+    OpBase *probe = op->op.children[0];
+    return probe->reset(probe);
+}
+
+void HashJoinFree(OpBase *opBase) {
+    HashJoin *op = (HashJoin*)opBase;
+    TrieMap_Free(op->table, _HashJoin_FreeBucket);
+    if(op->aliases) array_free(op->aliases);
+    free(op->targets);
+    free(op->is_edge);
+    free(op->key_buf);
+}
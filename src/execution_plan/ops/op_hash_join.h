@@ -0,0 +1,57 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#ifndef __OP_HASH_JOIN_H__
+#define __OP_HASH_JOIN_H__
+
+#include "op.h"
+#include "../../graph/query_graph.h"
+#include "../../util/triemap/triemap.h"
+#include "../../arithmetic/arithmetic_expression.h"
+
+/* HashJoin joins two independent streams on an equality predicate
+ * lhs = rhs, where lhs is resolved by the probe stream (first child)
+ * and rhs by the build stream (second child).
+ * The build stream is consumed once, its records are stored in a hash table
+ * keyed by rhs, each probe record is then matched against the table
+ * instead of rescanning the build stream. */
+
+/* Copy of a query graph entity, as set by the build stream. */
+typedef union {
+    Node node;
+    Edge edge;
+} HashJoinEntity;
+
+/* Build stream record. */
+typedef struct {
+    SIValue key;                /* Evaluated rhs. */
+    HashJoinEntity *entities;   /* One copy for each of the build stream aliases. */
+} HashJoinRecord;
+
+typedef struct {
+    OpBase op;
+    AR_ExpNode *probe_exp;      /* Join key, evaluated against probe records. */
+    AR_ExpNode *build_exp;      /* Join key, evaluated against build records. */
+    QueryGraph *qg;
+    bool init;                  /* Build stream had been consumed. */
+    char **aliases;             /* Aliases resolved by build stream. */
+    GraphEntity **targets;      /* Query graph entities resolved by build stream. */
+    bool *is_edge;              /* Type of each target. */
+    TrieMap *table;             /* Maps join key to an array of HashJoinRecord*. */
+    HashJoinRecord **bucket;    /* Candidates for current probe record. */
+    SIValue probe_key;          /* Join key of current probe record. */
+    int bucket_idx;             /* Next candidate to inspect. */
+    char *key_buf;              /* Join key string representation. */
+    size_t key_cap;             /* Size of key_buf. */
+} HashJoin;
+
+OpBase* NewHashJoinOp(QueryGraph *qg, AR_ExpNode *probe_exp, AR_ExpNode *build_exp);
+OpResult HashJoinConsume(OpBase *opBase, Record *r);
+OpResult HashJoinReset(OpBase *opBase);
+void HashJoinFree(OpBase *opBase);
+
+#endif
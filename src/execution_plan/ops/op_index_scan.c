@@ -48,5 +48,5 @@ OpResult IndexScanReset(OpBase *ctx) {
 
 void IndexScanFree(OpBase *op) {
   IndexScan *indexScan = (IndexScan *)op;
-  IndexIter_Free(indexScan->iter);
+  if (indexScan->iter) IndexIter_Free(indexScan->iter);
 }
@@ -62,17 +62,22 @@ static void _CommitNodes(OpMerge *op) {
                         Vector_Get(entity->properties, prop_idx, &key);
                         Vector_Get(entity->properties, prop_idx+1, &value);
 
-                        values[prop_idx/2] = *value;
+                        // Entities keep a copy, AST values outlive this query and may be bound parameters.
+                        values[prop_idx/2] = SI_Clone(*value);
                         keys[prop_idx/2] = key->stringval;
                     }
 
                     GraphEntity_Add_Properties((GraphEntity*)n, propCount/2, keys, values);
                     // Update tracked schema.
-                    if(store) LabelStore_UpdateSchema(store, propCount/2, keys);
-                    LabelStore_UpdateSchema(allStore, propCount/2, keys);
+                    int added = LabelStore_UpdateSchema(allStore, propCount/2, keys);
+                    if(store) added += LabelStore_UpdateSchema(store, propCount/2, keys);
+                    if(added) GraphContext_UpdateSchemaVersion(op->gc);
                     op->result_set->stats.properties_set += propCount/2;
                 }
             }
+
+            // Following merges of the same pattern will find it through indices.
+            GraphContext_IndexNode(op->gc, n->label, n);
         }
 
         TrieMap_Free(referred_entities, TrieMap_NOP_CB);
@@ -119,17 +124,21 @@ static void _CommitEdges(OpMerge *op) {
                         Vector_Get(entity->properties, prop_idx, &key);
                         Vector_Get(entity->properties, prop_idx+1, &value);
 
-                        values[prop_idx/2] = *value;
+                        // Entities keep a copy, AST values outlive this query and may be bound parameters.
+                        values[prop_idx/2] = SI_Clone(*value);
                         keys[prop_idx/2] = key->stringval;
                     }
 
                     GraphEntity_Add_Properties((GraphEntity*)e, propCount/2, keys, values);
                     // Update tracked schema.
-                    if(store) LabelStore_UpdateSchema(store, propCount/2, keys);
-                    LabelStore_UpdateSchema(allStore, propCount/2, keys);
+                    int added = LabelStore_UpdateSchema(allStore, propCount/2, keys);
+                    if(store) added += LabelStore_UpdateSchema(store, propCount/2, keys);
+                    if(added) GraphContext_UpdateSchemaVersion(op->gc);
                     op->result_set->stats.properties_set += propCount/2;
                 }
             }
+
+            GraphContext_IndexEdge(op->gc, e->relationship, e, srcId, destId);
             relationships_created++;
         }
         TrieMap_Free(referred_entities, TrieMap_NOP_CB);
@@ -149,6 +158,7 @@ OpBase* NewMergeOp(GraphContext *gc, AST_Query *ast, QueryGraph *qg, ResultSet *
     op_merge->ast = ast;
     op_merge->qg = qg;
     op_merge->result_set = result_set;
+    op_merge->executed = false;
     op_merge->matched = false;
 
     // Set our Op operations
@@ -164,6 +174,7 @@ OpBase* NewMergeOp(GraphContext *gc, AST_Query *ast, QueryGraph *qg, ResultSet *
 
 OpResult OpMergeConsume(OpBase *opBase, Record *r) {
     OpMerge *op = (OpMerge*)opBase;
+    op->executed = true;
 
     OpBase *child = op->op.children[0];
     OpResult res = child->consume(child, r);
@@ -185,7 +196,7 @@ OpResult OpMergeReset(OpBase *ctx) {
 void OpMergeFree(OpBase *ctx) {
     OpMerge *op = (OpMerge*)ctx;
     
-    if(!op->matched) {
+    if(op->executed && !op->matched) {
         /* Pattern was not matched, 
          * create every single entity within the pattern. */
         _CreateEntities(op);
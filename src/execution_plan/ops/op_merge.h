@@ -26,6 +26,7 @@ typedef struct {
     QueryGraph *qg;         // Query graph.
     AST_Query *ast;         // Query abstract syntax tree.
     ResultSet *result_set;  // Required for statistics updates.
+    bool executed;          // Has the pattern been looked up, false when explained.
     bool matched;           // Has the entire pattern been matched.
 } OpMerge;
 
@@ -24,6 +24,14 @@ OpResult _Traverse_SetEdge(Traverse *op, Record *r) {
     return OP_OK;
 }
 
+// Updates query graph edge, using the edge ID carried by the traversal result.
+void _Traverse_SetEdgeByID(Traverse *op, EdgeID id) {
+    Edge *e = op->algebraic_expression->edge;
+    Graph_GetEdge(op->graph, id, e);
+    e->srcNodeID = ENTITY_GET_ID(e->src);
+    e->destNodeID = ENTITY_GET_ID(e->dest);
+}
+
 OpBase* NewTraverseOp(Graph *g, AlgebraicExpression *ae) {
     Traverse *traverse = calloc(1, sizeof(Traverse));
     traverse->graph = g;
@@ -56,6 +64,29 @@ OpBase* NewTraverseOp(Graph *g, AlgebraicExpression *ae) {
     return (OpBase*)traverse;
 }
 
+OpBase* NewIndexTraverseOp(Graph *g, AlgebraicExpression *ae, IndexIter *iter) {
+    Traverse *traverse = (Traverse*)NewTraverseOp(g, ae);
+    traverse->index_iter = iter;
+    traverse->op.name = "Index Traverse";
+    return (OpBase*)traverse;
+}
+
+// Evaluates expression over the indexed source nodes, D[i, i] is set for each indexed node i.
+static AlgebraicExpressionResult* _Traverse_ExecuteIndexed(Traverse *op) {
+    AlgebraicExpression *ae = op->algebraic_expression;
+    GrB_Index n = Graph_RequiredMatrixDim(op->graph);
+    GrB_Matrix D;
+    GrB_Matrix_new(&D, GrB_BOOL, n, n);
+    IndexIter_ToDiagonal(op->index_iter, D);
+
+    AlgebraicExpression_AppendTerm(ae, D, false, false);
+    AlgebraicExpressionResult *res = AlgebraicExpression_Execute(ae);
+    AlgebraicExpression_RemoveTerm(ae, ae->operand_count-1, NULL);
+
+    GrB_Matrix_free(&D);
+    return res;
+}
+
 /* TraverseConsume next operation 
  * each call will update the graph
  * returns OP_DEPLETED when no additional updates are available */
@@ -65,7 +96,8 @@ OpResult TraverseConsume(OpBase *opBase, Record *r) {
     GrB_Index dest_id;
 
     if(op->algebraic_results == NULL) {
-        op->algebraic_results = AlgebraicExpression_Execute(op->algebraic_expression);
+        if(op->index_iter) op->algebraic_results = _Traverse_ExecuteIndexed(op);
+        else op->algebraic_results = AlgebraicExpression_Execute(op->algebraic_expression);
         op->it = TuplesIter_new(op->algebraic_results->m);
 
         Node *srcNode = op->algebraic_results->src_node;
@@ -86,6 +118,15 @@ OpResult TraverseConsume(OpBase *opBase, Record *r) {
         if(_Traverse_SetEdge(op, r) == OP_OK) return OP_OK;
     }
 
+    if(op->algebraic_results->edge_ids) {
+        EdgeID edge_id;
+        if(TuplesIter_next_UINT64(op->it, &dest_id, &src_id, &edge_id) == TuplesIter_DEPLETED) return OP_DEPLETED;
+        Graph_GetNode(op->graph, src_id, op->algebraic_results->src_node);
+        Graph_GetNode(op->graph, dest_id, op->algebraic_results->dest_node);
+        _Traverse_SetEdgeByID(op, edge_id);
+        return OP_OK;
+    }
+
     if (TuplesIter_next(op->it, &dest_id, &src_id) == TuplesIter_DEPLETED) return OP_DEPLETED;
 
     Node *srcNode = op->algebraic_results->src_node;
@@ -94,6 +135,12 @@ OpResult TraverseConsume(OpBase *opBase, Record *r) {
     Graph_GetNode(op->graph, dest_id, destNode);
 
     if(op->algebraic_expression->edge != NULL) {
+        // Transposed traversal, edge leads from destination to source.
+        if(op->algebraic_expression->operands[0].transpose) {
+            srcNode = op->algebraic_results->dest_node;
+            destNode = op->algebraic_results->src_node;
+        }
+
         // We're guarantee to have at least one edge.
         Graph_GetEdgesConnectingNodes(op->graph,
                                       ENTITY_GET_ID(srcNode),
@@ -108,7 +155,8 @@ OpResult TraverseConsume(OpBase *opBase, Record *r) {
 
 OpResult TraverseReset(OpBase *ctx) {
     Traverse *op = (Traverse*)ctx;
-    TuplesIter_reset(op->it);
+    if(op->edges) array_clear(op->edges);
+    if(op->it) TuplesIter_reset(op->it);
     return OP_OK;
 }
 
@@ -116,6 +164,7 @@ OpResult TraverseReset(OpBase *ctx) {
 void TraverseFree(OpBase *ctx) {
     Traverse *op = (Traverse*)ctx;
     if(op->it) TuplesIter_free(op->it);
+    if(op->index_iter) IndexIter_Free(op->index_iter);
     if(op->edges) array_free(op->edges);
     if(op->algebraic_results) AlgebraicExpressionResult_Free(op->algebraic_results);
 }
@@ -13,6 +13,7 @@
 #include "../../arithmetic/algebraic_expression.h"
 #include "../../util/vector.h"
 #include "../../GraphBLASExt/tuples_iter.h"
+#include "../../index/index.h"
 
 /* OP Traverse */
 typedef struct {
@@ -23,11 +24,18 @@ typedef struct {
     int edgeRelationType;
     Edge *edges;    
     TuplesIter *it;
+    IndexIter *index_iter;  // Resolves source nodes, optional.
 } Traverse;
 
 /* Creates a new Traverse operation */
 OpBase* NewTraverseOp(Graph *g, AlgebraicExpression *ae);
 
+/* Creates a Traverse operation whose source nodes are those within
+ * the index iterator's range, the range is materialized as a diagonal
+ * filter matrix such that all sources are expanded by a single evaluation
+ * rather than a matrix multiplication per indexed node. Takes ownership of iter. */
+OpBase* NewIndexTraverseOp(Graph *g, AlgebraicExpression *ae, IndexIter *iter);
+
 /* TraverseConsume next operation 
  * each call will update the graph
  * returns OP_DEPLETED when no additional updates are available */
@@ -20,7 +20,7 @@ OpBase* NewUpdateOp(GraphContext *gc, AST_Query *ast, ResultSet *result_set) {
     op_update->update_expressions_count = 0;
     op_update->entities_to_update_count = 0;
     op_update->entities_to_update_cap = 16; /* 16 seems reasonable number to start with. */
-    op_update->entities_to_update = malloc(sizeof(EntityUpdateEvalCtx) * op_update->entities_to_update_cap);
+    op_update->entities_to_update = malloc(sizeof(EntityUpdateCtx) * op_update->entities_to_update_cap);
 
     _OpUpdate_BuildUpdateEvalCtx(op_update, ast->setNode);
 
@@ -50,6 +50,9 @@ void _OpUpdate_BuildUpdateEvalCtx(OpUpdate* op, AST_SetNode *setNode) {
         op->update_expressions[i].alias = element->entity->alias;
         op->update_expressions[i].property = element->entity->property;
         op->update_expressions[i].exp = AR_EXP_BuildFromAST(element->exp);
+
+        AST_GraphEntity *ge = MatchClause_GetEntity(op->ast->matchNode, element->entity->alias);
+        op->update_expressions[i].entity_type = (ge->t == N_ENTITY) ? STORE_NODE : STORE_EDGE;
     }
 }
 
@@ -57,20 +60,44 @@ void _OpUpdate_BuildUpdateEvalCtx(OpUpdate* op, AST_SetNode *setNode) {
  * more than once, we'll have to delay updates until all entities 
  * are processed, and so _OpUpdate_QueueUpdate will queue up 
  * all information necessary to perform an update. */
-void _OpUpdate_QueueUpdate(OpUpdate *op, EntityProperty *dest_entity_prop, SIValue new_value) {
+void _OpUpdate_QueueUpdate(OpUpdate *op, EntityProperty *dest_entity_prop, SIValue new_value,
+                           Index *idx, GraphEntity *entity) {
     /* Make sure we've got enough room in queue. */
     if(op->entities_to_update_count == op->entities_to_update_cap) {
         op->entities_to_update_cap *= 2;
         op->entities_to_update = realloc(op->entities_to_update, 
-                                         op->entities_to_update_cap * sizeof(EntityUpdateEvalCtx));
+                                         op->entities_to_update_cap * sizeof(EntityUpdateCtx));
     }
 
     int i = op->entities_to_update_count;
     op->entities_to_update[i].dest_entity_prop = dest_entity_prop;
     op->entities_to_update[i].new_value = new_value;
+    op->entities_to_update[i].idx = idx;
+    op->entities_to_update[i].entity = *entity;
+    if(idx && idx->entity_type == STORE_EDGE) {
+        op->entities_to_update[i].src = Edge_GetSrcNodeID((Edge*)entity);
+        op->entities_to_update[i].dest = Edge_GetDestNodeID((Edge*)entity);
+    }
     op->entities_to_update_count++;
 }
 
+/* Retrieves the index on the updated property of entity's label or relationship type,
+ * NULL if the property isn't indexed. */
+Index* _OpUpdate_LocateIndex(OpUpdate *op, EntityUpdateEvalCtx *update_expression, GraphEntity *entity) {
+    const char *label;
+    if(update_expression->entity_type == STORE_NODE) {
+        int label_id = Graph_GetNodeLabel(op->gc->g, ENTITY_GET_ID(entity));
+        if(label_id == GRAPH_NO_LABEL) return NULL;
+        label = op->gc->node_stores[label_id]->label;
+    } else {
+        Edge *e = (Edge*)entity;
+        int relation_id = Edge_GetRelationID(e);
+        if(relation_id == GRAPH_NO_RELATION) relation_id = Graph_GetEdgeRelation(op->gc->g, e);
+        label = op->gc->relation_stores[relation_id]->label;
+    }
+    return GraphContext_GetIndex(op->gc, label, update_expression->property, update_expression->entity_type);
+}
+
 OpResult OpUpdateConsume(OpBase *opBase, Record *r) {
     OpUpdate *op = (OpUpdate*)opBase;
     OpBase *child = op->op.children[0];
@@ -82,13 +109,18 @@ OpResult OpUpdateConsume(OpBase *opBase, Record *r) {
     EntityUpdateEvalCtx *update_expression = op->update_expressions;
     for(int i = 0; i < op->update_expressions_count; i++, update_expression++) {
         SIValue new_value = AR_EXP_Evaluate(update_expression->exp, *r);
+        /* Constants belong to the query, e.g. bound parameters, entity keeps a copy. */
+        AR_ExpNode *exp = update_expression->exp;
+        if(exp->type == AR_EXP_OPERAND && exp->operand.type == AR_EXP_CONSTANT) new_value = SI_Clone(new_value);
         /* Find ref to property. */
         SIValue entry = Record_GetEntry(*r, update_expression->alias);
         GraphEntity *entity = (GraphEntity*) entry.ptrval;
+        Index *idx = NULL;
+        if(GraphContext_HasIndices(op->gc)) idx = _OpUpdate_LocateIndex(op, update_expression, entity);
         int j = 0;
         for(; j < ENTITY_PROP_COUNT(entity); j++) {
             if(strcmp(ENTITY_PROPS(entity)[j].name, update_expression->property) == 0) {
-                _OpUpdate_QueueUpdate(op, &ENTITY_PROPS(entity)[j], new_value);
+                _OpUpdate_QueueUpdate(op, &ENTITY_PROPS(entity)[j], new_value, idx, entity);
                 break;
             }
         }
@@ -98,7 +130,7 @@ OpResult OpUpdateConsume(OpBase *opBase, Record *r) {
              * For the time being set the new property value to PROPERTY_NOTFOUND.
              * Once we commit the update, we'll set the actual value. */
             GraphEntity_Add_Properties(entity, 1, &update_expression->property, PROPERTY_NOTFOUND);
-            _OpUpdate_QueueUpdate(op, &ENTITY_PROPS(entity)[ENTITY_PROP_COUNT(entity)-1], new_value);
+            _OpUpdate_QueueUpdate(op, &ENTITY_PROPS(entity)[ENTITY_PROP_COUNT(entity)-1], new_value, idx, entity);
         }
     }
 
@@ -109,11 +141,24 @@ OpResult OpUpdateReset(OpBase *ctx) {
     return OP_OK;
 }
 
+/* Moves an updated entity to its new value within the index on the updated property. */
+void _OpUpdate_UpdateIndex(EntityUpdateCtx *update) {
+    if(update->idx->entity_type == STORE_NODE) {
+        Node n = {.entity = update->entity.entity};
+        Index_UpdateNode(update->idx, &n, &update->new_value);
+    } else {
+        Edge e = {.entity = update->entity.entity};
+        Index_UpdateEdge(update->idx, &e, &update->new_value, update->src, update->dest);
+    }
+}
+
 /* Executes delayed updates. */
 void _UpdateEntities(OpUpdate *op) {
     for(int i = 0; i < op->entities_to_update_count; i++) {
         EntityProperty *dest_entity_prop = op->entities_to_update[i].dest_entity_prop;
         SIValue new_value = op->entities_to_update[i].new_value;
+        // Index is updated while the entity still holds its previous value.
+        if(op->entities_to_update[i].idx) _OpUpdate_UpdateIndex(op->entities_to_update + i);
         dest_entity_prop->value = new_value;
     }
     if(op->result_set)
@@ -137,7 +182,7 @@ void _UpdateSchemas(const OpUpdate *op) {
         AST_GraphEntity* ge = MatchClause_GetEntity(op->ast->matchNode, entityAlias);
         LabelStoreType t = (ge->t == N_ENTITY) ? STORE_NODE : STORE_EDGE;
         LabelStore *allStore = GraphContext_AllStore(op->gc, t);
-        LabelStore_UpdateSchema(allStore, 1, &entityProp);
+        if(LabelStore_UpdateSchema(allStore, 1, &entityProp)) GraphContext_UpdateSchemaVersion(op->gc);
 
         // TODO If the match clause does not provide a label, we must update all the stores
         // affected by the SET clause.
@@ -146,7 +191,7 @@ void _UpdateSchemas(const OpUpdate *op) {
         LabelStore *store = GraphContext_GetStore(op->gc, l, t);
         if (!store) continue;
 
-        LabelStore_UpdateSchema(store, 1, &entityProp);
+        if(LabelStore_UpdateSchema(store, 1, &entityProp)) GraphContext_UpdateSchemaVersion(op->gc);
     }
 }
 
@@ -15,14 +15,19 @@
 #include "../../arithmetic/arithmetic_expression.h"
 
 typedef struct {
-    char *alias;        /* Entity alias. */
-    char *property;     /* Property to update. */
-    AR_ExpNode *exp;    /* Expression to evaluate. */
+    char *alias;                /* Entity alias. */
+    char *property;             /* Property to update. */
+    AR_ExpNode *exp;            /* Expression to evaluate. */
+    LabelStoreType entity_type; /* Updated entity is a node or an edge. */
 } EntityUpdateEvalCtx;
 
 typedef struct {
     EntityProperty *dest_entity_prop;   /* Entity's property to update. */
     SIValue new_value;                  /* Constant value to set. */
+    Index *idx;                         /* Index on updated property, NULL if not indexed. */
+    GraphEntity entity;                 /* Updated entity, reindexed within idx. */
+    NodeID src;                         /* Updated edge source node. */
+    NodeID dest;                        /* Updated edge destination node. */
 } EntityUpdateCtx;
 
 typedef struct {
@@ -16,6 +16,7 @@
 #include "op_filter.h"
 #include "op_node_by_label_scan.h"
 #include "op_index_scan.h"
+#include "op_edge_index_scan.h"
 #include "op_produce_results.h"
 #include "op_update.h"
 #include "op_traverse.h"
@@ -23,4 +24,6 @@
 #include "op_cartesian_product.h"
 #include "op_merge.h"
 #include "op_cond_var_len_traverse.h"
+#include "op_hash_join.h"
+#include "op_expand_into.h"
 #endif
@@ -0,0 +1,190 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#include "apply_join.h"
+#include "cost_model.h"
+#include "../ops/op_filter.h"
+#include "../ops/op_hash_join.h"
+#include "../../filter_tree/filter_tree.h"
+#include "../../parser/grammar.h"
+
+// Collects aliases referenced by expression.
+static Vector* _expressionAliases(AR_ExpNode *exp) {
+    TrieMap *t = NewTrieMap();
+    AR_EXP_CollectAliases(exp, t);
+
+    Vector *aliases = NewVector(char*, t->cardinality);
+    TrieMapIterator *it = TrieMap_Iterate(t, "", 0);
+
+    char *ptr;
+    tm_len_t len;
+    void *value;
+
+    while(TrieMapIterator_Next(it, &ptr, &len, &value)) {
+        char *alias = strndup(ptr, len);
+        Vector_Push(aliases, alias);
+    }
+
+    TrieMapIterator_Free(it);
+    TrieMap_Free(t, NULL);
+    return aliases;
+}
+
+static void _freeAliases(Vector *aliases) {
+    char *alias;
+    while(Vector_Pop(aliases, &alias)) free(alias);
+    Vector_Free(aliases);
+}
+
+/* Returns index of cartesian product stream resolving expression,
+ * -1 if expression isn't resolved by a single stream. */
+static int _resolvingStream(OpBase *cp, AR_ExpNode *exp) {
+    int stream = -1;
+    Vector *aliases = _expressionAliases(exp);
+
+    // Constant expressions are not join keys.
+    if(Vector_Size(aliases) > 0) {
+        for(int i = 0; i < cp->childCount; i++) {
+            if(ExecutionPlan_Locate_References(cp->children[i], aliases)) {
+                stream = i;
+                break;
+            }
+        }
+    }
+
+    _freeAliases(aliases);
+    return stream;
+}
+
+// Collects aliases modified by op and its children.
+static void _modifiedAliases(const OpBase *op, Vector *aliases) {
+    if(op->modifies) {
+        for(int i = 0; i < Vector_Size(op->modifies); i++) {
+            char *alias;
+            Vector_Get(op->modifies, i, &alias);
+            Vector_Push(aliases, alias);
+        }
+    }
+
+    for(int i = 0; i < op->childCount; i++) {
+        _modifiedAliases(op->children[i], aliases);
+    }
+}
+
+// Returns true if streams a and b resolve a common alias.
+static bool _streamsIntersect(OpBase *a, OpBase *b) {
+    bool intersect = false;
+    Vector *aliases = NewVector(char*, 0);
+    _modifiedAliases(b, aliases);
+
+    Vector *reference = NewVector(char*, 1);
+    for(int i = 0; i < Vector_Size(aliases) && !intersect; i++) {
+        char *alias;
+        Vector_Get(aliases, i, &alias);
+        Vector_Clear(reference);
+        Vector_Push(reference, alias);
+        intersect = (ExecutionPlan_Locate_References(a, reference) != NULL);
+    }
+
+    Vector_Free(reference);
+    Vector_Free(aliases);
+    return intersect;
+}
+
+// Populate cps vector with execution plan cartesian product operations.
+static void _locateCartesianProducts(OpBase *root, Vector *cps) {
+    if(root->type == OPType_CARTESIAN_PRODUCT) Vector_Push(cps, root);
+
+    for(int i = 0; i < root->childCount; i++) {
+        _locateCartesianProducts(root->children[i], cps);
+    }
+}
+
+/* Tries to replace filter with a hash join, returns false
+ * if filter isn't an equality between two cartesian product streams. */
+static bool _applyJoin(GraphContext *gc, ExecutionPlan *plan, OpBase *cp, Filter *filter) {
+    FT_FilterNode *tree = filter->filterTree;
+    if(!IsNodePredicate(tree) || tree->pred.op != EQ) return false;
+
+    AR_ExpNode *probe_exp = tree->pred.lhs;
+    AR_ExpNode *build_exp = tree->pred.rhs;
+    int probe_idx = _resolvingStream(cp, probe_exp);
+    int build_idx = _resolvingStream(cp, build_exp);
+    if(probe_idx == -1 || build_idx == -1 || probe_idx == build_idx) return false;
+
+    OpBase *probe = cp->children[probe_idx];
+    OpBase *build = cp->children[build_idx];
+    /* Join restores build stream entities on top of probe stream entities,
+     * streams must not share entities. */
+    if(_streamsIntersect(probe, build)) return false;
+
+    // Hash the stream expected to produce fewer records.
+    if(CostModel_Estimate(gc, plan->query_graph, build) > CostModel_Estimate(gc, plan->query_graph, probe)) {
+        OpBase *stream = probe;
+        probe = build;
+        build = stream;
+        AR_ExpNode *exp = probe_exp;
+        probe_exp = build_exp;
+        build_exp = exp;
+    }
+
+    OpBase *join = NewHashJoinOp(plan->query_graph, probe_exp, build_exp);
+
+    // Join replaces both streams.
+    ExecutionPlan_DetachOp(probe);
+    ExecutionPlan_DetachOp(build);
+    ExecutionPlan_AddOp(join, probe);
+    ExecutionPlan_AddOp(join, build);
+    ExecutionPlan_AddOp(cp, join);
+
+    // Filter is applied by join.
+    ExecutionPlan_RemoveOp((OpBase*)filter);
+    OpBase_Free((OpBase*)filter);
+    return true;
+}
+
+static int _compareStreams(const void *a, const void *b) {
+    double ca = (*(OpBase**)a)->cardinality;
+    double cb = (*(OpBase**)b)->cardinality;
+    return (ca < cb) - (ca > cb);
+}
+
+/* Orders cartesian product streams by their estimated number of records,
+ * descending. The first stream is rescanned for every combination of records
+ * from the following streams, the largest stream is placed first so that
+ * the streams it multiplies with are as small as possible. */
+static void _orderStreams(GraphContext *gc, ExecutionPlan *plan, OpBase *cp) {
+    for(int i = 0; i < cp->childCount; i++) CostModel_Estimate(gc, plan->query_graph, cp->children[i]);
+    qsort(cp->children, cp->childCount, sizeof(OpBase*), _compareStreams);
+}
+
+void applyJoin(GraphContext *gc, ExecutionPlan *plan) {
+    Vector *cps = NewVector(OpBase*, 0);
+    _locateCartesianProducts(plan->root, cps);
+
+    OpBase *cp;
+    while(Vector_Pop(cps, &cp)) {
+        /* Filters spanning multiple streams are placed
+         * right above the cartesian product. */
+        OpBase *current = cp->parent;
+        while(current && current->type == OPType_FILTER && cp->childCount > 1) {
+            OpBase *next = current->parent;
+            _applyJoin(gc, plan, cp, (Filter*)current);
+            current = next;
+        }
+
+        // Cartesian product of a single stream is redundant.
+        if(cp->childCount == 1 && cp->parent) {
+            ExecutionPlan_RemoveOp(cp);
+            OpBase_Free(cp);
+        } else {
+            _orderStreams(gc, plan, cp);
+        }
+    }
+
+    Vector_Free(cps);
+}
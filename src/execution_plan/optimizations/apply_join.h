@@ -0,0 +1,23 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#ifndef __APPLY_JOIN_H__
+#define __APPLY_JOIN_H__
+
+#include "../execution_plan.h"
+
+/* The apply join optimizer scans an execution plan for equality filters
+ * applied on top of a cartesian product, where each side of the equality
+ * is resolved by a different cartesian product stream, e.g.
+ * MATCH (a), (b) WHERE a.v = b.v
+ * such filters are replaced by a hash join between the two streams,
+ * which consumes each stream once instead of rescanning one per record
+ * of the other. The stream expected to produce fewer records is hashed.
+ * Remaining cartesian product streams are ordered by their estimated size. */
+void applyJoin(GraphContext *gc, ExecutionPlan *plan);
+
+#endif
@@ -0,0 +1,257 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#include "cost_model.h"
+#include "../ops/ops.h"
+#include "../../parser/grammar.h"
+#include "../../util/arr.h"
+
+/* Variable length traversals are estimated
+ * up to this number of hops beyond their minimum. */
+#define VAR_LEN_ESTIMATED_HOPS 2
+
+// Flips comparison, such that a op b equals b op' a.
+static int _FlipOp(int op) {
+    switch(op) {
+        case LT:
+            return GT;
+        case LE:
+            return GE;
+        case GT:
+            return LT;
+        case GE:
+            return LE;
+        default:
+            return op;
+    }
+}
+
+static double _DefaultSelectivity(int op) {
+    switch(op) {
+        case EQ:
+            return SELECTIVITY_EQ;
+        case NE:
+            return SELECTIVITY_NE;
+        case STARTS:
+        case ENDS:
+        case CONTAINS:
+            return SELECTIVITY_STRING;
+        default:
+            return SELECTIVITY_RANGE;
+    }
+}
+
+/* Estimates predicate selectivity, n, if not NULL, is the filtered node,
+ * otherwise the filtered entity is looked up in qg. */
+static double _PredicateSelectivity(const GraphContext *gc, const QueryGraph *qg,
+                                    const Node *n, const FT_PredicateNode *pred) {
+    int op = pred->op;
+    AR_ExpNode *prop_exp;
+    AR_ExpNode *const_exp;
+    int lhsType = AR_EXP_GetOperandType(pred->lhs);
+    int rhsType = AR_EXP_GetOperandType(pred->rhs);
+
+    if(lhsType == AR_EXP_VARIADIC && rhsType == AR_EXP_CONSTANT) {
+        prop_exp = pred->lhs;
+        const_exp = pred->rhs;
+    } else if(lhsType == AR_EXP_CONSTANT && rhsType == AR_EXP_VARIADIC) {
+        prop_exp = pred->rhs;
+        const_exp = pred->lhs;
+        op = _FlipOp(op);
+    } else {
+        return _DefaultSelectivity(op);
+    }
+
+    const char *alias = prop_exp->operand.variadic.entity_alias;
+    const char *property = prop_exp->operand.variadic.entity_prop;
+    if(n == NULL || strcmp(n->alias, alias) != 0) {
+        n = (qg) ? QueryGraph_GetNodeByAlias(qg, alias) : NULL;
+    }
+    if(n == NULL || n->label == NULL || property == NULL) return _DefaultSelectivity(op);
+
+    PropertyStats *stats = GraphContext_GetPropertyStats(gc, n->label, property);
+    if(stats == NULL) return _DefaultSelectivity(op);
+
+    double selectivity = PropertyStats_Selectivity(stats, op, const_exp->operand.constant);
+    return (selectivity == STATS_UNKNOWN) ? _DefaultSelectivity(op) : selectivity;
+}
+
+static double _FilterSelectivity(const GraphContext *gc, const QueryGraph *qg,
+                                 const Node *n, const FT_FilterNode *tree) {
+    if(tree == NULL) return 1;
+    if(IsNodePredicate(tree)) return _PredicateSelectivity(gc, qg, n, &tree->pred);
+
+    double left = _FilterSelectivity(gc, qg, n, tree->cond.left);
+    double right = _FilterSelectivity(gc, qg, n, tree->cond.right);
+    if(tree->cond.op == AND) return left * right;
+    return left + right - left * right;
+}
+
+double CostModel_FilterSelectivity(const GraphContext *gc, const QueryGraph *qg,
+                                   const FT_FilterNode *tree) {
+    return _FilterSelectivity(gc, qg, NULL, tree);
+}
+
+// Returns true if tree references alias and no other entity.
+static bool _FilterAppliesTo(const FT_FilterNode *tree, const char *alias) {
+    Vector *aliases = FilterTree_CollectAliases(tree);
+    bool applies = (Vector_Size(aliases) == 1);
+
+    char *a;
+    while(Vector_Pop(aliases, &a)) {
+        if(strcmp(a, alias) != 0) applies = false;
+        free(a);
+    }
+    Vector_Free(aliases);
+    return applies;
+}
+
+double CostModel_NodeScan(const GraphContext *gc, const Node *n, const FT_FilterNode *filters) {
+    const Graph *g = gc->g;
+    double count = Graph_NodeCount(g);
+
+    if(n->label) {
+        int label = GraphContext_GetLabelID(gc, n->label, STORE_NODE);
+        count = (label == GRAPH_NO_LABEL) ? 0 : Graph_LabeledNodeCount(g, label);
+    }
+
+    if(filters) {
+        Vector *sub_trees = FilterTree_SubTrees(filters);
+        for(int i = 0; i < Vector_Size(sub_trees); i++) {
+            FT_FilterNode *tree;
+            Vector_Get(sub_trees, i, &tree);
+            if(_FilterAppliesTo(tree, n->alias)) count *= _FilterSelectivity(gc, NULL, n, tree);
+        }
+        Vector_Free(sub_trees);
+    }
+
+    return count;
+}
+
+// Fraction of nodes reached through matrix m, per node.
+static double _MatrixDensity(const Graph *g, GrB_Matrix m) {
+    double node_count = Graph_NodeCount(g);
+    if(node_count == 0) return 0;
+
+    if(m == g->adjacency_matrix) return Graph_EdgeCount(g) / node_count;
+
+    for(int i = 0; i < Graph_LabelTypeCount(g); i++) {
+        if(m == g->labels[i]) return Graph_LabeledNodeCount(g, i) / node_count;
+    }
+
+    for(int i = 0; i < Graph_RelationTypeCount(g); i++) {
+        if(m == g->relations[i]) return Graph_RelationEdgeCount(g, i) / node_count;
+    }
+
+    // Matrix isn't maintained by graph, e.g. a missing label.
+    GrB_Index nvals;
+    GrB_Matrix_nvals(&nvals, m);
+    return nvals / node_count;
+}
+
+double CostModel_Expand(const Graph *g, const AlgebraicExpression *ae) {
+    double expand = 1;
+    for(int i = 0; i < ae->operand_count; i++) {
+        expand *= _MatrixDensity(g, ae->operands[i].operand);
+    }
+    return expand;
+}
+
+static double _ConnectProbability(const Graph *g, const AlgebraicExpression *ae) {
+    double node_count = Graph_NodeCount(g);
+    if(node_count == 0) return 0;
+
+    double p = CostModel_Expand(g, ae) / node_count;
+    return (p > 1) ? 1 : p;
+}
+
+static double _VarLenExpand(const CondVarLenTraverse *op) {
+    double node_count = Graph_NodeCount(op->g);
+    if(node_count == 0) return 0;
+
+    double degree = Graph_RelationEdgeCount(op->g, op->relationID) / node_count;
+    unsigned int maxHops = op->minHops + VAR_LEN_ESTIMATED_HOPS;
+    if(op->maxHops < maxHops) maxHops = op->maxHops;
+
+    // Sum of paths of each length.
+    double expand = 0;
+    double paths = 1;
+    for(unsigned int hops = 1; hops <= maxHops; hops++) {
+        paths *= degree;
+        if(hops >= op->minHops) expand += paths;
+    }
+    return expand;
+}
+
+double CostModel_Estimate(const GraphContext *gc, const QueryGraph *qg, OpBase *op) {
+    double children[op->childCount];
+    for(int i = 0; i < op->childCount; i++) {
+        children[i] = CostModel_Estimate(gc, qg, op->children[i]);
+    }
+
+    const Graph *g = gc->g;
+    double estimate;
+
+    switch(op->type) {
+        case OPType_ALL_NODE_SCAN:
+            estimate = Graph_NodeCount(g);
+            break;
+        case OPType_NODE_BY_LABEL_SCAN:
+            estimate = CostModel_NodeScan(gc, ((NodeByLabelScan*)op)->node, NULL);
+            break;
+        case OPType_INDEX_SCAN:
+            estimate = CostModel_NodeScan(gc, ((IndexScan*)op)->node, NULL) * SELECTIVITY_EQ;
+            break;
+        case OPType_EDGE_INDEX_SCAN: {
+            Edge *e = ((EdgeIndexScan*)op)->edge;
+            estimate = Graph_RelationEdgeCount(g, Edge_GetRelationID(e)) * SELECTIVITY_EQ;
+            break;
+        }
+        case OPType_CONDITIONAL_TRAVERSE: {
+            CondTraverse *traverse = (CondTraverse*)op;
+            estimate = children[0] * CostModel_Expand(g, traverse->algebraic_expression);
+            if(traverse->closing_expression) {
+                estimate *= _ConnectProbability(g, traverse->closing_expression);
+            }
+            break;
+        }
+        case OPType_TRAVERSE: {
+            // Traverse scans its source nodes, or those within its index range.
+            Traverse *traverse = (Traverse*)op;
+            AlgebraicExpression *ae = traverse->algebraic_expression;
+            double sources = Graph_NodeCount(g);
+            if(traverse->index_iter) sources = CostModel_NodeScan(gc, ae->src_node, NULL) * SELECTIVITY_EQ;
+            estimate = sources * CostModel_Expand(g, ae);
+            break;
+        }
+        case OPType_EXPAND_INTO:
+            // Probability a pair of nodes is connected.
+            estimate = children[0] * _ConnectProbability(g, ((ExpandInto*)op)->algebraic_expression);
+            break;
+        case OPType_CONDITIONAL_VAR_LEN_TRAVERSE:
+            estimate = children[0] * _VarLenExpand((CondVarLenTraverse*)op);
+            break;
+        case OPType_FILTER:
+            estimate = children[0] * CostModel_FilterSelectivity(gc, qg, ((Filter*)op)->filterTree);
+            break;
+        case OPType_CARTESIAN_PRODUCT:
+            estimate = 1;
+            for(int i = 0; i < op->childCount; i++) estimate *= children[i];
+            break;
+        case OPType_HASH_JOIN:
+            // Assume join key is unique within the larger stream.
+            estimate = (children[0] > children[1]) ? children[1] : children[0];
+            break;
+        default:
+            // Operation produces a record per input record.
+            estimate = (op->childCount > 0) ? children[0] : 1;
+            break;
+    }
+
+    op->cardinality = estimate;
+    return estimate;
+}
@@ -0,0 +1,45 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#ifndef __COST_MODEL_H__
+#define __COST_MODEL_H__
+
+#include "../ops/op.h"
+#include "../../graph/query_graph.h"
+#include "../../graph/graphcontext.h"
+#include "../../filter_tree/filter_tree.h"
+#include "../../arithmetic/algebraic_expression.h"
+
+/* The cost model estimates the number of records produced by execution plan
+ * operations, based on the number of nodes per label and edges per relation
+ * type maintained by the graph.
+ * Predicates comparing a property against a constant are estimated by
+ * statistics collected by GRAPH.ANALYZE, when available, other predicates
+ * are assumed to pass a fixed fraction of their input. */
+
+#define SELECTIVITY_EQ 0.1      // Fraction of records passing an equality predicate.
+#define SELECTIVITY_NE 0.9      // Fraction of records passing an inequality predicate.
+#define SELECTIVITY_RANGE 0.3   // Fraction of records passing a range predicate.
+#define SELECTIVITY_STRING 0.1  // Fraction of records passing STARTS WITH, ENDS WITH or CONTAINS.
+
+/* Estimated fraction of records passing filter tree,
+ * qg resolves the labels of filtered entities. */
+double CostModel_FilterSelectivity(const GraphContext *gc, const QueryGraph *qg,
+                                   const FT_FilterNode *tree);
+
+/* Estimated number of nodes produced by scanning n,
+ * taking into account filters applied solely to n. */
+double CostModel_NodeScan(const GraphContext *gc, const Node *n, const FT_FilterNode *filters);
+
+/* Estimated number of records produced by traversing ae, per source node. */
+double CostModel_Expand(const Graph *g, const AlgebraicExpression *ae);
+
+/* Estimates the number of records produced by op and each of its children,
+ * sets op's cardinality and returns it. */
+double CostModel_Estimate(const GraphContext *gc, const QueryGraph *qg, OpBase *op);
+
+#endif
@@ -13,5 +13,11 @@
 #include "./utilize_indices.h"
 #include "./select_entry_point.h"
 #include "./reduce_scans.h"
+#include "./apply_join.h"
+#include "./cost_model.h"
+#include "./order_filters.h"
+#include "./reduce_cycles.h"
+#include "./reduce_count.h"
+#include "./reduce_index_scans.h"
 
 #endif
@@ -13,9 +13,30 @@ void optimizePlan(GraphContext *gc, ExecutionPlan *plan) {
      * with index scans. */
     utilizeIndices(gc, plan);
 
+    /* Replace equality filters over cartesian products with hash joins. */
+    applyJoin(gc, plan);
+
     /* Try to reduce a number of filters into a single filter op. */
     reduceFilters(plan);
 
+    /* Evaluate the most selective conditions first. */
+    orderFilters(gc, plan);
+
     /* Remove redundant SCAN operations. */
     // reduceScans(plan);
+
+    /* Read entity counts maintained by the graph. */
+    reduceEntityCount(gc, plan);
+
+    /* Count traversed paths within a single matrix evaluation. */
+    reduceCount(gc, plan);
+
+    /* Estimate number of records produced by each operation. */
+    CostModel_Estimate(gc, plan->query_graph, plan->root);
+
+    /* Intersect traversals with the edges closing cyclic patterns. */
+    reduceCycles(gc, plan);
+
+    /* Expand traversals from index ranges within a single evaluation. */
+    reduceIndexScans(gc, plan);
 }
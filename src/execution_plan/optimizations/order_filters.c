@@ -0,0 +1,91 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#include "order_filters.h"
+#include "cost_model.h"
+#include "../ops/op_filter.h"
+#include "../../util/qsort.h"
+#include "../../parser/grammar.h"
+
+typedef struct {
+    FT_FilterNode *tree;
+    double selectivity;
+} _Condition;
+
+/* Collects operands of consecutive op condition nodes into conditions,
+ * and the condition nodes themselves into nodes. */
+static void _collectConditions(FT_FilterNode *tree, int op, Vector *conditions, Vector *nodes) {
+    if(!IsNodePredicate(tree) && tree->cond.op == op) {
+        Vector_Push(nodes, tree);
+        _collectConditions(tree->cond.left, op, conditions, nodes);
+        _collectConditions(tree->cond.right, op, conditions, nodes);
+        return;
+    }
+
+    _Condition *c = malloc(sizeof(_Condition));
+    c->tree = tree;
+    Vector_Push(conditions, c);
+}
+
+static FT_FilterNode* _orderTree(const GraphContext *gc, const QueryGraph *qg, FT_FilterNode *tree) {
+    if(IsNodePredicate(tree)) return tree;
+
+    int op = tree->cond.op;
+    Vector *conditions = NewVector(_Condition*, 2);
+    Vector *nodes = NewVector(FT_FilterNode*, 1);
+    _collectConditions(tree, op, conditions, nodes);
+
+    int count = Vector_Size(conditions);
+    _Condition *arr[count];
+    for(int i = 0; i < count; i++) {
+        Vector_Get(conditions, i, &arr[i]);
+        arr[i]->tree = _orderTree(gc, qg, arr[i]->tree);
+        arr[i]->selectivity = CostModel_FilterSelectivity(gc, qg, arr[i]->tree);
+    }
+
+    /* AND short circuits on the first failing condition,
+     * OR on the first passing condition. */
+    if(op == AND) {
+#define condition_lt(a, b) ((*a)->selectivity < (*b)->selectivity)
+        QSORT(_Condition*, arr, count, condition_lt);
+#undef condition_lt
+    } else {
+#define condition_gt(a, b) ((*a)->selectivity > (*b)->selectivity)
+        QSORT(_Condition*, arr, count, condition_gt);
+#undef condition_gt
+    }
+
+    // Rebuild a left deep tree, reusing condition nodes, evaluated left to right.
+    FT_FilterNode *root = arr[0]->tree;
+    for(int i = 1; i < count; i++) {
+        FT_FilterNode *node;
+        Vector_Get(nodes, i - 1, &node);
+        node->cond.left = root;
+        node->cond.right = arr[i]->tree;
+        root = node;
+    }
+
+    for(int i = 0; i < count; i++) free(arr[i]);
+    Vector_Free(conditions);
+    Vector_Free(nodes);
+    return root;
+}
+
+static void _orderFilters(const GraphContext *gc, const QueryGraph *qg, OpBase *op) {
+    if(op->type == OPType_FILTER) {
+        Filter *filter = (Filter*)op;
+        filter->filterTree = _orderTree(gc, qg, filter->filterTree);
+    }
+
+    for(int i = 0; i < op->childCount; i++) {
+        _orderFilters(gc, qg, op->children[i]);
+    }
+}
+
+void orderFilters(GraphContext *gc, ExecutionPlan *plan) {
+    _orderFilters(gc, plan->query_graph, plan->root);
+}
@@ -0,0 +1,19 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#ifndef __ORDER_FILTERS_H__
+#define __ORDER_FILTERS_H__
+
+#include "../execution_plan.h"
+
+/* The order filters optimizer reorders the conditions of each filter
+ * operation such that evaluation short circuits as early as possible,
+ * conditions ANDed together are evaluated most selective first,
+ * conditions ORed together are evaluated least selective first. */
+void orderFilters(GraphContext *gc, ExecutionPlan *plan);
+
+#endif
@@ -0,0 +1,199 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#include <strings.h>
+#include "reduce_count.h"
+#include "../ops/op_aggregate.h"
+#include "../ops/op_conditional_traverse.h"
+#include "../ops/op_all_node_scan.h"
+#include "../ops/op_node_by_label_scan.h"
+#include "../../arithmetic/arithmetic_expression.h"
+
+// Is alias one of the expression's ends.
+static Node* _patternNode(const AlgebraicExpression *ae, const char *alias) {
+    if(strcmp(alias, ae->src_node->alias) == 0) return ae->src_node;
+    if(strcmp(alias, ae->dest_node->alias) == 0) return ae->dest_node;
+    return NULL;
+}
+
+// Returns x if expression is of the form count(x), NULL otherwise.
+static const char* _countedAlias(const AR_ExpNode *exp) {
+    if(exp->type != AR_EXP_OP || exp->op.type != AR_OP_AGGREGATE) return NULL;
+    if(strcasecmp(exp->op.func_name, "count") != 0) return NULL;
+    if(exp->op.child_count != 1) return NULL;
+
+    const AR_ExpNode *arg = exp->op.children[0];
+    if(arg->type != AR_EXP_OPERAND || arg->operand.type != AR_EXP_VARIADIC) return NULL;
+    if(arg->operand.variadic.entity_prop != NULL) return NULL;
+    return arg->operand.variadic.entity_alias;
+}
+
+// Is expression of the form count(x), where x is either pattern end.
+static bool _countsPatternNode(const AR_ExpNode *exp, const AlgebraicExpression *ae) {
+    const char *alias = _countedAlias(exp);
+    return alias && _patternNode(ae, alias) != NULL;
+}
+
+/* Returns true if return clause consists of a single count(x) term,
+ * where x is one of the given aliases. */
+static bool _countsOnly(const AST_ReturnNode *ret, const char **aliases, int alias_count) {
+    if(Vector_Size(ret->returnElements) != 1) return false;
+
+    AST_ReturnElementNode *elem;
+    Vector_Get(ret->returnElements, 0, &elem);
+    AR_ExpNode *exp = AR_EXP_BuildFromAST(elem->exp);
+    const char *counted = _countedAlias(exp);
+
+    bool valid = false;
+    for(int i = 0; i < alias_count && counted && !valid; i++) {
+        valid = (aliases[i] && strcmp(counted, aliases[i]) == 0);
+    }
+
+    AR_EXP_Free(exp);
+    return valid;
+}
+
+/* Determines the node return terms are grouped by, which must be a
+ * pattern end, group is set to NULL when no grouping terms are specified.
+ * Returns false if return clause can't be evaluated by counting. */
+static bool _countGroup(const AST_ReturnNode *ret, const AlgebraicExpression *ae, Node **group) {
+    bool valid = true;
+    *group = NULL;
+
+    for(int i = 0; i < Vector_Size(ret->returnElements) && valid; i++) {
+        AST_ReturnElementNode *elem;
+        Vector_Get(ret->returnElements, i, &elem);
+        AR_ExpNode *exp = AR_EXP_BuildFromAST(elem->exp);
+
+        if(AR_EXP_ContainsAggregation(exp, NULL)) {
+            valid = _countsPatternNode(exp, ae);
+        } else {
+            // Grouping term must refer to a single pattern end.
+            TrieMap *aliases = NewTrieMap();
+            AR_EXP_CollectAliases(exp, aliases);
+            if(aliases->cardinality != 1) {
+                valid = false;
+            } else {
+                char *alias;
+                tm_len_t len;
+                void *value;
+                TrieMapIterator *it = TrieMap_Iterate(aliases, "", 0);
+                TrieMapIterator_Next(it, &alias, &len, &value);
+
+                char *key = strndup(alias, len);
+                Node *n = _patternNode(ae, key);
+                if(n == NULL || (*group && *group != n)) valid = false;
+                else *group = n;
+
+                free(key);
+                TrieMapIterator_Free(it);
+            }
+            TrieMap_Free(aliases, NULL);
+        }
+        AR_EXP_Free(exp);
+    }
+
+    return valid;
+}
+
+void reduceCount(GraphContext *gc, ExecutionPlan *plan) {
+    // Aggregate -> Conditional Traverse -> Scan
+    OpBase *root = plan->root;
+    if(root->type != OPType_AGGREGATE || root->childCount != 1) return;
+
+    OpBase *traverse = root->children[0];
+    if(traverse->type != OPType_CONDITIONAL_TRAVERSE || traverse->childCount != 1) return;
+
+    OpBase *scan = traverse->children[0];
+    if(scan->type != OPType_NODE_BY_LABEL_SCAN && scan->type != OPType_ALL_NODE_SCAN) return;
+
+    CondTraverse *condTraverse = (CondTraverse*)traverse;
+    AlgebraicExpression *ae = condTraverse->algebraic_expression;
+    // Traversal produces a record per edge, rather than per connected pair.
+    if(ae->edge) return;
+    if(condTraverse->closing_expression) return;
+
+    Aggregate *aggregate = (Aggregate*)root;
+    Node *group;
+    if(!_countGroup(aggregate->ast->returnNode, ae, &group)) return;
+
+    // Restore source label operand, replaced by label scan.
+    if(scan->type == OPType_NODE_BY_LABEL_SCAN) {
+        AlgebraicExpression_AppendTerm(ae, ae->src_node->mat, false, false);
+    }
+
+    ExecutionPlan_DetachOp(traverse);
+    OpBase_Free(scan);
+    OpBase_Free(traverse);
+
+    Aggregate_SetCountExpression(aggregate, gc->g, ae, group);
+}
+
+// MATCH (n:L) RETURN count(n)
+static bool _reduceNodeCount(GraphContext *gc, Aggregate *aggregate, OpBase *scan) {
+    Node *n;
+    int label = GRAPH_NO_LABEL;
+    if(scan->type == OPType_NODE_BY_LABEL_SCAN) {
+        n = ((NodeByLabelScan*)scan)->node;
+        label = GraphContext_GetLabelID(gc, n->label, STORE_NODE);
+        // Unknown label, leave it to the scan.
+        if(label == GRAPH_NO_LABEL) return false;
+    } else if(scan->type == OPType_ALL_NODE_SCAN) {
+        n = ((AllNodeScan*)scan)->node;
+    } else {
+        return false;
+    }
+
+    const char *aliases[1] = {n->alias};
+    if(!_countsOnly(aggregate->ast->returnNode, aliases, 1)) return false;
+
+    ExecutionPlan_DetachOp(scan);
+    OpBase_Free(scan);
+    Aggregate_SetEntityCount(aggregate, gc->g, STORE_NODE, label);
+    return true;
+}
+
+// MATCH ()-[e:R]->() RETURN count(e)
+static bool _reduceEdgeCount(GraphContext *gc, Aggregate *aggregate, OpBase *traverse) {
+    if(traverse->type != OPType_CONDITIONAL_TRAVERSE || traverse->childCount != 1) return false;
+    // Both ends must be unlabeled.
+    OpBase *scan = traverse->children[0];
+    if(scan->type != OPType_ALL_NODE_SCAN) return false;
+
+    CondTraverse *condTraverse = (CondTraverse*)traverse;
+    AlgebraicExpression *ae = condTraverse->algebraic_expression;
+    // A single relation operand, producing a record per edge.
+    if(!ae->edge || ae->operand_count != 1) return false;
+    if(condTraverse->closing_expression) return false;
+    if(ae->src_node == ae->dest_node) return false;
+
+    int relation = GRAPH_NO_RELATION;
+    if(ae->edge->relationship) {
+        relation = GraphContext_GetLabelID(gc, ae->edge->relationship, STORE_EDGE);
+        if(relation == GRAPH_NO_RELATION) return false;
+    }
+
+    // Each record holds an edge and its two ends, counting either is the same.
+    const char *aliases[3] = {ae->edge->alias, ae->src_node->alias, ae->dest_node->alias};
+    if(!_countsOnly(aggregate->ast->returnNode, aliases, 3)) return false;
+
+    ExecutionPlan_DetachOp(traverse);
+    OpBase_Free(scan);
+    OpBase_Free(traverse);
+    Aggregate_SetEntityCount(aggregate, gc->g, STORE_EDGE, relation);
+    return true;
+}
+
+void reduceEntityCount(GraphContext *gc, ExecutionPlan *plan) {
+    OpBase *root = plan->root;
+    if(root->type != OPType_AGGREGATE || root->childCount != 1) return;
+
+    Aggregate *aggregate = (Aggregate*)root;
+    OpBase *child = root->children[0];
+    if(child->childCount == 0) _reduceNodeCount(gc, aggregate, child);
+    else _reduceEdgeCount(gc, aggregate, child);
+}
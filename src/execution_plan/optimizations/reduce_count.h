@@ -0,0 +1,31 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#ifndef __REDUCE_COUNT_H__
+#define __REDUCE_COUNT_H__
+
+#include "../execution_plan.h"
+
+/* The reduce count optimizer looks for count aggregations over
+ * a single traversal, e.g.
+ * MATCH (a:Person)-[:KNOWS]->(b) RETURN count(b)
+ * MATCH (a:Person)-[:KNOWS]->(b) RETURN a.name, count(b)
+ * Rather than producing a record per traversed path, the traversal
+ * algebraic expression is evaluated once and counted, either entirely
+ * or reduced to a count per grouping node.
+ * The scan and traverse operations are removed from the plan. */
+void reduceCount(GraphContext *gc, ExecutionPlan *plan);
+
+/* The reduce entity count optimizer looks for counts of
+ * all nodes of a label or all edges of a relationship type, e.g.
+ * MATCH (n:Person) RETURN count(n)
+ * MATCH ()-[e:KNOWS]->() RETURN count(e)
+ * These are answered by the graph's node and edge counters,
+ * without scanning or traversing. */
+void reduceEntityCount(GraphContext *gc, ExecutionPlan *plan);
+
+#endif
@@ -0,0 +1,71 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#include "reduce_cycles.h"
+#include "cost_model.h"
+#include "../ops/op_expand_into.h"
+#include "../ops/op_conditional_traverse.h"
+
+static void _locateExpandInto(OpBase *root, Vector *ops) {
+    if(root->type == OPType_EXPAND_INTO) Vector_Push(ops, root);
+
+    for(int i = 0; i < root->childCount; i++) {
+        _locateExpandInto(root->children[i], ops);
+    }
+}
+
+/* Number of entries to transpose when evaluating closing expression
+ * from its destination. */
+static double _transposeCost(const AlgebraicExpression *closing) {
+    double cost = 0;
+    for(int i = 0; i < closing->operand_count; i++) {
+        const AlgebraicExpressionOperand *operand = closing->operands + i;
+        // Transposed operands will be used as is.
+        if(operand->transpose) continue;
+        // Label matrices are diagonal.
+        if(operand->operand == closing->src_node->mat) continue;
+        if(operand->operand == closing->dest_node->mat) continue;
+
+        GrB_Index nvals;
+        GrB_Matrix_nvals(&nvals, operand->operand);
+        cost += nvals;
+    }
+    return cost;
+}
+
+void reduceCycles(GraphContext *gc, ExecutionPlan *plan) {
+    Vector *ops = NewVector(OpBase*, 0);
+    _locateExpandInto(plan->root, ops);
+    bool reduced = false;
+
+    OpBase *op;
+    while(Vector_Pop(ops, &op)) {
+        ExpandInto *expandInto = (ExpandInto*)op;
+        AlgebraicExpression *closing = expandInto->algebraic_expression;
+        OpBase *child = expandInto->op.children[0];
+        if(child->type != OPType_CONDITIONAL_TRAVERSE) continue;
+
+        CondTraverse *traverse = (CondTraverse*)child;
+        // Each connecting edge is reported by expand into.
+        if(closing->edge) continue;
+        if(traverse->closing_expression) continue;
+        if(closing->operand_count == 0) continue;
+        if(closing->src_node == closing->dest_node) continue;
+        if(closing->src_node != traverse->algebraic_expression->dest_node) continue;
+
+        // Open paths, each inspected by expand into.
+        if(child->cardinality <= _transposeCost(closing)) continue;
+
+        CondTraverse_SetClosingExpression(traverse, closing);
+        ExecutionPlan_RemoveOp(op);
+        OpBase_Free(op);
+        reduced = true;
+    }
+
+    Vector_Free(ops);
+    if(reduced) CostModel_Estimate(gc, plan->query_graph, plan->root);
+}
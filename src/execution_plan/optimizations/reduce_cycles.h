@@ -0,0 +1,26 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#ifndef __REDUCE_CYCLES_H__
+#define __REDUCE_CYCLES_H__
+
+#include "../execution_plan.h"
+
+/* The reduce cycles optimizer looks for cyclic patterns, where a traversal
+ * is followed by an expand into closing the cycle, e.g. in
+ * MATCH (a)-[]->(b)-[]->(c)-[]->(a)
+ * c is reached by traversing from b, the expand into then discards
+ * every c not connected to a.
+ * Instead of enumerating each open path, the traversal intersects b's
+ * out-neighbors with a's in-neighbors, and the expand into is removed.
+ * As the intersection requires transposing the closing relation once,
+ * it is only applied when the number of open paths is estimated to
+ * exceed the number of closing edges.
+ * Requires operations cardinalities to be estimated. */
+void reduceCycles(GraphContext *gc, ExecutionPlan *plan);
+
+#endif
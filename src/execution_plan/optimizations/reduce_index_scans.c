@@ -0,0 +1,54 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#include "reduce_index_scans.h"
+#include "cost_model.h"
+#include "../ops/op_traverse.h"
+#include "../ops/op_index_scan.h"
+#include "../ops/op_conditional_traverse.h"
+
+static void _locateIndexScans(OpBase *root, Vector *ops) {
+    if(root->type == OPType_INDEX_SCAN) Vector_Push(ops, root);
+
+    for(int i = 0; i < root->childCount; i++) {
+        _locateIndexScans(root->children[i], ops);
+    }
+}
+
+void reduceIndexScans(GraphContext *gc, ExecutionPlan *plan) {
+    if(ResultSet_Limited(plan->result_set)) return;
+
+    Vector *ops = NewVector(OpBase*, 0);
+    _locateIndexScans(plan->root, ops);
+    bool reduced = false;
+
+    OpBase *op;
+    while(Vector_Pop(ops, &op)) {
+        IndexScan *scan = (IndexScan*)op;
+        OpBase *parent = op->parent;
+        if(parent == NULL || parent->type != OPType_CONDITIONAL_TRAVERSE) continue;
+
+        CondTraverse *traverse = (CondTraverse*)parent;
+        AlgebraicExpression *ae = traverse->algebraic_expression;
+        // Closing expression is evaluated per source node.
+        if(traverse->closing_expression) continue;
+        if(ae->src_node != scan->node) continue;
+
+        // Traversal takes over the scan's iterator.
+        OpBase *indexTraverse = NewIndexTraverseOp(traverse->graph, ae, scan->iter);
+        scan->iter = NULL;
+
+        ExecutionPlan_RemoveOp(op);
+        OpBase_Free(op);
+        ExecutionPlan_ReplaceOp(parent, indexTraverse);
+        OpBase_Free(parent);
+        reduced = true;
+    }
+
+    Vector_Free(ops);
+    if(reduced) CostModel_Estimate(gc, plan->query_graph, plan->root);
+}
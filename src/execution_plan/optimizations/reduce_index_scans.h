@@ -0,0 +1,24 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#ifndef __REDUCE_INDEX_SCANS_H__
+#define __REDUCE_INDEX_SCANS_H__
+
+#include "../execution_plan.h"
+
+/* The reduce index scans optimizer looks for traversals starting at
+ * nodes resolved by an index scan, e.g. in
+ * MATCH (a:L)-[]->(b) WHERE a.v > 10
+ * the index scan produces a record per matching a, each expanded by
+ * its own matrix multiplication.
+ * Instead, the index range is materialized as a diagonal filter matrix
+ * and the traversal expands all matching nodes by a single evaluation.
+ * Not applied to limited queries, which are better served by producing
+ * records as early as possible. */
+void reduceIndexScans(GraphContext *gc, ExecutionPlan *plan);
+
+#endif
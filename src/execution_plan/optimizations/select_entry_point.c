@@ -6,8 +6,18 @@
 */
 
 #include "./select_entry_point.h"
+#include "./cost_model.h"
+
+void selectEntryPoint(const GraphContext *gc, AlgebraicExpression *ae, const FT_FilterNode *tree) {
+    // Prefer scanning the node expected to produce fewer records.
+    double srcCost = CostModel_NodeScan(gc, ae->src_node, tree);
+    double destCost = CostModel_NodeScan(gc, ae->dest_node, tree);
+    if(srcCost < destCost) return;
+    if(destCost < srcCost) {
+        AlgebraicExpression_Transpose(ae);
+        return;
+    }
 
-void selectEntryPoint(AlgebraicExpression *ae, const FT_FilterNode *tree) {
     Vector *aliases = FilterTree_CollectAliases(tree);
     char *srcAlias = ae->src_node->alias;
     char *destAlias = ae->dest_node->alias;
@@ -29,13 +39,8 @@ void selectEntryPoint(AlgebraicExpression *ae, const FT_FilterNode *tree) {
         if(!destFiltered) destFiltered = (strcmp(alias, destAlias) == 0);
     }
 
-    /* Prefer filter over label 
+    /* Estimates are even, prefer filter over label 
      * if no filters are applied prefer labeled entity. */
-     
-    /* TODO: when additional statistics are available 
-     * do not use label scan if for every node N such that 
-     * (N)-[relation]->(T) N is of the same type T, and type of 
-     * either source or destination node is T. */
     if(destFiltered) {
         AlgebraicExpression_Transpose(ae);
     } else if(srcLabeled) {
@@ -8,6 +8,7 @@
 #ifndef __SELECT_ENTRY_POINT_H__
 #define __SELECT_ENTRY_POINT_H__
 
+#include "../../graph/graphcontext.h"
 #include "../../filter_tree/filter_tree.h"
 #include "../../arithmetic/algebraic_expression.h"
 
@@ -17,7 +18,9 @@
  * the rows of E have a filter applied to them 
  * and the columns of E aren't filtered.
  * As a result of transposing rows will be come columns
- * and we'll be able to perform filtering much quicker. */
-void selectEntryPoint(AlgebraicExpression *ae, const FT_FilterNode *tree);
+ * and we'll be able to perform filtering much quicker.
+ * When graph statistics are available, E is transposed if its
+ * destination node is estimated to be cheaper to scan than its source. */
+void selectEntryPoint(const GraphContext *gc, AlgebraicExpression *ae, const FT_FilterNode *tree);
 
 #endif
@@ -6,19 +6,35 @@
 */
 
 #include "./traverse_order.h"
+#include "./cost_model.h"
+#include "./select_entry_point.h"
 #include "../../util/vector.h"
 
+// Estimated number of records produced by scanning either end of exp.
+static double _entryPointCost(const GraphContext *gc, const AlgebraicExpression *exp,
+                              const FT_FilterNode *filterTree) {
+    double srcCost = CostModel_NodeScan(gc, exp->src_node, filterTree);
+    double destCost = CostModel_NodeScan(gc, exp->dest_node, filterTree);
+    return (srcCost < destCost) ? srcCost : destCost;
+}
+
 /* Given a set of algebraic expressions and the entire filter tree,
  * suggest traversal entry point to be either the first expression or the
- * last expression, in the future we'll want to be able to begin traversal from 
- * any expression. */
-TRAVERSE_ORDER determineTraverseOrder(const FT_FilterNode *filterTree,
+ * last expression. */
+TRAVERSE_ORDER determineTraverseOrder(const GraphContext *gc,
+                                      const FT_FilterNode *filterTree,
                                       AlgebraicExpression **exps,
                                       size_t expCount) {
 
-    if(expCount == 1 || !filterTree) {
-        return TRAVERSE_ORDER_FIRST;
-    }
+    if(expCount == 1) return TRAVERSE_ORDER_FIRST;
+
+    // Prefer the end estimated to produce fewer records.
+    double firstCost = _entryPointCost(gc, exps[0], filterTree);
+    double lastCost = _entryPointCost(gc, exps[expCount-1], filterTree);
+    if(firstCost < lastCost) return TRAVERSE_ORDER_FIRST;
+    if(lastCost < firstCost) return TRAVERSE_ORDER_LAST;
+
+    if(!filterTree) return TRAVERSE_ORDER_FIRST;
     
     char *destAlias;
     char *srcAlias;
@@ -77,3 +93,75 @@ cleanup:
     Vector_Free(aliases);
     return order;
 }
+
+// Estimated number of records produced by traversing exps, per source node.
+static double _chainExpand(const Graph *g, AlgebraicExpression **exps, size_t expCount) {
+    double expand = 1;
+    for(int i = 0; i < expCount; i++) expand *= CostModel_Expand(g, exps[i]);
+    return expand;
+}
+
+/* Locates the intermediate node estimated to be cheaper to scan than
+ * any of the nodes the first and last expressions connect,
+ * returns the index of the expression it is the source of, 0 if none. */
+static size_t _locatePivot(const GraphContext *gc, const FT_FilterNode *filterTree,
+                           AlgebraicExpression **exps, size_t expCount) {
+    if(expCount < 4) return 0;
+
+    double endCost = _entryPointCost(gc, exps[0], filterTree);
+    double lastCost = _entryPointCost(gc, exps[expCount-1], filterTree);
+    if(lastCost < endCost) endCost = lastCost;
+
+    size_t pivot = 0;
+    double pivotCost = endCost;
+    for(size_t i = 2; i < expCount-1; i++) {
+        double cost = CostModel_NodeScan(gc, exps[i]->src_node, filterTree);
+        if(cost < pivotCost) {
+            pivot = i;
+            pivotCost = cost;
+        }
+    }
+    return pivot;
+}
+
+void orderTraversal(const GraphContext *gc, const FT_FilterNode *filterTree,
+                    AlgebraicExpression **exps, size_t expCount) {
+
+    size_t pivot = _locatePivot(gc, filterTree, exps, expCount);
+    if(pivot) {
+        /* Split chain at pivot, expressions following pivot are traversed
+         * as is, expressions preceding it are transposed and traversed
+         * in reverse, both sub chains begin at pivot. */
+        AlgebraicExpression *backward[pivot];
+        AlgebraicExpression **forward = exps + pivot;
+        size_t forwardCount = expCount - pivot;
+        for(int i = 0; i < pivot; i++) {
+            backward[i] = exps[pivot-1-i];
+            AlgebraicExpression_Transpose(backward[i]);
+        }
+
+        // Traverse the sub chain expected to produce fewer records first.
+        const Graph *g = gc->g;
+        if(_chainExpand(g, backward, pivot) >= _chainExpand(g, forward, forwardCount)) {
+            memmove(exps, forward, sizeof(AlgebraicExpression*) * forwardCount);
+            memcpy(exps + forwardCount, backward, sizeof(AlgebraicExpression*) * pivot);
+        } else {
+            memcpy(exps, backward, sizeof(AlgebraicExpression*) * pivot);
+        }
+        return;
+    }
+
+    TRAVERSE_ORDER order = determineTraverseOrder(gc, filterTree, exps, expCount);
+    if(order == TRAVERSE_ORDER_LAST) {
+        /* Traverse pattern backwards, from its last expression
+         * to its first, transposing each expression. */
+        for(int i = 0; i < expCount; i++) AlgebraicExpression_Transpose(exps[i]);
+        for(int i = 0; i < expCount/2; i++) {
+            AlgebraicExpression *exp = exps[i];
+            exps[i] = exps[expCount-1-i];
+            exps[expCount-1-i] = exp;
+        }
+    }
+
+    selectEntryPoint(gc, exps[0], filterTree);
+}
@@ -20,9 +20,23 @@ typedef enum {
 /* Traverse order tries to determine which of the linear expressions should 
  * be used as the first traverse operation, we will prefer using an expression
  * which has a filter applied to it, as we wish to filter as early as we can,
- * that way we expect the number of entities inspected to be reduced at an early stage. */
-TRAVERSE_ORDER determineTraverseOrder(const FT_FilterNode *filterTree,
+ * that way we expect the number of entities inspected to be reduced at an early stage.
+ * When graph statistics are available, the expression whose end is estimated
+ * to be cheaper to scan is preferred. */
+TRAVERSE_ORDER determineTraverseOrder(const GraphContext *gc,
+                                      const FT_FilterNode *filterTree,
                                       AlgebraicExpression **exps,
                                       size_t expCount);
 
+/* Arranges exps for traversal, such that traversal begins by scanning
+ * the source node of the first expression.
+ * Traversal may begin at any node along the pattern: when an intermediate node
+ * is estimated to be cheaper to scan than either end, the pattern is split at it,
+ * expressions following it are traversed as is, expressions preceding it are
+ * transposed and traversed in reverse order. */
+void orderTraversal(const GraphContext *gc,
+                    const FT_FilterNode *filterTree,
+                    AlgebraicExpression **exps,
+                    size_t expCount);
+
 #endif
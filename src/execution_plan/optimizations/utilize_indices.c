@@ -1,5 +1,6 @@
 #include "utilize_indices.h"
 #include "../ops/op_index_scan.h"
+#include "./cost_model.h"
 
 /* Reverse an inequality symbol so that indices can support
  * inequalities with right-hand variables. */
@@ -18,10 +19,14 @@ int _reverseOp(int op) {
     }
 }
 
-void _locateScanFilters(NodeByLabelScan *scanOp, Vector *filterOps) {
-  /* We begin with a LabelScan, and want to find predicate filters that modify
-   * the active entity. */
-  OpBase *current = scanOp->op.parent;
+bool _stringOp(int op) {
+  return op == STARTS || op == ENDS || op == CONTAINS;
+}
+
+void _locateScanFilters(OpBase *scanOp, Vector *filterOps) {
+  /* We begin with a LabelScan (or a traversal resolving an edge), and want to find
+   * predicate filters that modify the active entity. */
+  OpBase *current = scanOp->parent;
   while(current->type == OPType_FILTER) {
     Filter *filterOp = (Filter*)current;
     FT_FilterNode *filterTree = filterOp->filterTree;
@@ -52,6 +57,191 @@ void _locateScanOp(OpBase *root, Vector *scanOps) {
   }
 }
 
+/* Checks whether filter tree ft is of the form:
+ * alias.property [rel] constant or
+ * constant [rel] alias.property
+ * If so, sets prop, constVal and op such that the relation reads
+ * property op constant. */
+bool _indexableFilter(FT_FilterNode *ft, const char *alias, char **prop, SIValue *constVal, int *op) {
+  int lhsType = AR_EXP_GetOperandType(ft->pred.lhs);
+  int rhsType = AR_EXP_GetOperandType(ft->pred.rhs);
+  AR_ExpNode *variadic;
+  if (lhsType == AR_EXP_VARIADIC && rhsType == AR_EXP_CONSTANT) {
+    variadic = ft->pred.lhs;
+    *constVal = ft->pred.rhs->operand.constant;
+    *op = ft->pred.op;
+  } else if (lhsType == AR_EXP_CONSTANT && rhsType == AR_EXP_VARIADIC) {
+    // String predicates are not symmetric, the property is required to be on the left.
+    if (_stringOp(ft->pred.op)) return false;
+    variadic = ft->pred.rhs;
+    *constVal = ft->pred.lhs->operand.constant;
+    // When the constant is on the left, reverse the relation in the inequality
+    // to properly set the bounds.
+    *op = _reverseOp(ft->pred.op);
+  } else {
+    return false;
+  }
+  // String predicates are resolved by the string skiplist and its trigrams.
+  if (_stringOp(*op) && constVal->type != T_STRING) return false;
+  // Trigrams of shorter substrings are unknown.
+  if ((*op == CONTAINS || *op == ENDS) && strlen(constVal->stringval) < TRIGRAM_LEN) return false;
+
+  *prop = variadic->operand.variadic.entity_prop;
+  if (strcmp(variadic->operand.variadic.entity_alias, alias)) return false;
+  return (*prop != NULL);
+}
+
+/* Picks the indexed property whose filters are estimated to pass
+ * the fewest entities, returns NULL if no filtered property is indexed. */
+Index* _selectIndex(GraphContext *gc, QueryGraph *qg, const char *label, const char *alias,
+                    LabelStoreType t, Vector *filterOps) {
+  int filterCount = Vector_Size(filterOps);
+  Index *indices[filterCount];
+  double selectivity[filterCount];
+  int indexCount = 0;
+
+  char *filterProp;
+  SIValue constVal;
+  int op;
+
+  for (int i = 0; i < filterCount; i++) {
+    OpBase *opFilter;
+    Vector_Get(filterOps, i, &opFilter);
+    FT_FilterNode *ft = ((Filter *)opFilter)->filterTree;
+    if (!_indexableFilter(ft, alias, &filterProp, &constVal, &op)) continue;
+
+    Index *idx = GraphContext_GetIndex(gc, label, filterProp, t);
+    if (!idx) continue;
+    // Substrings other than prefixes are only looked up through trigrams.
+    if ((op == CONTAINS || op == ENDS) && !idx->trigrams) continue;
+
+    // Filters on the same property combine into a single index range.
+    int j = 0;
+    while (j < indexCount && indices[j] != idx) j++;
+    if (j == indexCount) {
+      indices[indexCount] = idx;
+      selectivity[indexCount] = 1;
+      indexCount++;
+    }
+    selectivity[j] *= CostModel_FilterSelectivity(gc, qg, ft);
+  }
+
+  // Ties favor the first filtered index.
+  Index *selected = NULL;
+  double min = 0;
+  for (int i = 0; i < indexCount; i++) {
+    if (!selected || selectivity[i] < min) {
+      selected = indices[i];
+      min = selectivity[i];
+    }
+  }
+  return selected;
+}
+
+/* Builds an iterator over the selected index, folding in each filter on the
+ * indexed property, folded filters are removed from the execution plan. */
+IndexIter* _buildIndexIter(Index *idx, const char *alias, Vector *filterOps) {
+  IndexIter *iter = NULL;
+  char *filterProp = NULL;
+  SIValue constVal;
+  int op = 0;
+
+  for (int i = 0; i < Vector_Size(filterOps); i ++) {
+    OpBase *opFilter;
+    Vector_Get(filterOps, i, &opFilter);
+    FT_FilterNode *ft = ((Filter *)opFilter)->filterTree;
+    /* We'll only employ indices when we are comparing against a constant,
+     * otherwise we cannot pre-define useful bounds for the index iterator,
+     * which diminishes their utility. */
+    if (!_indexableFilter(ft, alias, &filterProp, &constVal, &op)) continue;
+
+    // Skip filters on properties other than the selected index.
+    if (strcmp(idx->property, filterProp)) continue;
+
+    if (!iter) iter = IndexIter_Create(idx, constVal.type);
+
+    // Tighten the iterator range if possible
+    if (IndexIter_ApplyBound(iter, &constVal, op)) {
+      // Remove filter operations that have been folded into the index scan iterator
+      ExecutionPlan_RemoveOp(opFilter);
+      OpBase_Free(opFilter);
+    }
+  }
+
+  return iter;
+}
+
+// Populate traverseOps vector with traversals of a single typed edge, starting at a scan.
+void _locateEdgeTraversals(OpBase *root, Vector *traverseOps) {
+  if (root->type == OPType_CONDITIONAL_TRAVERSE) {
+    OpBase *child = root->children[0];
+    if (child->type == OPType_ALL_NODE_SCAN || child->type == OPType_NODE_BY_LABEL_SCAN) {
+      Vector_Push(traverseOps, root);
+    }
+  }
+
+  for (int i = 0; i < root->childCount; i++) {
+    _locateEdgeTraversals(root->children[i], traverseOps);
+  }
+}
+
+/* Checks that the traversal resolves nothing but the typed edge and its labeled
+ * endpoints, e.g. (a:L)-[e:R]->(b), such that an edge index scan may replace it. */
+bool _edgeIndexable(CondTraverse *traverse) {
+  AlgebraicExpression *ae = traverse->algebraic_expression;
+  Edge *e = ae->edge;
+  if (!e || !e->relationship || ae->edgeLength) return false;
+  if (e->src == e->dest) return false;
+
+  OpBase *scan = traverse->op.children[0];
+  Node *scanned = (scan->type == OPType_ALL_NODE_SCAN) ?
+                  ((AllNodeScan*)scan)->node : ((NodeByLabelScan*)scan)->node;
+  if (scanned != ae->src_node) return false;
+
+  // Operands are limited to the relation matrix and endpoint labels.
+  int edgeOperands = 0;
+  for (int i = 0; i < ae->operand_count; i++) {
+    GrB_Matrix m = ae->operands[i].operand;
+    if (m == e->mat) edgeOperands++;
+    else if (m != ae->src_node->mat && m != ae->dest_node->mat) return false;
+  }
+  return (edgeOperands == 1);
+}
+
+/* Replaces a traversal, and the scan feeding it, with a scan of a
+ * relationship index, when the traversed edge is filtered on an indexed property. */
+void _utilizeRelationIndices(GraphContext *gc, ExecutionPlan *plan, Vector *filterOps) {
+  Vector *traverseOps = NewVector(CondTraverse*, 0);
+  _locateEdgeTraversals(plan->root, traverseOps);
+
+  CondTraverse *traverse;
+  while (Vector_Pop(traverseOps, &traverse)) {
+    if (!_edgeIndexable(traverse)) continue;
+
+    Edge *e = traverse->algebraic_expression->edge;
+    Vector_Clear(filterOps);
+    _locateScanFilters((OpBase*)traverse, filterOps);
+    if (Vector_Size(filterOps) == 0) continue;
+
+    Index *idx = _selectIndex(gc, plan->query_graph, e->relationship, e->alias, STORE_EDGE, filterOps);
+    if (!idx) continue;
+
+    IndexIter *iter = _buildIndexIter(idx, e->alias, filterOps);
+    if (iter == NULL) continue;
+
+    // Edge index scan resolves both the edge and its endpoints.
+    OpBase *scan = traverse->op.children[0];
+    ExecutionPlan_RemoveOp(scan);
+    OpBase_Free(scan);
+
+    OpBase *indexOp = NewEdgeIndexScanOp(traverse->graph, e, idx, iter);
+    ExecutionPlan_ReplaceOp((OpBase*)traverse, indexOp);
+    OpBase_Free((OpBase*)traverse);
+  }
+
+  Vector_Free(traverseOps);
+}
+
 void utilizeIndices(GraphContext *gc, ExecutionPlan *plan) {
   // Return immediately if the graph has no indices
   if (!GraphContext_HasIndices(gc)) return;
@@ -63,15 +253,8 @@ void utilizeIndices(GraphContext *gc, ExecutionPlan *plan) {
   // Collect all filters on scanned entities
   NodeByLabelScan *scanOp;
   Vector *filterOps = NewVector(OpBase*, 0);
-  FT_FilterNode *ft;
   char *label;
 
-  // Variables to be used when comparing filters against available indices
-  char *filterProp = NULL;
-  SIValue constVal;
-  int lhsType, rhsType;
-  int op = 0;
-
   while (Vector_Pop(scanOps, &scanOp)) {
     IndexIter *iter = NULL;
     Index *idx = NULL;
@@ -80,7 +263,7 @@ void utilizeIndices(GraphContext *gc, ExecutionPlan *plan) {
      * The label will be used to retrieve the index. */
     label = scanOp->node->label;
     Vector_Clear(filterOps);
-    _locateScanFilters(scanOp, filterOps);
+    _locateScanFilters((OpBase*)scanOp, filterOps);
 
     // No filters.
     if (Vector_Size(filterOps) == 0) continue;
@@ -89,52 +272,13 @@ void utilizeIndices(GraphContext *gc, ExecutionPlan *plan) {
      * with the scanned entity. If there are valid indices on any filter and no
      * equal or higher precedence OR filters, we can switch to an index scan.
      *
-     * We'll currently use the first matching index, but apply all the filters on
-     * that property. A later optimization would be to find the index with the
-     * most filters, or use some heuristic for trying to select the minimal range. */
-
-    for (int i = 0; i < Vector_Size(filterOps); i ++) {
-      OpBase *opFilter;
-      Vector_Get(filterOps, i, &opFilter);
-      ft = ((Filter *)opFilter)->filterTree;
-      /* We'll only employ indices when we have filters of the form:
-       * node.property [rel] constant or
-       * constant [rel] node.property
-       * If we are not comparing against a constant, then we cannot pre-define useful bounds
-       * for the index iterator, which diminishes their utility. */
-      lhsType = AR_EXP_GetOperandType(ft->pred.lhs);
-      rhsType = AR_EXP_GetOperandType(ft->pred.rhs);
-      if (lhsType == AR_EXP_VARIADIC && rhsType == AR_EXP_CONSTANT) {
-        filterProp = ft->pred.lhs->operand.variadic.entity_prop;
-        constVal = ft->pred.rhs->operand.constant;
-        op = ft->pred.op;
-      } else if (lhsType == AR_EXP_CONSTANT && rhsType == AR_EXP_VARIADIC) {
-        constVal = ft->pred.lhs->operand.constant;
-        filterProp = ft->pred.rhs->operand.variadic.entity_prop;
-        // When the constant is on the left, reverse the relation in the inequality
-        // to properly set the bounds.
-        op = _reverseOp(ft->pred.op);
-      } else {
-        continue;
-      }
-
-      // If we've already selected an index on a different property, continue
-      if (idx && strcmp(idx->property, filterProp)) continue;
-
-      // Try to retrieve an index if one has not been selected yet
-      if (!idx) {
-        idx = GraphContext_GetIndex(gc, label, filterProp);
-        if (!idx) continue;
-        iter = IndexIter_Create(idx, constVal.type);
-      }
-
-      // Tighten the iterator range if possible
-      if (IndexIter_ApplyBound(iter, &constVal, op)) {
-        // Remove filter operations that have been folded into the index scan iterator
-        ExecutionPlan_RemoveOp(opFilter);
-        OpBase_Free(opFilter);
-      }
-    }
+     * When several filtered properties are indexed, we'll use the index whose
+     * filters are estimated to be the most selective, and apply all the filters
+     * on that property. */
+    idx = _selectIndex(gc, plan->query_graph, label, scanOp->node->alias, STORE_NODE, filterOps);
+    if (!idx) continue;
+
+    iter = _buildIndexIter(idx, scanOp->node->alias, filterOps);
 
     if (iter != NULL) {
       OpBase *indexOp = NewIndexScanOp(scanOp->g, scanOp->node, iter);
@@ -142,8 +286,10 @@ void utilizeIndices(GraphContext *gc, ExecutionPlan *plan) {
     }
   }
 
+  // Traversals of edges filtered on an indexed property.
+  _utilizeRelationIndices(gc, plan, filterOps);
+
   // Cleanup
   Vector_Free(filterOps);
   Vector_Free(scanOps);
 }
-
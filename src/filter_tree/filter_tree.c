@@ -6,6 +6,7 @@
 */
 
 #include <assert.h>
+#include <string.h>
 #include "../value.h"
 #include "filter_tree.h"
 #include "../parser/grammar.h"
@@ -94,6 +95,24 @@ FT_FilterNode* BuildFiltersTree(const AST_FilterNode *root) {
     return filterNode;
 }
 
+/* Tests whether str starts with, ends with or contains sub. */
+int _applyStringFilter(const char *str, const char *sub, int op) {
+    size_t len = strlen(str);
+    size_t sub_len = strlen(sub);
+    if (sub_len > len) return 0;
+
+    switch(op) {
+        case STARTS:
+        return strncmp(str, sub, sub_len) == 0;
+
+        case ENDS:
+        return strcmp(str + len - sub_len, sub) == 0;
+
+        default:
+        return strstr(str, sub) != NULL;
+    }
+}
+
 /* Applies a single filter to a single result.
  * Compares given values, tests if values maintain desired relation (op) */
 int _applyFilter(SIValue* aVal, SIValue* bVal, int op) {
@@ -101,6 +120,15 @@ int _applyFilter(SIValue* aVal, SIValue* bVal, int op) {
     /* Always return false if values are not of comparable types. */
     if (!SI_COMPARABLE(*aVal, *bVal)) return 0;
 
+    /* String predicates, both sides are of the same type. */
+    switch(op) {
+        case STARTS:
+        case ENDS:
+        case CONTAINS:
+        if (aVal->type != T_STRING) return 0;
+        return _applyStringFilter(aVal->stringval, bVal->stringval, op);
+    }
+
     /* TODO Consider updating all logic around comparison routines */
     int rel = SIValue_Compare(*aVal, *bVal);
 
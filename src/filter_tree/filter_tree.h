@@ -27,7 +27,7 @@ struct FT_FilterNode;
 typedef struct {
 	AR_ExpNode *lhs;
 	AR_ExpNode *rhs;
-	int op;					/* Operation (<, <=, =, =>, >, !). */
+	int op;					/* Operation (<, <=, =, =>, >, !, STARTS WITH, ENDS WITH, CONTAINS). */
 } FT_PredicateNode;
 
 typedef struct {
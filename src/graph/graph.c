@@ -6,6 +6,7 @@
 */
 
 #include <assert.h>
+#include <string.h>
 
 #include "graph.h"
 #include "../util/arr.h"
@@ -62,38 +63,15 @@ size_t _Graph_EdgeCap(const Graph *g) {
     return g->edges->itemCap;
 }
 
-// Retrieve a relation mapping matrix coresponding to relation_idx
-// Make sure matrix is synchronized
-// TODO: it might be enough just to resize the relation mapping matrix
-// and avoid flushing other pendding changes to it, need to verify
-// if resize flush pendding changes.
-GrB_Matrix _Graph_GetRelationMap(const Graph *g, int relation_idx) {
-    assert(g && relation_idx >= 0 && relation_idx < array_len(g->_relations_map));
-
-    GrB_Matrix m = g->_relations_map[relation_idx];
-    g->SynchronizeMatrix(g, m);
-    return m;
-}
-
-// Create a new mapping matrix M,
-// M[I,J] holds the edge ID connecting node J to I (CSC format)
-// assuming _relations_map[K] holds mapping for relation K.
-void _Graph_AddRelationMap(Graph *g) {
-    GrB_Matrix mapper;
-    GrB_Info res = GrB_Matrix_new(&mapper, GrB_UINT64, Graph_RequiredMatrixDim(g), Graph_RequiredMatrixDim(g));
-    assert(res == GrB_SUCCESS);
-    g->_relations_map = array_append(g->_relations_map, mapper);
-}
-
 // Locates edge connecting src to destination.
 Entity* _Graph_GetEdgeConnectingNodes(const Graph *g, NodeID src, NodeID dest, int r) {
     assert(g && src < Graph_RequiredMatrixDim(g) && dest < Graph_RequiredMatrixDim(g) && r < Graph_RelationTypeCount(g));
 
-    // relation map, maps (src, dest, r) to edge id.
-    GrB_Matrix relationMap = _Graph_GetRelationMap(g, r);
+    // Relation matrix maps (src, dest) to edge id.
+    GrB_Matrix relation = Graph_GetRelationMatrix(g, r);
 
     EdgeID edgeId = 0;
-    GrB_Info res = GrB_Matrix_extractElement_UINT64(&edgeId, relationMap, dest, src);
+    GrB_Info res = GrB_Matrix_extractElement_UINT64(&edgeId, relation, dest, src);
     // No entry at [dest, src], src is not connected to dest with relation R.
     if(res == GrB_NO_VALUE) return NULL;
 
@@ -106,6 +84,37 @@ static inline Entity *_Graph_GetEntity(const DataBlock *entities, EntityID id) {
     return DataBlock_GetItem(entities, id);
 }
 
+/*============================ Degree functions ============================= */
+
+// Grows degree arrays to hold each node the graph can contain.
+static void _Graph_AccommodateDegrees(Graph *g) {
+    size_t cap = _Graph_NodeCap(g);
+    if(g->degree_cap >= cap) return;
+
+    size_t added = (cap - g->degree_cap) * sizeof(uint64_t);
+    g->in_degree = rm_realloc(g->in_degree, cap * sizeof(uint64_t));
+    g->out_degree = rm_realloc(g->out_degree, cap * sizeof(uint64_t));
+    memset(g->in_degree + g->degree_cap, 0, added);
+    memset(g->out_degree + g->degree_cap, 0, added);
+
+    for(int r = 0; r < array_len(g->relations); r++) {
+        g->relation_in_degree[r] = rm_realloc(g->relation_in_degree[r], cap * sizeof(uint64_t));
+        g->relation_out_degree[r] = rm_realloc(g->relation_out_degree[r], cap * sizeof(uint64_t));
+        memset(g->relation_in_degree[r] + g->degree_cap, 0, added);
+        memset(g->relation_out_degree[r] + g->degree_cap, 0, added);
+    }
+
+    g->degree_cap = cap;
+}
+
+// Updates degrees of edge's end nodes by delta.
+static inline void _Graph_UpdateDegrees(Graph *g, NodeID src, NodeID dest, int r, int delta) {
+    g->out_degree[src] += delta;
+    g->in_degree[dest] += delta;
+    g->relation_out_degree[r][src] += delta;
+    g->relation_in_degree[r][dest] += delta;
+}
+
 /*============= Matrix synchronization and resizing functions =============== */
 
 /* Resize given matrix, such that its number of row and columns
@@ -190,11 +199,6 @@ void Graph_ApplyAllPending(Graph *g) {
       M = g->relations[i];
       g->SynchronizeMatrix(g, M);
     }
-
-    for(int i = 0; i < array_len(g->_relations_map); i ++) {
-      M = g->_relations_map[i];
-      g->SynchronizeMatrix(g, M);
-    }
 }
 
 /*================================ Graph API ================================ */
@@ -207,7 +211,14 @@ Graph *Graph_New(size_t node_cap, size_t edge_cap) {
     g->edges = DataBlock_New(edge_cap, sizeof(Entity));
     g->labels = array_new(GrB_Matrix, GRAPH_DEFAULT_LABEL_CAP);
     g->relations = array_new(GrB_Matrix, GRAPH_DEFAULT_RELATION_TYPE_CAP);
-    g->_relations_map = array_new(GrB_Matrix, GRAPH_DEFAULT_RELATION_TYPE_CAP);
+    g->label_node_count = array_new(uint64_t, GRAPH_DEFAULT_LABEL_CAP);
+    g->relation_edge_count = array_new(uint64_t, GRAPH_DEFAULT_RELATION_TYPE_CAP);
+    g->degree_cap = 0;
+    g->in_degree = NULL;
+    g->out_degree = NULL;
+    g->relation_in_degree = array_new(uint64_t*, GRAPH_DEFAULT_RELATION_TYPE_CAP);
+    g->relation_out_degree = array_new(uint64_t*, GRAPH_DEFAULT_RELATION_TYPE_CAP);
+    _Graph_AccommodateDegrees(g);
     GrB_Matrix_new(&g->adjacency_matrix, GrB_BOOL, node_cap, node_cap);
 
     // Initialize a read-write lock scoped to the individual graph
@@ -243,6 +254,18 @@ size_t Graph_EdgeCount(const Graph *g) {
     return g->edges->itemCount;
 }
 
+size_t Graph_LabeledNodeCount(const Graph *g, int label) {
+    assert(g && label < Graph_LabelTypeCount(g));
+    if(label == GRAPH_NO_LABEL) return Graph_NodeCount(g);
+    return g->label_node_count[label];
+}
+
+size_t Graph_RelationEdgeCount(const Graph *g, int relation) {
+    assert(g && relation < Graph_RelationTypeCount(g));
+    if(relation == GRAPH_NO_RELATION) return Graph_EdgeCount(g);
+    return g->relation_edge_count[relation];
+}
+
 int Graph_RelationTypeCount(const Graph *g) {
     return array_len(g->relations);
 }
@@ -294,11 +317,11 @@ int Graph_GetEdgeRelation(const Graph *g, Edge *e) {
     NodeID srcNodeID = Edge_GetSrcNodeID(e);
     NodeID destNodeID = Edge_GetDestNodeID(e);
 
-    // Search for relation mapping matrix M, where
+    // Search for relation matrix M, where
     // M[dest,src] == edge ID.
-    for(int i = 0; i < array_len(g->_relations_map); i++) {
+    for(int i = 0; i < array_len(g->relations); i++) {
         EdgeID edgeId = 0;
-        GrB_Matrix M = _Graph_GetRelationMap(g, i);
+        GrB_Matrix M = Graph_GetRelationMatrix(g, i);
         GrB_Info res = GrB_Matrix_extractElement_UINT64(&edgeId, M, destNodeID, srcNodeID);
         if(res == GrB_SUCCESS && edgeId == ENTITY_GET_ID(e)) {
             Edge_SetRelationID(e, i);
@@ -350,6 +373,9 @@ void Graph_CreateNode(Graph* g, int label, Node *n) {
     NodeID id;
     Entity *en = DataBlock_AllocateItem(g->nodes, &id);
     en->id = id;
+    // Positions of deleted entities are reused, overwritten by a deletion marker.
+    en->prop_count = 0;
+    en->properties = NULL;
     n->entity = en;
 
     if(label != GRAPH_NO_LABEL) {
@@ -361,6 +387,7 @@ void Graph_CreateNode(Graph* g, int label, Node *n) {
             g->SynchronizeMatrix(g, m);
             assert(GrB_Matrix_setElement_BOOL(m, true, id, id) == GrB_SUCCESS);
         }
+        g->label_node_count[label]++;
     }
 }
 
@@ -374,23 +401,72 @@ int Graph_ConnectNodes(Graph *g, NodeID src, NodeID dest, int r, Edge *e) {
 
     GrB_Matrix relationMat = Graph_GetRelationMatrix(g, r);
     e->srcNodeID = src;
+    e->relationId = r;
     e->destNodeID = dest;
 
     EdgeID id;
     Entity *en = DataBlock_AllocateItem(g->edges, &id);
     en->id = id;
+    // Positions of deleted entities are reused, overwritten by a deletion marker.
+    en->prop_count = 0;
+    en->properties = NULL;
     e->entity = en;
 
     GrB_Matrix adj = Graph_GetAdjacencyMatrix(g);
-    GrB_Matrix relationMapMat = _Graph_GetRelationMap(g, r);
 
     // Columns represent source nodes, rows represent destination nodes.
+    // Relation matrix entries hold the ID of the connecting edge.
     GrB_Matrix_setElement_BOOL(adj, true, dest, src);
-    GrB_Matrix_setElement_BOOL(relationMat, true, dest, src);
-    GrB_Matrix_setElement_UINT64(relationMapMat, id, dest, src);
+    GrB_Matrix_setElement_UINT64(relationMat, id, dest, src);
+    g->relation_edge_count[r]++;
+
+    _Graph_AccommodateDegrees(g);
+    _Graph_UpdateDegrees(g, src, dest, r, 1);
     return 1;
 }
 
+uint64_t Graph_GetNodeDegree(const Graph *g, NodeID id, GRAPH_EDGE_DIR dir, int relation) {
+    assert(g && relation < Graph_RelationTypeCount(g));
+    // Node was never connected.
+    if(id >= g->degree_cap) return 0;
+
+    uint64_t *in = g->in_degree;
+    uint64_t *out = g->out_degree;
+    if(relation != GRAPH_NO_RELATION) {
+        in = g->relation_in_degree[relation];
+        out = g->relation_out_degree[relation];
+    }
+
+    uint64_t degree = 0;
+    if(dir == GRAPH_EDGE_DIR_INCOMING || dir == GRAPH_EDGE_DIR_BOTH) degree += in[id];
+    if(dir == GRAPH_EDGE_DIR_OUTGOING || dir == GRAPH_EDGE_DIR_BOTH) degree += out[id];
+    return degree;
+}
+
+GrB_Vector Graph_GetDegreeVector(const Graph *g, GRAPH_EDGE_DIR dir, int relation) {
+    assert(g);
+    size_t n = Graph_RequiredMatrixDim(g);
+    size_t nvals = 0;
+    GrB_Index *ids = rm_malloc(sizeof(GrB_Index) * n);
+    uint64_t *degrees = rm_malloc(sizeof(uint64_t) * n);
+
+    for(NodeID id = 0; id < n; id++) {
+        uint64_t degree = Graph_GetNodeDegree(g, id, dir, relation);
+        if(degree == 0) continue;
+        ids[nvals] = id;
+        degrees[nvals] = degree;
+        nvals++;
+    }
+
+    GrB_Vector v;
+    GrB_Vector_new(&v, GrB_UINT64, n);
+    GrB_Vector_build_UINT64(v, ids, degrees, nvals, GrB_FIRST_UINT64);
+
+    rm_free(ids);
+    rm_free(degrees);
+    return v;
+}
+
 /* Retrieves all either incoming or outgoing edges 
  * to/from given node N, depending on given direction. */
 void Graph_GetNodeEdges(const Graph *g, const Node *n, GRAPH_EDGE_DIR dir, int edgeType, Edge **edges) {
@@ -437,76 +513,197 @@ void Graph_GetNodeEdges(const Graph *g, const Node *n, GRAPH_EDGE_DIR dir, int e
     }
 }
 
-/* Removes an edge from Graph and updates graph relevent matrices. */
-int Graph_DeleteEdge(Graph *g, Edge *e) {
-    GrB_Matrix M;
-    GrB_Info res;
-    int r = Edge_GetRelationID(e);
-    NodeID src_id = Edge_GetSrcNodeID(e);
-    NodeID dest_id = Edge_GetDestNodeID(e);
-    M = Graph_GetRelationMatrix(g, r);
-
-    // Test to see if edge exists.
-    bool x = false;
-    GrB_Matrix_extractElement_BOOL(&x, M, dest_id, src_id);
-    if(!x) return 0;
-
-    res = GxB_Matrix_Delete(M, dest_id, src_id);
-    assert(res == GrB_SUCCESS);
-
-    M = _Graph_GetRelationMap(g, r);
-    res = GxB_Matrix_Delete(M, dest_id, src_id);
-    assert(res == GrB_SUCCESS);
-
-    // See if source is connected to destination with additional edges.
-    bool connected = false;
-    int relationCount = Graph_RelationTypeCount(g);
-    for(int i = 0; i < relationCount; i++) {
-        M = Graph_GetRelationMatrix(g, i);
-        GrB_Matrix_extractElement_BOOL(&connected, M, dest_id, src_id);
-        if(connected) break;
+#define EDGE_ID_ISLT(a,b) (ENTITY_GET_ID(a) < ENTITY_GET_ID(b))
+
+/* Sorts entity IDs and removes duplicates, returns number of unique IDs. */
+static size_t _Graph_SortUniqueIDs(EntityID *ids, size_t count) {
+    if(count == 0) return 0;
+    QSORT(EntityID, ids, count, ENTITY_ID_ISLT);
+    size_t j = 0;
+    for(size_t i = 1; i < count; i++) {
+        if(ids[i] != ids[j]) ids[++j] = ids[i];
     }
+    return j+1;
+}
 
-    /* There are no additional edges connecting source to destination
-     * Remove edge from THE adjacency matrix. */
-    if(!connected) {
-        M = Graph_GetAdjacencyMatrix(g);
-        res = GxB_Matrix_Delete(M, dest_id, src_id);
+/* Sorts edges by ID and removes duplicates, returns number of unique edges. */
+static size_t _Graph_SortUniqueEdges(Edge *edges, size_t count) {
+    if(count == 0) return 0;
+    QSORT(Edge, edges, count, EDGE_ID_ISLT);
+    size_t j = 0;
+    for(size_t i = 1; i < count; i++) {
+        if(ENTITY_GET_ID(edges+i) != ENTITY_GET_ID(edges+j)) edges[++j] = edges[i];
     }
+    return j+1;
+}
 
-    // Free and remove edges from datablock.
-    FreeEntity(e->entity);
-    DataBlock_DeleteItem(g->edges, ENTITY_GET_ID(e));
-    return 1;
+static inline bool _Graph_IDInSortedSet(const EntityID *ids, size_t count, EntityID id) {
+    size_t lo = 0;
+    size_t hi = count;
+    while(lo < hi) {
+        size_t mid = (lo + hi) / 2;
+        if(ids[mid] == id) return true;
+        if(ids[mid] < id) lo = mid + 1;
+        else hi = mid;
+    }
+    return false;
 }
 
-int Graph_DeleteNode(Graph *g, Node *n) {
-    assert(g && n);
-    
-    // Check to see if indeed node exists.
-    if(!DataBlock_GetItem(g->nodes, ENTITY_GET_ID(n))) return 0;
+void Graph_BulkDelete(Graph *g, Node *nodes, size_t node_count, Edge *edges,
+                      size_t edge_count, size_t *node_deleted, size_t *edge_deleted) {
+    assert(g && node_deleted && edge_deleted);
 
-    // Delete incoming/outgoing edges of deleted node.
-    Edge *e = NULL;
-    Edge *edges = array_new(Edge, 32);
+    //--------------------------------------------------------------------------
+    // Collect unique, existing nodes and edges.
+    //--------------------------------------------------------------------------
 
-    Graph_GetNodeEdges(g, n, GRAPH_EDGE_DIR_BOTH, GRAPH_NO_RELATION, &edges);
-    uint32_t edgeCount = array_len(edges);
-    for(int j = 0; j < edgeCount; j++) Graph_DeleteEdge(g, edges+j);
+    EntityID *nodeIDs = array_new(EntityID, node_count);
+    for(size_t i = 0; i < node_count; i++) {
+        EntityID id = ENTITY_GET_ID(nodes+i);
+        if(DataBlock_GetItem(g->nodes, id)) nodeIDs = array_append(nodeIDs, id);
+    }
+    size_t nodeCount = _Graph_SortUniqueIDs(nodeIDs, array_len(nodeIDs));
+
+    Edge *removed = array_new(Edge, edge_count);
+    for(size_t i = 0; i < edge_count; i++) {
+        Edge *e = edges+i;
+        if(!DataBlock_GetItem(g->edges, ENTITY_GET_ID(e))) continue;
+        if(Edge_GetRelationID(e) == GRAPH_NO_RELATION) Graph_GetEdgeRelation(g, e);
+        removed = array_append(removed, *e);
+    }
+    size_t explicitEdgeCount = _Graph_SortUniqueEdges(removed, array_len(removed));
+    array_trimm_len(removed, explicitEdgeCount);
 
-    // Clear label matrix at position node ID.
-    uint32_t label_count = array_len(g->labels);
-    for(int i = 0; i < label_count; i++) {
-        GrB_Matrix M = Graph_GetLabel(g, i);
-        GxB_Matrix_Delete(M, ENTITY_GET_ID(n), ENTITY_GET_ID(n));
+    //--------------------------------------------------------------------------
+    // Clear explicitly deleted edges, connecting surviving nodes.
+    //--------------------------------------------------------------------------
+
+    /* Edges attached to a deleted node are removed from the matrices
+     * once their node's row and column are cleared. */
+    int relationCount = Graph_RelationTypeCount(g);
+    GrB_Index *rows = array_new(GrB_Index, explicitEdgeCount);
+    GrB_Index *cols = array_new(GrB_Index, explicitEdgeCount);
+
+    for(int r = 0; r < relationCount; r++) {
+        array_clear(rows);
+        array_clear(cols);
+        for(size_t i = 0; i < explicitEdgeCount; i++) {
+            Edge *e = removed+i;
+            if(Edge_GetRelationID(e) != r) continue;
+            NodeID src = Edge_GetSrcNodeID(e);
+            NodeID dest = Edge_GetDestNodeID(e);
+            if(_Graph_IDInSortedSet(nodeIDs, nodeCount, src) ||
+               _Graph_IDInSortedSet(nodeIDs, nodeCount, dest)) continue;
+            rows = array_append(rows, dest);
+            cols = array_append(cols, src);
+        }
+        GrB_Matrix R = Graph_GetRelationMatrix(g, r);
+        assert(GxB_Matrix_Delete_Batch(R, rows, cols, array_len(rows)) == GrB_SUCCESS);
     }
 
-    FreeEntity(n->entity);
-    DataBlock_DeleteItem(g->nodes, ENTITY_GET_ID(n));
+    /* Remove adjacency matrix entries of source and destination nodes
+     * which are no longer connected by any relation. */
+    array_clear(rows);
+    array_clear(cols);
+    for(size_t i = 0; i < explicitEdgeCount; i++) {
+        Edge *e = removed+i;
+        NodeID src = Edge_GetSrcNodeID(e);
+        NodeID dest = Edge_GetDestNodeID(e);
+        if(_Graph_IDInSortedSet(nodeIDs, nodeCount, src) ||
+           _Graph_IDInSortedSet(nodeIDs, nodeCount, dest)) continue;
+
+        bool connected = false;
+        for(int r = 0; r < relationCount && !connected; r++) {
+            EdgeID id;
+            GrB_Matrix R = Graph_GetRelationMatrix(g, r);
+            connected = (GrB_Matrix_extractElement_UINT64(&id, R, dest, src) == GrB_SUCCESS);
+        }
+        if(!connected) {
+            rows = array_append(rows, dest);
+            cols = array_append(cols, src);
+        }
+    }
+    GrB_Matrix adj = Graph_GetAdjacencyMatrix(g);
+    assert(GxB_Matrix_Delete_Batch(adj, rows, cols, array_len(rows)) == GrB_SUCCESS);
+
+    //--------------------------------------------------------------------------
+    // Clear deleted nodes.
+    //--------------------------------------------------------------------------
+
+    if(nodeCount > 0) {
+        // Collect edges attached to deleted nodes.
+        Node n;
+        for(size_t i = 0; i < nodeCount; i++) {
+            Graph_GetNode(g, nodeIDs[i], &n);
+            Graph_GetNodeEdges(g, &n, GRAPH_EDGE_DIR_BOTH, GRAPH_NO_RELATION, &removed);
+        }
+
+        // Clear rows and columns of deleted nodes.
+        assert(GxB_Matrix_Delete_RowsCols(adj, nodeIDs, nodeCount) == GrB_SUCCESS);
+        for(int r = 0; r < relationCount; r++) {
+            GrB_Matrix R = Graph_GetRelationMatrix(g, r);
+            assert(GxB_Matrix_Delete_RowsCols(R, nodeIDs, nodeCount) == GrB_SUCCESS);
+        }
+
+        // Update label statistics, prior to clearing label matrices.
+        for(size_t i = 0; i < nodeCount; i++) {
+            int l = Graph_GetNodeLabel(g, nodeIDs[i]);
+            if(l != GRAPH_NO_LABEL) g->label_node_count[l]--;
+        }
+
+        // Clear label matrices diagonal at deleted nodes positions.
+        uint32_t labelCount = array_len(g->labels);
+        for(int l = 0; l < labelCount; l++) {
+            GrB_Matrix L = Graph_GetLabel(g, l);
+            assert(GxB_Matrix_Delete_Batch(L, nodeIDs, nodeIDs, nodeCount) == GrB_SUCCESS);
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // Free and remove entities from datablocks.
+    //--------------------------------------------------------------------------
+
+    size_t removedCount = _Graph_SortUniqueEdges(removed, array_len(removed));
+    for(size_t i = 0; i < removedCount; i++) {
+        Edge *e = removed+i;
+        EdgeID id = ENTITY_GET_ID(e);
+        int r = Edge_GetRelationID(e);
+        g->relation_edge_count[r]--;
+        _Graph_UpdateDegrees(g, Edge_GetSrcNodeID(e), Edge_GetDestNodeID(e), r, -1);
+        FreeEntity(e->entity);
+        DataBlock_DeleteItem(g->edges, id);
+    }
+
+    for(size_t i = 0; i < nodeCount; i++) {
+        Entity *en = DataBlock_GetItem(g->nodes, nodeIDs[i]);
+        FreeEntity(en);
+        DataBlock_DeleteItem(g->nodes, nodeIDs[i]);
+    }
+
+    *node_deleted = nodeCount;
+    *edge_deleted = explicitEdgeCount;
 
     // Cleanup.
-    array_free(edges);
-    return 1;
+    array_free(rows);
+    array_free(cols);
+    array_free(removed);
+    array_free(nodeIDs);
+}
+
+/* Removes an edge from Graph and updates graph relevent matrices. */
+int Graph_DeleteEdge(Graph *g, Edge *e) {
+    size_t node_deleted;
+    size_t edge_deleted;
+    Graph_BulkDelete(g, NULL, 0, e, 1, &node_deleted, &edge_deleted);
+    return edge_deleted;
+}
+
+int Graph_DeleteNode(Graph *g, Node *n) {
+    assert(g && n);
+    size_t node_deleted;
+    size_t edge_deleted;
+    Graph_BulkDelete(g, n, 1, NULL, 0, &node_deleted, &edge_deleted);
+    return node_deleted;
 }
 
 DataBlockIterator *Graph_ScanNodes(const Graph *g) {
@@ -525,20 +722,22 @@ int Graph_AddLabel(Graph *g) {
     GrB_Matrix m;
     GrB_Matrix_new(&m, GrB_BOOL, Graph_RequiredMatrixDim(g), Graph_RequiredMatrixDim(g));
     array_append(g->labels, m);
+    g->label_node_count = array_append(g->label_node_count, 0);
     return array_len(g->labels)-1;
 }
 
 int Graph_AddRelationType(Graph *g) {
     assert(g);
 
+    /* Relation matrix M, M[I,J] holds the edge ID connecting node J to I (CSC format),
+     * traversals only consider the matrix structure. */
     GrB_Matrix m;
-    GrB_Matrix_new(&m, GrB_BOOL, Graph_RequiredMatrixDim(g), Graph_RequiredMatrixDim(g));
+    GrB_Matrix_new(&m, GrB_UINT64, Graph_RequiredMatrixDim(g), Graph_RequiredMatrixDim(g));
     g->relations = array_append(g->relations, m);
+    g->relation_edge_count = array_append(g->relation_edge_count, 0);
+    g->relation_in_degree = array_append(g->relation_in_degree, rm_calloc(g->degree_cap, sizeof(uint64_t)));
+    g->relation_out_degree = array_append(g->relation_out_degree, rm_calloc(g->degree_cap, sizeof(uint64_t)));
 
-    _Graph_AddRelationMap(g);
-
-    // Edge mapping for relation K is at _relations_map[K].
-    assert(array_len(g->_relations_map) == Graph_RelationTypeCount(g));
     int relationID = Graph_RelationTypeCount(g)-1;
     return relationID;
 }
@@ -583,11 +782,14 @@ void Graph_Free(Graph *g) {
     for(int i = 0; i < relationCount; i++) {
         m = g->relations[i];
         GrB_Matrix_free(&m);
-        m = g->_relations_map[i];
-        GrB_Matrix_free(&m);
+        rm_free(g->relation_in_degree[i]);
+        rm_free(g->relation_out_degree[i]);
     }
     array_free(g->relations);
-    array_free(g->_relations_map);
+    array_free(g->relation_in_degree);
+    array_free(g->relation_out_degree);
+    rm_free(g->in_degree);
+    rm_free(g->out_degree);
 
     uint32_t labelCount = array_len(g->labels);
     for(int i = 0; i < labelCount; i++) {
@@ -595,6 +797,8 @@ void Graph_Free(Graph *g) {
         GrB_Matrix_free(&m);
     }
     array_free(g->labels);
+    array_free(g->label_node_count);
+    array_free(g->relation_edge_count);
 
     it = Graph_ScanNodes(g);
     while ((en = (Entity*)DataBlockIterator_Next(it)) != NULL)
@@ -48,8 +48,14 @@ struct Graph {
     DataBlock *edges;                   // Graph edges stored in blocks.
     GrB_Matrix adjacency_matrix;        // Adjacency matrix, holds all graph connections.
     GrB_Matrix *labels;                 // Label matrices.
-    GrB_Matrix *relations;              // Relation matrices.
-    GrB_Matrix *_relations_map;         // Maps from (relation, row, col) to edge id.
+    GrB_Matrix *relations;              // Relation matrices, R[dest, src] holds the connecting edge ID.
+    uint64_t *label_node_count;         // Number of nodes per label.
+    uint64_t *relation_edge_count;      // Number of edges per relation type.
+    size_t degree_cap;                  // Number of nodes degree arrays can hold.
+    uint64_t *in_degree;                // Number of incoming edges per node.
+    uint64_t *out_degree;               // Number of outgoing edges per node.
+    uint64_t **relation_in_degree;      // Per relation type, number of incoming edges per node.
+    uint64_t **relation_out_degree;     // Per relation type, number of outgoing edges per node.
     pthread_mutex_t _mutex;             // Mutex for accessing critical sections.
     pthread_rwlock_t _rwlock;           // Read-write lock scoped to this specific graph
     bool _writelocked;                  // true if the read-write lock was acquired by a writer
@@ -131,6 +137,19 @@ int Graph_DeleteEdge (
     Edge *e
 );
 
+// Removes nodes and edges from the graph in bulk, nodes are removed
+// along with all of their incoming and outgoing edges.
+// Each matrix is updated once, regardless of the number of entities removed.
+void Graph_BulkDelete (
+    Graph *g,               // Graph to delete entities from.
+    Node *nodes,            // Nodes to delete.
+    size_t node_count,      // Number of nodes to delete.
+    Edge *edges,            // Edges to delete.
+    size_t edge_count,      // Number of edges to delete.
+    size_t *node_deleted,   // Number of nodes removed.
+    size_t *edge_deleted    // Number of edges removed, excluding implicitly removed edges.
+);
+
 // All graph matrices are required to be squared NXN
 // where N is Graph_RequiredMatrixDim.
 size_t Graph_RequiredMatrixDim (
@@ -159,6 +178,20 @@ size_t Graph_EdgeCount (
     const Graph *g
 );
 
+// Returns number of nodes with given label,
+// GRAPH_NO_LABEL counts all nodes.
+size_t Graph_LabeledNodeCount (
+    const Graph *g,
+    int label
+);
+
+// Returns number of edges of given relation type,
+// GRAPH_NO_RELATION counts all edges.
+size_t Graph_RelationEdgeCount (
+    const Graph *g,
+    int relation
+);
+
 // Returns number of different edge types.
 int Graph_RelationTypeCount (
     const Graph *g
@@ -209,6 +242,24 @@ void Graph_GetEdgesConnectingNodes (
     Edge **edges        // array_t of edges connecting src to dest of type r.
 );
 
+// Returns number of edges of given relation type connected to node,
+// GRAPH_NO_RELATION counts edges of all types,
+// GRAPH_EDGE_DIR_BOTH sums incoming and outgoing edges.
+uint64_t Graph_GetNodeDegree (
+    const Graph *g,         // Graph to get degree from.
+    NodeID id,              // Node ID.
+    GRAPH_EDGE_DIR dir,     // Edge direction.
+    int relation            // Relation type.
+);
+
+// Builds a vector holding the degree of each node
+// connected by at least one edge, V[id] = degree.
+GrB_Vector Graph_GetDegreeVector (
+    const Graph *g,         // Graph to get degrees from.
+    GRAPH_EDGE_DIR dir,     // Edge direction.
+    int relation            // Relation type.
+);
+
 // Get node edges.
 void Graph_GetNodeEdges (
     const Graph *g,         // Graph to get edges from.
@@ -1,16 +1,31 @@
 #include <sys/param.h>
 #include "graphcontext.h"
 #include "serializers/graphcontext_type.h"
+#include "../util/arr.h"
 #include "../util/rmalloc.h"
 
+// Source of schema versions, shared by all graphs such that a recreated
+// graph never reuses the version of a deleted graph with the same name.
+static uint64_t _schema_clock = 0;
+
 //------------------------------------------------------------------------------
 // Private functions
 //------------------------------------------------------------------------------
-int _GraphContext_IndexOffset(const GraphContext *gc, const char *label, const char *property) {
+int _GraphContext_IndexOffset(const GraphContext *gc, const char *label, const char *property,
+                              LabelStoreType t) {
   Index *idx;
   for (int i = 0; i < gc->index_count; i ++) {
     idx = gc->indices[i];
-    if (!strcmp(label, idx->label) && !strcmp(property, idx->property)) return i;
+    if (idx->entity_type == t && !strcmp(label, idx->label) && !strcmp(property, idx->property)) return i;
+  }
+  return -1;
+}
+
+int _GraphContext_StatsOffset(const GraphContext *gc, const char *label, const char *property) {
+  PropertyStats *stats;
+  for (int i = 0; i < gc->stats_count; i ++) {
+    stats = gc->stats[i];
+    if (!strcmp(label, stats->label) && !strcmp(property, stats->property)) return i;
   }
   return -1;
 }
@@ -37,6 +52,10 @@ GraphContext* GraphContext_New(RedisModuleCtx *ctx, RedisModuleString *rs_name,
   gc->label_count = 0;
   gc->index_cap = DEFAULT_INDEX_CAP;
   gc->index_count = 0;
+  gc->stats_cap = 0;
+  gc->stats_count = 0;
+  gc->stats = NULL;
+  gc->read_only = false;
 
   // Initialize the graph's matrices and datablock storage
   gc->g = Graph_New(node_cap, edge_cap);
@@ -50,6 +69,7 @@ GraphContext* GraphContext_New(RedisModuleCtx *ctx, RedisModuleString *rs_name,
   // Initialize the generic label and relation stores
   gc->node_allstore = LabelStore_New("ALL", GRAPH_NO_LABEL);
   gc->relation_allstore = LabelStore_New("ALL", GRAPH_NO_RELATION);
+  GraphContext_UpdateSchemaVersion(gc);
 
   // Set and close GraphContext key in Redis keyspace
   RedisModule_ModuleTypeSetValue(key, GraphContextRedisModuleType, gc);
@@ -73,6 +93,17 @@ GraphContext* GraphContext_Retrieve(RedisModuleCtx *ctx, RedisModuleString *rs_n
   return gc;
 }
 
+// Graph accessed by the query running on this thread
+static __thread GraphContext *_tls_gc = NULL;
+
+void GraphContext_SetTLS(GraphContext *gc) {
+  _tls_gc = gc;
+}
+
+GraphContext* GraphContext_GetFromTLS(void) {
+  return _tls_gc;
+}
+
 //------------------------------------------------------------------------------
 // LabelStore API
 //------------------------------------------------------------------------------
@@ -123,6 +154,7 @@ LabelStore* GraphContext_AddLabel(GraphContext *gc, const char *label) {
   LabelStore *store = LabelStore_New(label, gc->label_count);
   gc->node_stores[gc->label_count] = store;
   gc->label_count++;
+  GraphContext_UpdateSchemaVersion(gc);
 
   return store;
 }
@@ -140,6 +172,7 @@ LabelStore* GraphContext_AddRelationType(GraphContext *gc, const char *label) {
   LabelStore *store = LabelStore_New(label, gc->relation_count);
   gc->relation_stores[gc->relation_count] = store;
   gc->relation_count++;
+  GraphContext_UpdateSchemaVersion(gc);
 
   return store;
 }
@@ -151,33 +184,38 @@ bool GraphContext_HasIndices(GraphContext *gc) {
   return gc->index_count > 0;
 }
 
-Index* GraphContext_GetIndex(const GraphContext *gc, const char *label, const char *property) {
-  int offset = _GraphContext_IndexOffset(gc, label, property);
+Index* GraphContext_GetIndex(const GraphContext *gc, const char *label, const char *property,
+                             LabelStoreType t) {
+  int offset = _GraphContext_IndexOffset(gc, label, property, t);
   if (offset < 0) return INDEX_FAIL;
 
   return gc->indices[offset];
 }
 
-int GraphContext_AddIndex(GraphContext *gc, const char *label, const char *property) {
+int GraphContext_AddIndex(GraphContext *gc, const char *label, const char *property, LabelStoreType t,
+                          bool trigrams) {
   if(gc->index_count == gc->index_cap) {
     gc->index_cap += 4;
     gc->indices = rm_realloc(gc->indices, gc->index_cap * sizeof(Index*));
   }
 
-  // Find the ID of the specified label
-  int label_id = GraphContext_GetLabelID(gc, label, STORE_NODE);
+  // Find the ID of the specified label or relationship type
+  int label_id = GraphContext_GetLabelID(gc, label, t);
   if (label_id < 0 ) return INDEX_FAIL;
 
   // Populate an index for the label-property pair using the Graph interfaces.
-  Index *idx = Index_Create(gc->g, label_id, label, property);
+  Index *idx;
+  if (t == STORE_NODE) idx = Index_Create(gc->g, label_id, label, property, trigrams);
+  else idx = Index_CreateRelationIndex(gc->g, label_id, label, property, trigrams);
   gc->indices[gc->index_count] = idx;
   gc->index_count++;
+  GraphContext_UpdateSchemaVersion(gc);
 
   return INDEX_OK;
 }
 
-int GraphContext_DeleteIndex(GraphContext *gc, const char *label, const char *property) {
-  int offset = _GraphContext_IndexOffset(gc, label, property);
+int GraphContext_DeleteIndex(GraphContext *gc, const char *label, const char *property, LabelStoreType t) {
+  int offset = _GraphContext_IndexOffset(gc, label, property, t);
   if (offset < 0) return INDEX_FAIL;
 
   Index *idx = gc->indices[offset];
@@ -185,10 +223,96 @@ int GraphContext_DeleteIndex(GraphContext *gc, const char *label, const char *pr
   gc->index_count --;
   // If the deleted index was not the last, swap the last into the newly-emptied position
   if (offset < gc->index_count) gc->indices[offset] = gc->indices[gc->index_count];
+  GraphContext_UpdateSchemaVersion(gc);
 
   return INDEX_OK;
 }
 
+void GraphContext_IndexNode(GraphContext *gc, const char *label, const Node *n) {
+  if (label == NULL) return;
+  for (int i = 0; i < gc->index_count; i ++) {
+    Index *idx = gc->indices[i];
+    if (idx->entity_type == STORE_NODE && !strcmp(label, idx->label)) Index_InsertNode(idx, n);
+  }
+}
+
+void GraphContext_IndexEdge(GraphContext *gc, const char *relation, const Edge *e, NodeID src, NodeID dest) {
+  for (int i = 0; i < gc->index_count; i ++) {
+    Index *idx = gc->indices[i];
+    if (idx->entity_type == STORE_EDGE && !strcmp(relation, idx->label)) Index_InsertEdge(idx, e, src, dest);
+  }
+}
+
+void GraphContext_UnindexNode(GraphContext *gc, const Node *n) {
+  bool edge_indices = false;
+  int label_id = Graph_GetNodeLabel(gc->g, ENTITY_GET_ID(n));
+  for (int i = 0; i < gc->index_count; i ++) {
+    Index *idx = gc->indices[i];
+    if (idx->entity_type == STORE_EDGE) edge_indices = true;
+    else if (label_id != GRAPH_NO_LABEL && !strcmp(gc->node_stores[label_id]->label, idx->label)) {
+      Index_DeleteNode(idx, n);
+    }
+  }
+  if (!edge_indices) return;
+
+  // Edges attached to the node are deleted along with it.
+  Edge *edges = array_new(Edge, 0);
+  Graph_GetNodeEdges(gc->g, n, GRAPH_EDGE_DIR_BOTH, GRAPH_NO_RELATION, &edges);
+  for (int i = 0; i < array_len(edges); i ++) GraphContext_UnindexEdge(gc, edges + i);
+  array_free(edges);
+}
+
+void GraphContext_UnindexEdge(GraphContext *gc, Edge *e) {
+  int relation_id = Edge_GetRelationID(e);
+  if (relation_id == GRAPH_NO_RELATION) relation_id = Graph_GetEdgeRelation(gc->g, e);
+  const char *relation = gc->relation_stores[relation_id]->label;
+  for (int i = 0; i < gc->index_count; i ++) {
+    Index *idx = gc->indices[i];
+    if (idx->entity_type == STORE_EDGE && !strcmp(relation, idx->label)) Index_DeleteEdge(idx, e);
+  }
+}
+
+//------------------------------------------------------------------------------
+// Statistics API
+//------------------------------------------------------------------------------
+PropertyStats* GraphContext_GetPropertyStats(const GraphContext *gc, const char *label, const char *property) {
+  int offset = _GraphContext_StatsOffset(gc, label, property);
+  if (offset < 0) return NULL;
+
+  return gc->stats[offset];
+}
+
+void GraphContext_AddPropertyStats(GraphContext *gc, PropertyStats *stats) {
+  int offset = _GraphContext_StatsOffset(gc, stats->label, stats->property);
+  if (offset >= 0) {
+    PropertyStats_Free(gc->stats[offset]);
+    gc->stats[offset] = stats;
+    return;
+  }
+
+  if(gc->stats_count == gc->stats_cap) {
+    gc->stats_cap += 4;
+    gc->stats = rm_realloc(gc->stats, gc->stats_cap * sizeof(PropertyStats*));
+  }
+  gc->stats[gc->stats_count] = stats;
+  gc->stats_count++;
+}
+
+int GraphContext_AnalyzeLabel(GraphContext *gc, int label_id) {
+  LabelStore *store = gc->node_stores[label_id];
+  PropertyStats **stats = PropertyStats_Collect(gc->g, store);
+
+  int stats_count = array_len(stats);
+  for (int i = 0; i < stats_count; i ++) GraphContext_AddPropertyStats(gc, stats[i]);
+  array_free(stats);
+
+  return stats_count;
+}
+
+void GraphContext_UpdateSchemaVersion(GraphContext *gc) {
+  gc->schema_version = __atomic_add_fetch(&_schema_clock, 1, __ATOMIC_RELAXED);
+}
+
 // Free all data associated with graph
 void GraphContext_Free(GraphContext *gc) {
   Graph_Free(gc->g);
@@ -222,6 +346,14 @@ void GraphContext_Free(GraphContext *gc) {
     rm_free(gc->indices);
   }
 
+  // Free all statistics
+  if(gc->stats) {
+    for (int i = 0; i < gc->stats_count; i ++) {
+      PropertyStats_Free(gc->stats[i]);
+    }
+    rm_free(gc->stats);
+  }
+
   rm_free(gc);
 }
 
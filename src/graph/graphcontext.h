@@ -5,6 +5,7 @@
 #include "../redismodule.h"
 #include "../index/index.h"
 #include "../stores/store.h"
+#include "../stats/property_stats.h"
 #include "graph.h"
 
 #define DEFAULT_INDEX_CAP 4
@@ -26,12 +27,23 @@ typedef struct {
   unsigned int index_cap;          // Capacity of indices array
   unsigned int index_count;        // Number of indices
   Index **indices;                 // Array of all indices on label-property pairs
+
+  unsigned int stats_cap;          // Capacity of stats array
+  unsigned int stats_count;        // Number of analyzed label-property pairs
+  PropertyStats **stats;           // Statistics collected by GRAPH.ANALYZE on label-property pairs
+
+  uint64_t schema_version;         // Changes whenever labels, relation types, properties or indices change
+  bool read_only;                  // Projections built by GRAPH.PROJECT can't be modified
 } GraphContext;
 
 /* GraphContext API */
 GraphContext* GraphContext_New(RedisModuleCtx *ctx, RedisModuleString *rs_name,
                                size_t node_cap, size_t edge_cap);
 GraphContext* GraphContext_Retrieve(RedisModuleCtx *ctx, RedisModuleString *rs_graph_name);
+// Set the GraphContext the calling thread is operating on, NULL to clear
+void GraphContext_SetTLS(GraphContext *gc);
+// Retrieve the GraphContext the calling thread is operating on
+GraphContext* GraphContext_GetFromTLS(void);
 
 /* LabelStore API */
 // Find the ID associated with a label for store and matrix access
@@ -47,12 +59,34 @@ LabelStore* GraphContext_AddRelationType(GraphContext *gc, const char *label);
 
 /* Index API */
 bool GraphContext_HasIndices(GraphContext *gc);
-// Attempt to retrieve an index on the given label and property
-Index* GraphContext_GetIndex(const GraphContext *gc, const char *label, const char *property);
-// Create and populate an index for the given label and property
-int GraphContext_AddIndex(GraphContext *gc, const char *label, const char *property);
+// Attempt to retrieve an index on the given label or relationship type and property
+Index* GraphContext_GetIndex(const GraphContext *gc, const char *label, const char *property,
+                             LabelStoreType t);
+// Create and populate an index for the given label or relationship type and property,
+// trigrams of string values are indexed on request
+int GraphContext_AddIndex(GraphContext *gc, const char *label, const char *property, LabelStoreType t,
+                          bool trigrams);
 // Remove and free an index
-int GraphContext_DeleteIndex(GraphContext *gc, const char *label, const char *property);
+int GraphContext_DeleteIndex(GraphContext *gc, const char *label, const char *property, LabelStoreType t);
+// Add a newly created node to the indices on its label
+void GraphContext_IndexNode(GraphContext *gc, const char *label, const Node *n);
+// Add a newly created edge to the indices on its relationship type
+void GraphContext_IndexEdge(GraphContext *gc, const char *relation, const Edge *e, NodeID src, NodeID dest);
+// Remove a node, along with its edges, from indices prior to deleting it
+void GraphContext_UnindexNode(GraphContext *gc, const Node *n);
+// Remove an edge from the indices on its relationship type prior to deleting it
+void GraphContext_UnindexEdge(GraphContext *gc, Edge *e);
+
+/* Statistics API */
+// Retrieve statistics collected on the given label and property, NULL if not analyzed
+PropertyStats* GraphContext_GetPropertyStats(const GraphContext *gc, const char *label, const char *property);
+// Collect statistics on every property of the given label, replacing previously collected statistics
+int GraphContext_AnalyzeLabel(GraphContext *gc, int label_id);
+// Add collected statistics, replacing statistics on the same label-property pair
+void GraphContext_AddPropertyStats(GraphContext *gc, PropertyStats *stats);
+
+// Mark schema as modified, invalidating cached queries
+void GraphContext_UpdateSchemaVersion(GraphContext *gc);
 
 // Free the GraphContext and all associated graph data
 void GraphContext_Free(GraphContext *gc);
@@ -0,0 +1,134 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#include "lazyfree.h"
+
+#include <pthread.h>
+#include "../util/arr.h"
+
+// Number of entities freed between statistics updates.
+#define LAZYFREE_CHUNK 16384
+
+static pthread_once_t _lazyfree_once = PTHREAD_ONCE_INIT;
+static pthread_mutex_t _lazyfree_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t _lazyfree_cond = PTHREAD_COND_INITIALIZER;
+static GraphContext **_lazyfree_queue = NULL;  // Graphs waiting to be reclaimed.
+static LazyFreeStats _lazyfree_stats = {0};
+
+// Estimated memory consumed by matrix M.
+static size_t _LazyFree_MatrixSize(GrB_Matrix M) {
+    GrB_Index ncols;
+    size_t type_size;
+    GrB_Matrix_ncols(&ncols, M);
+    GxB_Type_size(&type_size, M->type);
+    return (ncols + 1) * sizeof(int64_t) + M->nzmax * (sizeof(int64_t) + type_size);
+}
+
+// Estimated memory consumed by graph matrices and entity blocks.
+static size_t _LazyFree_GraphSize(const Graph *g) {
+    size_t size = _LazyFree_MatrixSize(g->adjacency_matrix);
+    for(int i = 0; i < array_len(g->labels); i++) size += _LazyFree_MatrixSize(g->labels[i]);
+    for(int i = 0; i < array_len(g->relations); i++) size += _LazyFree_MatrixSize(g->relations[i]);
+    size += g->nodes->itemCap * g->nodes->itemSize;
+    size += g->edges->itemCap * g->edges->itemSize;
+    return size;
+}
+
+static void _LazyFree_UpdateStats(uint64_t entities, uint64_t bytes) {
+    pthread_mutex_lock(&_lazyfree_mutex);
+    _lazyfree_stats.freed_entities += entities;
+    _lazyfree_stats.reclaimed_bytes += bytes;
+    pthread_mutex_unlock(&_lazyfree_mutex);
+}
+
+/* Frees entities properties in chunks, publishing progress after each chunk.
+ * FreeEntity leaves entities without properties, as such the remaining
+ * structure is released by GraphContext_Free. */
+static void _LazyFree_Entities(DataBlock *entities) {
+    Entity *en;
+    uint64_t freed = 0;
+    uint64_t bytes = 0;
+    DataBlockIterator *it = DataBlock_Scan(entities);
+
+    while((en = (Entity*)DataBlockIterator_Next(it)) != NULL) {
+        for(int i = 0; i < en->prop_count; i++) bytes += strlen(en->properties[i].name) + 1;
+        bytes += en->prop_count * sizeof(EntityProperty);
+        FreeEntity(en);
+
+        if(++freed == LAZYFREE_CHUNK) {
+            _LazyFree_UpdateStats(freed, bytes);
+            freed = 0;
+            bytes = 0;
+        }
+    }
+
+    _LazyFree_UpdateStats(freed, bytes);
+    DataBlockIterator_Free(it);
+}
+
+static void _LazyFree_Reclaim(GraphContext *gc) {
+    Graph *g = gc->g;
+
+    /* Graph is no longer reachable, though queries which retrieved it
+     * beforehand may still be running, wait for them to complete. */
+    Graph_AcquireWriteLock(g);
+    Graph_ReleaseLock(g);
+
+    size_t graph_size = _LazyFree_GraphSize(g);
+
+    _LazyFree_Entities(g->nodes);
+    _LazyFree_Entities(g->edges);
+    GraphContext_Free(gc);
+
+    pthread_mutex_lock(&_lazyfree_mutex);
+    _lazyfree_stats.reclaimed_bytes += graph_size;
+    _lazyfree_stats.freed_graphs++;
+    _lazyfree_stats.pending_graphs--;
+    pthread_mutex_unlock(&_lazyfree_mutex);
+}
+
+static void *_LazyFree_Worker(void *arg) {
+    while(true) {
+        pthread_mutex_lock(&_lazyfree_mutex);
+        while(array_len(_lazyfree_queue) == 0) {
+            pthread_cond_wait(&_lazyfree_cond, &_lazyfree_mutex);
+        }
+        GraphContext *gc = array_pop(_lazyfree_queue);
+        pthread_mutex_unlock(&_lazyfree_mutex);
+
+        _LazyFree_Reclaim(gc);
+    }
+    return NULL;
+}
+
+static void _LazyFree_Init(void) {
+    pthread_t thread;
+    _lazyfree_queue = array_new(GraphContext*, 4);
+    assert(pthread_create(&thread, NULL, _LazyFree_Worker, NULL) == 0);
+    pthread_detach(thread);
+}
+
+void LazyFree_GraphContext(GraphContext *gc) {
+    assert(gc);
+    pthread_once(&_lazyfree_once, _LazyFree_Init);
+
+    // Graph is no longer reachable, skip matrix synchronization.
+    Graph_SetMatrixPolicy(gc->g, DISABLED);
+
+    pthread_mutex_lock(&_lazyfree_mutex);
+    _lazyfree_queue = array_append(_lazyfree_queue, gc);
+    _lazyfree_stats.pending_graphs++;
+    pthread_cond_signal(&_lazyfree_cond);
+    pthread_mutex_unlock(&_lazyfree_mutex);
+}
+
+void LazyFree_GetStats(LazyFreeStats *stats) {
+    assert(stats);
+    pthread_mutex_lock(&_lazyfree_mutex);
+    *stats = _lazyfree_stats;
+    pthread_mutex_unlock(&_lazyfree_mutex);
+}
@@ -0,0 +1,31 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#ifndef LAZYFREE_H
+#define LAZYFREE_H
+
+#include <stdint.h>
+#include "graphcontext.h"
+
+/* Lazy free reclaims deleted graphs memory on a background thread,
+ * such that removing a graph key does not block Redis. */
+
+typedef struct {
+    uint64_t pending_graphs;    // Number of graphs waiting to be reclaimed.
+    uint64_t freed_graphs;      // Number of graphs reclaimed.
+    uint64_t freed_entities;    // Number of nodes and edges reclaimed.
+    uint64_t reclaimed_bytes;   // Estimated number of bytes reclaimed.
+} LazyFreeStats;
+
+/* Hands gc over to the reclamation thread,
+ * gc must not be accessed once this function returns. */
+void LazyFree_GraphContext(GraphContext *gc);
+
+/* Retrieves a snapshot of lazy free statistics. */
+void LazyFree_GetStats(LazyFreeStats *stats);
+
+#endif
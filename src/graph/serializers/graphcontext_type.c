@@ -6,6 +6,7 @@
  */
 
 #include "../graphcontext.h"
+#include "../lazyfree.h"
 #include "graphcontext_type.h"
 #include "serialize_graph.h"
 #include "serialize_store.h"
@@ -26,7 +27,10 @@ void GraphContextType_RdbSave(RedisModuleIO *rdb, void *value) {
    * relation store X #relation
    * graph object
    * #indices
-   * (index label, index property) X #indices
+   * (index label, index property, index entity type, index trigrams) X #indices
+   * #property statistics
+   * property statistics X #property statistics
+   * read only
    */
 
   // Graph name.
@@ -69,7 +73,20 @@ void GraphContextType_RdbSave(RedisModuleIO *rdb, void *value) {
     idx = gc->indices[i];
     RedisModule_SaveStringBuffer(rdb, idx->label, strlen(idx->label) + 1);
     RedisModule_SaveStringBuffer(rdb, idx->property, strlen(idx->property) + 1);
+    RedisModule_SaveUnsigned(rdb, idx->entity_type);
+    RedisModule_SaveUnsigned(rdb, idx->trigrams != NULL);
   }
+
+  // #Property statistics.
+  RedisModule_SaveUnsigned(rdb, gc->stats_count);
+
+  // Serialize each label-property statistics.
+  for (int i = 0; i < gc->stats_count; i ++) {
+    PropertyStats_RdbSave(rdb, gc->stats[i]);
+  }
+
+  // Read only, set for projections.
+  RedisModule_SaveUnsigned(rdb, gc->read_only);
 }
 
 void *GraphContextType_RdbLoad(RedisModuleIO *rdb, int encver) {
@@ -83,7 +100,10 @@ void *GraphContextType_RdbLoad(RedisModuleIO *rdb, int encver) {
    * name of relation X #relation   
    * graph object
    * #indices
-   * (index label, index property) X #indices
+   * (index label, index property, index entity type, index trigrams) X #indices
+   * #property statistics
+   * property statistics X #property statistics
+   * read only
    */
 
   if (encver > GRAPHCONTEXT_TYPE_ENCODING_VERSION) {
@@ -98,6 +118,10 @@ void *GraphContextType_RdbLoad(RedisModuleIO *rdb, int encver) {
   gc->node_stores = NULL;
   gc->relation_stores = NULL;
   gc->indices = NULL;    
+  gc->stats = NULL;
+  gc->stats_cap = 0;
+  gc->stats_count = 0;
+  gc->read_only = false;
 
   // Graph name
   // Duplicating string so that it can be safely freed if GraphContext
@@ -137,7 +161,8 @@ void *GraphContextType_RdbLoad(RedisModuleIO *rdb, int encver) {
   RdbLoadGraph(rdb, gc->g);
 
   // #Indices
-  // (index label, index property) X #indices
+  // (index label, index property, index entity type, index trigrams) X #indices
+  // Relationship indices were introduced in encoding version 5, trigrams in version 6.
   uint64_t index_count = RedisModule_LoadUnsigned(rdb);
   gc->index_count = 0;
   gc->index_cap = index_count;
@@ -145,9 +170,26 @@ void *GraphContextType_RdbLoad(RedisModuleIO *rdb, int encver) {
   for (int i = 0; i < index_count; i ++) {
     const char *label = RedisModule_LoadStringBuffer(rdb, NULL);
     const char *property = RedisModule_LoadStringBuffer(rdb, NULL);
-    GraphContext_AddIndex(gc, label, property);
+    LabelStoreType t = STORE_NODE;
+    if (encver >= 5) t = RedisModule_LoadUnsigned(rdb);
+    bool trigrams = false;
+    if (encver >= 6) trigrams = RedisModule_LoadUnsigned(rdb);
+    GraphContext_AddIndex(gc, label, property, t, trigrams);
   }
 
+  // #Property statistics, introduced in encoding version 3.
+  if (encver >= 3) {
+    uint64_t stats_count = RedisModule_LoadUnsigned(rdb);
+    for (int i = 0; i < stats_count; i ++) {
+      GraphContext_AddPropertyStats(gc, PropertyStats_RdbLoad(rdb));
+    }
+  }
+
+  // Read only, introduced in encoding version 4.
+  if (encver >= 4) gc->read_only = RedisModule_LoadUnsigned(rdb);
+
+  GraphContext_UpdateSchemaVersion(gc);
+
   return gc;
 }
 
@@ -157,8 +199,9 @@ void GraphContextType_AofRewrite(RedisModuleIO *aof, RedisModuleString *key, voi
 
 void GraphContextType_Free(void *value) {
   GraphContext *gc = value;
-  Graph_SetMatrixPolicy(gc->g, DISABLED);
-  GraphContext_Free(gc);
+  // Reclaim graph memory on a background thread, as freeing a large
+  // graph would otherwise block Redis.
+  LazyFree_GraphContext(gc);
 }
 
 int GraphContextType_Register(RedisModuleCtx *ctx) {
@@ -12,7 +12,7 @@
 
 extern RedisModuleType *GraphContextRedisModuleType;
 
-#define GRAPHCONTEXT_TYPE_ENCODING_VERSION 2
+#define GRAPHCONTEXT_TYPE_ENCODING_VERSION 6
 
 /* Commands related to the redis Graph registration */
 int GraphContextType_Register(RedisModuleCtx *ctx);
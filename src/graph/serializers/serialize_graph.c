@@ -203,12 +203,12 @@ void _RdbSaveEdges(RedisModuleIO *rdb, const Graph *g) {
     // #edges (N)
     RedisModule_SaveUnsigned(rdb, Graph_EdgeCount(g));
 
-    for(int r = 0; r < array_len(g->_relations_map); r++) {
+    for(int r = 0; r < array_len(g->relations); r++) {
         Edge e;
         NodeID src;
         NodeID dest;
         EdgeID edgeID;
-        GrB_Matrix M = g->_relations_map[r];
+        GrB_Matrix M = g->relations[r];
         TuplesIter *it = TuplesIter_new(M);
 
         while(TuplesIter_next(it, &dest, &src) == TuplesIter_OK) {
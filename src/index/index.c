@@ -6,7 +6,9 @@
 */
 
 #include "index.h"
+#include "../util/arr.h"
 #include "../util/rmalloc.h"
+#include "../parser/grammar.h"
 
 /* Memory management and comparator functions that get attached to
  * string and numeric skiplists as function pointers. */
@@ -41,56 +43,202 @@ void initializeSkiplists(Index *index) {
   index->numeric_sl = skiplistCreate(compareNumerics, compareNodes, cloneKey, freeKey);
 }
 
-/* Index_Create allocates an Index object and populates it with all unique IDs and values
- * that possess the provided label and property. */
-Index* Index_Create(Graph *g, int label_id, const char *label, const char *prop_str) {
-  const GrB_Matrix label_matrix = Graph_GetLabel(g, label_id);
-  TuplesIter *it = TuplesIter_new(label_matrix);
+void freePostings(void *postings) {
+  array_free(postings);
+}
 
-  Index *index = rm_malloc(sizeof(Index));
+/* Inserts val into sorted postings, unless already present. */
+skiplistVal* _Postings_Insert(skiplistVal *postings, skiplistVal val) {
+  uint32_t len = array_len(postings);
+  // Entities are mostly indexed in ascending order.
+  if (len == 0 || postings[len - 1] < val) return array_append(postings, val);
+
+  uint32_t lo = 0;
+  uint32_t hi = len;
+  while (lo < hi) {
+    uint32_t mid = (lo + hi) / 2;
+    if (postings[mid] < val) lo = mid + 1;
+    else hi = mid;
+  }
+  // Trigram occurs more than once within the indexed string.
+  if (postings[lo] == val) return postings;
+
+  postings = array_append(postings, val);
+  memmove(postings + lo + 1, postings + lo, (len - lo) * sizeof(skiplistVal));
+  postings[lo] = val;
+  return postings;
+}
 
+/* Adds val to the sorted postings of each of str's trigrams. */
+void _Index_AddTrigrams(Index *index, const char *str, skiplistVal val) {
+  size_t len = strlen(str);
+  for (size_t i = 0; i + TRIGRAM_LEN <= len; i ++) {
+    char *trigram = (char*)str + i;
+    skiplistVal *postings = TrieMap_Find(index->trigrams, trigram, TRIGRAM_LEN);
+    if (postings == TRIEMAP_NOTFOUND) postings = array_new(skiplistVal, 1);
+    postings = _Postings_Insert(postings, val);
+    TrieMap_Add(index->trigrams, trigram, TRIGRAM_LEN, postings, TrieMap_DONT_CARE_REPLACE);
+  }
+}
+
+/* Removes val from sorted postings, if present. */
+void _Postings_Remove(skiplistVal *postings, skiplistVal val) {
+  uint32_t len = array_len(postings);
+  uint32_t lo = 0;
+  uint32_t hi = len;
+  while (lo < hi) {
+    uint32_t mid = (lo + hi) / 2;
+    if (postings[mid] < val) lo = mid + 1;
+    else hi = mid;
+  }
+  if (lo == len || postings[lo] != val) return;
+
+  memmove(postings + lo, postings + lo + 1, (len - lo - 1) * sizeof(skiplistVal));
+  array_trimm_len(postings, len - 1);
+}
+
+/* Removes val from the postings of each of str's trigrams. */
+void _Index_RemoveTrigrams(Index *index, const char *str, skiplistVal val) {
+  size_t len = strlen(str);
+  for (size_t i = 0; i + TRIGRAM_LEN <= len; i ++) {
+    skiplistVal *postings = TrieMap_Find(index->trigrams, (char*)str + i, TRIGRAM_LEN);
+    if (postings != TRIEMAP_NOTFOUND) _Postings_Remove(postings, val);
+  }
+}
+
+Index* _Index_New(const char *label, const char *prop_str, LabelStoreType entity_type, bool trigrams) {
+  Index *index = rm_malloc(sizeof(Index));
   index->label = rm_strdup(label);
   index->property = rm_strdup(prop_str);
-
+  index->entity_type = entity_type;
+  index->edges = NULL;
+  index->trigrams = (trigrams) ? NewTrieMap() : NULL;
   initializeSkiplists(index);
+  return index;
+}
 
-  Node node;
+/* Only strings and numerics are indexed. */
+static inline bool _Index_Indexable(const SIValue *v) {
+  return (v->type == T_STRING || v->type & SI_NUMERIC);
+}
+
+/* Retrieves the entity's value of the indexed property.
+ * prop_index caches the property's offset within the previously visited entity.
+ * Returns NULL if the entity doesn't hold an indexable value for the property. */
+SIValue* _Index_EntityKey(const Index *index, const GraphEntity *entity, int *prop_index) {
+  const char *prop_str = index->property;
   EntityProperty *prop;
+  int found;
 
-  skiplist *sl;
-  NodeID node_id;
-  GraphEntity *entity;
+  // If the sought property is at a different offset than it occupied in the previous entity,
+  // (or the previous offset is out of this entity's bounds), then seek and update
+  if (*prop_index >= ENTITY_PROP_COUNT(entity) ||
+      strcmp(prop_str, ENTITY_PROPS(entity)[*prop_index].name)) {
+    found = 0;
+    for (int i = 0; i < ENTITY_PROP_COUNT(entity); i ++) {
+      prop = ENTITY_PROPS(entity) + i;
+      if (!strcmp(prop_str, prop->name)) {
+        *prop_index = i;
+        found = 1;
+        break;
+      }
+    }
+  } else {
+    found = 1;
+  }
+  // The targeted property does not exist on this entity
+  if (!found) return NULL;
 
-  int found;
+  prop = ENTITY_PROPS(entity) + *prop_index;
+  if (!_Index_Indexable(&prop->value)) return NULL;
+  return &prop->value;
+}
+
+/* Inserts val under key, key is cloned by the skiplist if necessary. */
+void _Index_InsertKey(Index *index, SIValue *key, skiplistVal val) {
+  skiplist *sl = (key->type & SI_NUMERIC) ? index->numeric_sl: index->string_sl;
+  skiplistInsert(sl, key, val);
+  if (key->type == T_STRING && index->trigrams) _Index_AddTrigrams(index, key->stringval, val);
+}
+
+/* Removes val from under key, if present. */
+void _Index_DeleteKey(Index *index, SIValue *key, skiplistVal val) {
+  skiplist *sl = (key->type & SI_NUMERIC) ? index->numeric_sl: index->string_sl;
+  if (!skiplistDelete(sl, key, &val)) return;
+  if (key->type == T_STRING && index->trigrams) _Index_RemoveTrigrams(index, key->stringval, val);
+}
+
+/* Inserts the entity's value of the indexed property under val, if it has one.
+ * prop_index caches the property's offset within the previously inserted entity.
+ * Returns false if the entity doesn't have the indexed property. */
+bool _Index_InsertEntity(Index *index, const GraphEntity *entity, skiplistVal val, int *prop_index) {
+  SIValue *key = _Index_EntityKey(index, entity, prop_index);
+  if (!key) return false;
+  _Index_InsertKey(index, key, val);
+  return true;
+}
+
+/* Locates the position of the edge indexed under key within the index's edges.
+ * Returns false if the edge isn't indexed under key. */
+bool _Index_EdgePosition(const Index *index, SIValue *key, EdgeID id, skiplistVal *pos) {
+  skiplist *sl = (key->type & SI_NUMERIC) ? index->numeric_sl: index->string_sl;
+  skiplistNode *node = skiplistFind(sl, key);
+  if (!node) return false;
+  for (unsigned int i = 0; i < node->numVals; i ++) {
+    if (index->edges[node->vals[i]].id == id) {
+      *pos = node->vals[i];
+      return true;
+    }
+  }
+  return false;
+}
+
+/* Index_Create allocates an Index object and populates it with all unique IDs and values
+ * that possess the provided label and property. */
+Index* Index_Create(Graph *g, int label_id, const char *label, const char *prop_str, bool trigrams) {
+  const GrB_Matrix label_matrix = Graph_GetLabel(g, label_id);
+  TuplesIter *it = TuplesIter_new(label_matrix);
+
+  Index *index = _Index_New(label, prop_str, STORE_NODE, trigrams);
+
+  Node node;
+  NodeID node_id;
   int prop_index = 0;
 
   while(TuplesIter_next(it, NULL, &node_id) != TuplesIter_DEPLETED) {
     Graph_GetNode(g, node_id, &node);
-    // If the sought property is at a different offset than it occupied in the previous node,
-    // then seek and update
-    if (strcmp(prop_str, ENTITY_PROPS(&node)[prop_index].name)) {
-      found = 0;
-      for (int i = 0; i < ENTITY_PROP_COUNT(&node); i ++) {
-        prop = ENTITY_PROPS(&node) + i;
-        if (!strcmp(prop_str, prop->name)) {
-          prop_index = i;
-          found = 1;
-          break;
-        }
-      }
-    } else {
-      found = 1;
-    }
-    // The targeted property does not exist on this node
-    if (!found) continue;
+    _Index_InsertEntity(index, (GraphEntity*)&node, node_id, &prop_index);
+  }
+
+  TuplesIter_free(it);
+
+  return index;
+}
 
-    prop = ENTITY_PROPS(&node) + prop_index;
-    // This value will be cloned within the skiplistInsert routine if necessary
-    SIValue *key = &prop->value;
+/* Edges don't record their endpoints, which are only known while scanning
+ * the relation matrix, each indexed edge is kept along with its endpoints
+ * and skiplist values refer to its position. */
+Index* Index_CreateRelationIndex(Graph *g, int relation_id, const char *relation, const char *prop_str,
+                                 bool trigrams) {
+  const GrB_Matrix relation_matrix = Graph_GetRelationMatrix(g, relation_id);
+  TuplesIter *it = TuplesIter_new(relation_matrix);
 
-    assert(key->type == T_STRING || key->type & SI_NUMERIC);
-    sl = (key->type & SI_NUMERIC) ? index->numeric_sl: index->string_sl;
-    skiplistInsert(sl, key, node_id);
+  Index *index = _Index_New(relation, prop_str, STORE_EDGE, trigrams);
+  index->edges = array_new(IndexedEdge, Graph_RelationEdgeCount(g, relation_id));
+
+  Edge edge;
+  NodeID src_id;
+  NodeID dest_id;
+  EdgeID edge_id;
+  int prop_index = 0;
+
+  // Relation matrix entries hold the ID of the edge connecting column to row.
+  while(TuplesIter_next_UINT64(it, &dest_id, &src_id, &edge_id) != TuplesIter_DEPLETED) {
+    Graph_GetEdge(g, edge_id, &edge);
+    if (_Index_InsertEntity(index, (GraphEntity*)&edge, array_len(index->edges), &prop_index)) {
+      IndexedEdge indexed = {.id = edge_id, .src = src_id, .dest = dest_id};
+      index->edges = array_append(index->edges, indexed);
+    }
   }
 
   TuplesIter_free(it);
@@ -98,10 +246,127 @@ Index* Index_Create(Graph *g, int label_id, const char *label, const char *prop_
   return index;
 }
 
+void Index_InsertNode(Index *idx, const Node *n) {
+  assert(idx->entity_type == STORE_NODE);
+  int prop_index = 0;
+  _Index_InsertEntity(idx, (GraphEntity*)n, ENTITY_GET_ID(n), &prop_index);
+}
+
+void Index_InsertEdge(Index *idx, const Edge *e, NodeID src, NodeID dest) {
+  assert(idx->entity_type == STORE_EDGE);
+  int prop_index = 0;
+  if (_Index_InsertEntity(idx, (GraphEntity*)e, array_len(idx->edges), &prop_index)) {
+    IndexedEdge indexed = {.id = ENTITY_GET_ID(e), .src = src, .dest = dest};
+    idx->edges = array_append(idx->edges, indexed);
+  }
+}
+
+void Index_DeleteNode(Index *idx, const Node *n) {
+  assert(idx->entity_type == STORE_NODE);
+  int prop_index = 0;
+  SIValue *key = _Index_EntityKey(idx, (GraphEntity*)n, &prop_index);
+  if (key) _Index_DeleteKey(idx, key, ENTITY_GET_ID(n));
+}
+
+/* The edge's position within idx->edges is left unreferenced. */
+void Index_DeleteEdge(Index *idx, const Edge *e) {
+  assert(idx->entity_type == STORE_EDGE);
+  int prop_index = 0;
+  skiplistVal pos;
+  SIValue *key = _Index_EntityKey(idx, (GraphEntity*)e, &prop_index);
+  if (key && _Index_EdgePosition(idx, key, ENTITY_GET_ID(e), &pos)) _Index_DeleteKey(idx, key, pos);
+}
+
+void Index_UpdateNode(Index *idx, const Node *n, SIValue *new_value) {
+  Index_DeleteNode(idx, n);
+  if (_Index_Indexable(new_value)) _Index_InsertKey(idx, new_value, ENTITY_GET_ID(n));
+}
+
+/* An edge which is already indexed keeps its position within idx->edges. */
+void Index_UpdateEdge(Index *idx, const Edge *e, SIValue *new_value, NodeID src, NodeID dest) {
+  assert(idx->entity_type == STORE_EDGE);
+  int prop_index = 0;
+  skiplistVal pos;
+  SIValue *key = _Index_EntityKey(idx, (GraphEntity*)e, &prop_index);
+  bool indexed = (key && _Index_EdgePosition(idx, key, ENTITY_GET_ID(e), &pos));
+  if (indexed) _Index_DeleteKey(idx, key, pos);
+  if (!_Index_Indexable(new_value)) return;
+
+  if (!indexed) {
+    IndexedEdge edge = {.id = ENTITY_GET_ID(e), .src = src, .dest = dest};
+    idx->edges = array_append(idx->edges, edge);
+    pos = array_len(idx->edges) - 1;
+  }
+  _Index_InsertKey(idx, new_value, pos);
+}
+
+IndexedEdge* Index_GetEdge(const Index *idx, const skiplistVal *val) {
+  assert(idx->entity_type == STORE_EDGE);
+  return idx->edges + *val;
+}
+
 /* Generate an iterator with no lower or upper bound. */
 IndexIter* IndexIter_Create(Index *idx, SIType type) {
-  skiplist *sl = type == T_STRING ? idx->string_sl : idx->numeric_sl;
-  return skiplistIterateAll(sl);
+  IndexIter *iter = rm_malloc(sizeof(IndexIter));
+  iter->idx = idx;
+  iter->type = (type == T_STRING) ? T_STRING : SI_NUMERIC;
+  iter->range = skiplistIterateAll(type == T_STRING ? idx->string_sl : idx->numeric_sl);
+  iter->candidates = NULL;
+  iter->candidate_idx = 0;
+  return iter;
+}
+
+/* Restricts the iterator to the strings holding every trigram of sub,
+ * sub is required to hold at least a single trigram. */
+void _IndexIter_ApplyTrigrams(IndexIter *iter, const char *sub) {
+  size_t len = strlen(sub);
+  for (size_t i = 0; i + TRIGRAM_LEN <= len; i ++) {
+    skiplistVal *postings = TrieMap_Find(iter->idx->trigrams, (char*)sub + i, TRIGRAM_LEN);
+    if (postings == TRIEMAP_NOTFOUND) {
+      // No indexed string holds this trigram.
+      if (iter->candidates) array_clear(iter->candidates);
+      else iter->candidates = array_new(skiplistVal, 1);
+      return;
+    }
+
+    if (!iter->candidates) {
+      iter->candidates = array_new(skiplistVal, array_len(postings));
+      for (uint32_t j = 0; j < array_len(postings); j ++) {
+        iter->candidates = array_append(iter->candidates, postings[j]);
+      }
+      continue;
+    }
+
+    // Intersect sorted candidates with postings, in place.
+    uint32_t n = 0;
+    uint32_t j = 0;
+    for (uint32_t k = 0; k < array_len(iter->candidates); k ++) {
+      skiplistVal v = iter->candidates[k];
+      while (j < array_len(postings) && postings[j] < v) j ++;
+      if (j == array_len(postings)) break;
+      if (postings[j] == v) iter->candidates[n++] = v;
+    }
+    array_trimm_len(iter->candidates, n);
+  }
+}
+
+/* STARTS WITH prefix translates into the range [prefix, successor), where successor
+ * is the lowest string greater than every string starting with prefix.
+ * Returns false if no such string exists, in which case only the lower bound is set. */
+bool _IndexIter_ApplyPrefix(IndexIter *iter, SIValue *prefix) {
+  skiplistIter_UpdateBound(iter->range, prefix, GE);
+
+  SIValue successor = SI_StringVal(prefix->stringval);
+  unsigned char *s = (unsigned char*)successor.stringval;
+  int i = strlen(successor.stringval) - 1;
+  // Drop trailing characters which cannot be incremented.
+  while (i >= 0 && s[i] == UCHAR_MAX) s[i--] = '\0';
+  if (i >= 0) {
+    s[i]++;
+    skiplistIter_UpdateBound(iter->range, &successor, LT);
+  }
+  SIValue_Free(&successor);
+  return (i >= 0);
 }
 
 /* Apply a filter to an iterator, modifying the appropriate bound if
@@ -109,24 +374,57 @@ IndexIter* IndexIter_Create(Index *idx, SIType type) {
  * Returns 1 if the filter was a comparison type that can be translated into a bound
  * (effectively, any type but '!='), which indicates that it is now redundant. */
 bool IndexIter_ApplyBound(IndexIter *iter, SIValue *bound, int op) {
-  return skiplistIter_UpdateBound(iter, bound, op);
+  // Bounds only apply to values of the iterated type, string predicates to strings.
+  if (!(bound->type & iter->type)) return 0;
+  if ((op == STARTS || op == ENDS || op == CONTAINS) && bound->type != T_STRING) return 0;
+
+  if (op == CONTAINS || op == ENDS) {
+    // Trigrams narrow down candidates, which still need to be filtered.
+    if (iter->idx->trigrams && strlen(bound->stringval) >= TRIGRAM_LEN &&
+        (iter->candidates || (!iter->range->rangeMin && !iter->range->rangeMax))) {
+      _IndexIter_ApplyTrigrams(iter, bound->stringval);
+    }
+    return 0;
+  }
+
+  // Candidates are not ordered by value, ranges no longer apply.
+  if (iter->candidates) return 0;
+
+  if (op == STARTS) return _IndexIter_ApplyPrefix(iter, bound);
+  return skiplistIter_UpdateBound(iter->range, bound, op);
 }
 
 NodeID* IndexIter_Next(IndexIter *iter) {
-  return skiplistIterator_Next(iter);
+  if (!iter->candidates) return skiplistIterator_Next(iter->range);
+  if (iter->candidate_idx == array_len(iter->candidates)) return NULL;
+  return iter->candidates + iter->candidate_idx++;
 }
 
 void IndexIter_Reset(IndexIter *iter) {
-  skiplistIterate_Reset(iter);
+  skiplistIterate_Reset(iter->range);
+  iter->candidate_idx = 0;
+}
+
+void IndexIter_ToDiagonal(IndexIter *iter, GrB_Matrix D) {
+  NodeID *node_id;
+  IndexIter_Reset(iter);
+  while((node_id = IndexIter_Next(iter))) {
+    GrB_Matrix_setElement_BOOL(D, true, *node_id, *node_id);
+  }
+  IndexIter_Reset(iter);
 }
 
 void IndexIter_Free(IndexIter *iter) {
-  skiplistIterate_Free(iter);
+  skiplistIterate_Free(iter->range);
+  if (iter->candidates) array_free(iter->candidates);
+  rm_free(iter);
 }
 
 void Index_Free(Index *idx) {
   skiplistFree(idx->string_sl);
   skiplistFree(idx->numeric_sl);
+  if (idx->edges) array_free(idx->edges);
+  if (idx->trigrams) TrieMap_Free(idx->trigrams, freePostings);
   rm_free(idx->label);
   rm_free(idx->property);
   rm_free(idx);
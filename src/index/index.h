@@ -11,44 +11,103 @@
 #include <assert.h>
 #include "../redismodule.h"
 #include "../graph/graph.h"
+#include "../stores/store.h"
 #include "../graph/entities/graph_entity.h"
 #include "../util/skiplist.h"
+#include "../util/triemap/triemap.h"
 #include "../GraphBLASExt/tuples_iter.h"
 
 #define INDEX_OK 1
 #define INDEX_FAIL 0
+#define TRIGRAM_LEN 3  // Length of substrings indexed for CONTAINS and ENDS WITH.
 
-typedef skiplistIterator IndexIter;
+/* An indexed edge along with its endpoints. */
+typedef struct {
+  EdgeID id;
+  NodeID src;
+  NodeID dest;
+} IndexedEdge;
 
 /* Properties are not required to be of a consistent type, and index construction
  * will store values in separate string and numeric skiplists with different comparator
  * functions if necessary.
  * When building Index Scan operations, the types of values described by filters will
- * specify which skiplist should be traversed. */
+ * specify which skiplist should be traversed.
+ * Node indices hold node IDs, relationship indices hold positions within edges.
+ * Indices created with trigrams map every trigram of an indexed string to the ascending
+ * values of the entities holding it, such that CONTAINS and ENDS WITH filters can narrow
+ * their candidates. */
 typedef struct {
-  char *label;
+  char *label;                  // Node label or relationship type.
   char *property;
+  LabelStoreType entity_type;   // Indexes nodes or edges.
   skiplist *string_sl;
   skiplist *numeric_sl;
+  TrieMap *trigrams;            // Trigram -> array of values of strings containing it, NULL if not built.
+  IndexedEdge *edges;           // Indexed edges, NULL for node indices.
 } Index;
 
+/* Iterates over a range of indexed values, once a trigram filter is applied
+ * the iterator is restricted to the entities holding all of its trigrams. */
+typedef struct {
+  Index *idx;
+  SIType type;                  // Type of indexed values iterated over.
+  skiplistIterator *range;      // Range of indexed values.
+  skiplistVal *candidates;      // Values holding all filtered trigrams, replaces range when set.
+  uint32_t candidate_idx;       // Position within candidates.
+} IndexIter;
+
 /* Index_Create builds an index for a label-property pair so that queries reliant
- * on these entities can use expedited scan logic. */
-Index* Index_Create(Graph *g, int label_id, const char *label, const char *prop_str);
+ * on these entities can use expedited scan logic.
+ * Trigrams of string values are only indexed when requested. */
+Index* Index_Create(Graph *g, int label_id, const char *label, const char *prop_str, bool trigrams);
+
+/* Builds an index on a property of edges of the given relationship type. */
+Index* Index_CreateRelationIndex(Graph *g, int relation_id, const char *relation, const char *prop_str,
+                                 bool trigrams);
+
+/* Adds a node created after the index was built. */
+void Index_InsertNode(Index *idx, const Node *n);
+
+/* Adds an edge created after the index was built, along with its endpoints. */
+void Index_InsertEdge(Index *idx, const Edge *e, NodeID src, NodeID dest);
+
+/* Removes a node prior to its deletion. */
+void Index_DeleteNode(Index *idx, const Node *n);
+
+/* Removes an edge prior to its deletion. */
+void Index_DeleteEdge(Index *idx, const Edge *e);
+
+/* Reindexes a node under the value its indexed property is about to be set to. */
+void Index_UpdateNode(Index *idx, const Node *n, SIValue *new_value);
+
+/* Reindexes an edge under the value its indexed property is about to be set to. */
+void Index_UpdateEdge(Index *idx, const Edge *e, SIValue *new_value, NodeID src, NodeID dest);
+
+/* Retrieves the edge referred to by a relationship index iterator value. */
+IndexedEdge* Index_GetEdge(const Index *idx, const skiplistVal *val);
 
 /* Build a new iterator to traverse all indexed values of the specified type. */
 IndexIter* IndexIter_Create(Index *idx, SIType type);
 
 /* Update the lower or upper bound of an index iterator based on a constant predicate filter
- * (if that filter represents a narrower bound than the current one). */
+ * (if that filter represents a narrower bound than the current one).
+ * STARTS WITH is translated into a range of strings, CONTAINS and ENDS WITH
+ * restrict the iterator to candidates which still need to be filtered. */
 bool IndexIter_ApplyBound(IndexIter *iter, SIValue *bound, int op);
 
-/* Returns a pointer to the next Node ID in the index, or NULL if the iterator has been depleted. */
+/* Returns a pointer to the next Node ID in the index, or NULL if the iterator has been depleted.
+ * Relationship index values are resolved to edges by Index_GetEdge. */
 GrB_Index* IndexIter_Next(IndexIter *iter);
 
 /* Reset an iterator to its original position. */
 void IndexIter_Reset(IndexIter *iter);
 
+/* Sets D[i, i] for every node i within a node index iterator's range, such that the
+ * entire range can be multiplied through an algebraic expression at once.
+ * D is an N X N boolean matrix, the iterator is left at its original position. */
+void IndexIter_ToDiagonal(IndexIter *iter, GrB_Matrix D);
+
 /* Free an index iterator. */
 void IndexIter_Free(IndexIter *iter);
 
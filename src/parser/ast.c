@@ -9,6 +9,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <strings.h>
 #include "../graph/entities/graph_entity.h"
 #include "./ast_arithmetic_expression.h"
 #include "../arithmetic/repository.h"
@@ -81,6 +82,7 @@ AST_Query *New_AST_Query(AST_MatchNode *matchNode, AST_WhereNode *whereNode,
   queryExpressionNode->skipNode = skipNode;
   queryExpressionNode->limitNode = limitNode;
   queryExpressionNode->indexNode = indexNode;
+  queryExpressionNode->parameters = NULL;
 
   return queryExpressionNode;
 }
@@ -290,6 +292,71 @@ AST_Validation _Validate_WHERE_Clause(const AST_Query *ast, char **reason) {
   return res;
 }
 
+/* Degree functions are evaluated against node IDs,
+ * their first argument must be a node alias. */
+AST_Validation _Validate_Degree_Arguments(const AST_Query *ast, const AST_ArithmeticExpressionNode *exp,
+                                          char **reason) {
+  if (!exp || exp->type != AST_AR_EXP_OP) return AST_VALID;
+
+  const char *func = exp->op.function;
+  if ((strcasecmp(func, "degree") == 0 || strcasecmp(func, "indegree") == 0 ||
+       strcasecmp(func, "outdegree") == 0) && Vector_Size(exp->op.args) > 0) {
+    AST_ArithmeticExpressionNode *arg;
+    Vector_Get(exp->op.args, 0, &arg);
+    bool node = (arg->type == AST_AR_EXP_OPERAND && arg->operand.type == AST_AR_EXP_VARIADIC &&
+                 !arg->operand.variadic.property);
+    if (node) {
+      AST_GraphEntity *entity = MatchClause_GetEntity(ast->matchNode, arg->operand.variadic.alias);
+      node = (!entity || entity->t == N_ENTITY);
+    }
+    if (!node) {
+      asprintf(reason, "Type mismatch: %s() expects a node argument", func);
+      return AST_INVALID;
+    }
+  }
+
+  for (int i = 0; i < Vector_Size(exp->op.args); i++) {
+    AST_ArithmeticExpressionNode *arg;
+    Vector_Get(exp->op.args, i, &arg);
+    if (_Validate_Degree_Arguments(ast, arg, reason) != AST_VALID) return AST_INVALID;
+  }
+  return AST_VALID;
+}
+
+AST_Validation _Validate_Degree_Filters(const AST_Query *ast, const AST_FilterNode *filter, char **reason) {
+  if (!filter) return AST_VALID;
+  if (filter->t == N_PRED) {
+    if (_Validate_Degree_Arguments(ast, filter->pn.lhs, reason) != AST_VALID) return AST_INVALID;
+    return _Validate_Degree_Arguments(ast, filter->pn.rhs, reason);
+  }
+  if (_Validate_Degree_Filters(ast, filter->cn.left, reason) != AST_VALID) return AST_INVALID;
+  return _Validate_Degree_Filters(ast, filter->cn.right, reason);
+}
+
+AST_Validation _Validate_Degree_Functions(const AST_Query *ast, char **reason) {
+  if (ast->whereNode && _Validate_Degree_Filters(ast, ast->whereNode->filters, reason) != AST_VALID) {
+    return AST_INVALID;
+  }
+
+  if (ast->setNode) {
+    for (int i = 0; i < Vector_Size(ast->setNode->set_elements); i++) {
+      AST_SetElement *elem;
+      Vector_Get(ast->setNode->set_elements, i, &elem);
+      if (_Validate_Degree_Arguments(ast, elem->exp, reason) != AST_VALID) return AST_INVALID;
+    }
+  }
+
+  if (ast->returnNode) {
+    for (int i = 0; i < Vector_Size(ast->returnNode->returnElements); i++) {
+      AST_ReturnElementNode *elem;
+      Vector_Get(ast->returnNode->returnElements, i, &elem);
+      if (_Validate_Degree_Arguments(ast, elem->exp, reason) != AST_VALID) return AST_INVALID;
+    }
+  }
+
+  return AST_VALID;
+}
+
 AST_Validation AST_Validate(const AST_Query *ast, char **reason) {
   /* AST must include either a MATCH or CREATE clause. */
   if (!(ast->matchNode || ast->createNode || ast->mergeNode || ast->returnNode || ast->indexNode)) {
@@ -327,6 +394,10 @@ AST_Validation AST_Validate(const AST_Query *ast, char **reason) {
     return AST_INVALID;
   }
 
+  if (_Validate_Degree_Functions(ast, reason) != AST_VALID) {
+    return AST_INVALID;
+  }
+
   return AST_VALID;
 }
 
@@ -348,6 +419,19 @@ bool AST_ReadOnly(const AST_Query *ast) {
            ast->indexNode != NULL);
 }
 
+const char* AST_GetParameterName(const AST_Query *ast, SIValue v) {
+  if(!ast->parameters || v.type != T_STRING) return NULL;
+
+  /* Placeholders share their string with the parameters vector,
+   * as such identity rather than content is compared. */
+  char *name;
+  for(int i = 0; i < Vector_Size(ast->parameters); i++) {
+    Vector_Get(ast->parameters, i, &name);
+    if(name == v.stringval) return name;
+  }
+  return NULL;
+}
+
 void Free_AST_Query(AST_Query *queryExpressionNode) {
   Free_AST_MatchNode(queryExpressionNode->matchNode);
   Free_AST_CreateNode(queryExpressionNode->createNode);
@@ -358,5 +442,10 @@ void Free_AST_Query(AST_Query *queryExpressionNode) {
   Free_AST_ReturnNode(queryExpressionNode->returnNode);
   Free_AST_SkipNode(queryExpressionNode->skipNode);
   Free_AST_OrderNode(queryExpressionNode->orderNode);
+  if(queryExpressionNode->parameters) {
+    char *name;
+    while(Vector_Pop(queryExpressionNode->parameters, &name)) free(name);
+    Vector_Free(queryExpressionNode->parameters);
+  }
   free(queryExpressionNode);
 }
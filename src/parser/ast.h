@@ -32,6 +32,7 @@ typedef struct {
 	AST_LimitNode *limitNode;
 	AST_SkipNode *skipNode;
 	AST_IndexNode *indexNode;
+	Vector *parameters;	// Names of $parameters, each referenced by a placeholder constant.
 } AST_Query;
 
 AST_Query* New_AST_Query(AST_MatchNode *matchNode, AST_WhereNode *whereNode,
@@ -46,6 +47,9 @@ AST_Validation AST_Validate(const AST_Query* ast, char **reason);
 
 void AST_NameAnonymousNodes(AST_Query *ast);
 
+// Returns parameter name if v is a $parameter placeholder, NULL otherwise.
+const char* AST_GetParameterName(const AST_Query *ast, SIValue v);
+
 // Checks if AST represent a read only query.
 bool AST_ReadOnly(const AST_Query *ast);
 
@@ -1,6 +1,8 @@
 #ifndef _CLAUSE_INDEX_H
 #define _CLAUSE_INDEX_H
 
+#include <stdbool.h>
+
 typedef enum {
   DROP_INDEX,
   CREATE_INDEX
@@ -10,9 +12,10 @@ typedef struct {
   const char *label;
   const char *property;
   AST_IndexOpType operation;
+  bool trigrams;              // Index trigrams of string values, CREATE only.
 } AST_IndexNode;
 
-AST_IndexNode* New_AST_IndexNode(const char *label, const char *property, AST_IndexOpType optype);
+AST_IndexNode* New_AST_IndexNode(const char *label, const char *property, AST_IndexOpType optype, bool trigrams);
 void Free_AST_IndexNode(AST_IndexNode *indexNode);
 
 #endif
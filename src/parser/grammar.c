@@ -24,7 +24,7 @@
 */
 #include <stdio.h>
 /************ Begin %include sections from the grammar ************************/
-#line 9 "grammar.y"
+#line 12 "grammar.y"
 
 	#include <stdlib.h>
 	#include <stdio.h>
@@ -37,15 +37,13 @@
 	#include "parse.h"
 	#include "../value.h"
 
-	void yyerror(char *s);
-
 	/*
 	**    YYSTACKDEPTH       is the maximum depth of the parser's stack.  If
 	**                       zero the stack is dynamically sized using realloc()
 	*/
 	// Increase depth from 100 to 1000 to handel deep recursion.
 	#define YYSTACKDEPTH 1000
-#line 49 "grammar.c"
+#line 47 "grammar.c"
 /**************** End of %include directives **********************************/
 /* These constants specify the various numeric values for terminal symbols
 ** in a format understandable to "makeheaders".  This section is blank unless
@@ -107,37 +105,37 @@
 #endif
 /************* Begin control #defines *****************************************/
 #define YYCODETYPE unsigned char
-#define YYNOCODE 89
+#define YYNOCODE 96
 #define YYACTIONTYPE unsigned short int
 #define ParseTOKENTYPE Token
 typedef union {
   int yyinit;
   ParseTOKENTYPE yy0;
-  AST_ArithmeticExpressionNode* yy2;
-  AST_SetNode* yy12;
-  SIValue yy22;
-  AST_DeleteNode * yy31;
-  AST_IndexNode* yy32;
-  AST_Query* yy40;
-  AST_ReturnNode* yy48;
-  AST_OrderNode* yy52;
-  AST_ColumnNode* yy54;
-  AST_LinkEntity* yy61;
-  AST_NodeEntity* yy69;
-  AST_FilterNode* yy82;
-  AST_WhereNode* yy83;
-  AST_SetElement* yy88;
-  AST_IndexOpType yy89;
-  int yy108;
-  AST_SkipNode* yy115;
-  AST_Variable* yy116;
-  AST_LimitNode* yy127;
-  Vector* yy130;
-  AST_MergeNode* yy132;
-  AST_MatchNode* yy133;
-  AST_LinkLength* yy138;
-  AST_CreateNode* yy140;
-  AST_ReturnElementNode* yy170;
+  AST_MergeNode* yy10;
+  AST_OrderNode* yy28;
+  AST_ReturnElementNode* yy34;
+  AST_LinkEntity* yy35;
+  AST_IndexNode* yy74;
+  AST_LimitNode* yy77;
+  AST_FilterNode* yy86;
+  AST_NodeEntity* yy89;
+  AST_ColumnNode* yy90;
+  AST_CreateNode* yy96;
+  AST_DeleteNode * yy115;
+  Vector* yy116;
+  AST_Variable* yy120;
+  AST_Query* yy122;
+  int yy123;
+  AST_SetElement* yy124;
+  AST_SetNode* yy130;
+  AST_LinkLength* yy140;
+  bool yy147;
+  AST_ArithmeticExpressionNode* yy154;
+  AST_MatchNode* yy155;
+  AST_SkipNode* yy173;
+  AST_WhereNode* yy181;
+  AST_ReturnNode* yy188;
+  SIValue yy189;
 } YYMINORTYPE;
 #ifndef YYSTACKDEPTH
 #define YYSTACKDEPTH 100
@@ -146,17 +144,17 @@ typedef union {
 #define ParseARG_PDECL , parseCtx *ctx 
 #define ParseARG_FETCH  parseCtx *ctx  = yypParser->ctx 
 #define ParseARG_STORE yypParser->ctx  = ctx 
-#define YYNSTATE             116
-#define YYNRULE              99
-#define YYNTOKEN             50
-#define YY_MAX_SHIFT         115
-#define YY_MIN_SHIFTREDUCE   180
-#define YY_MAX_SHIFTREDUCE   278
-#define YY_ERROR_ACTION      279
-#define YY_ACCEPT_ACTION     280
-#define YY_NO_ACTION         281
-#define YY_MIN_REDUCE        282
-#define YY_MAX_REDUCE        380
+#define YYNSTATE             122
+#define YYNRULE              104
+#define YYNTOKEN             57
+#define YY_MAX_SHIFT         121
+#define YY_MIN_SHIFTREDUCE   191
+#define YY_MAX_SHIFTREDUCE   294
+#define YY_ERROR_ACTION      295
+#define YY_ACCEPT_ACTION     296
+#define YY_NO_ACTION         297
+#define YY_MIN_REDUCE        298
+#define YY_MAX_REDUCE        401
 /************* End control #defines *******************************************/
 
 /* Define the yytestcase() macro to be a no-op if is not already defined
@@ -222,115 +220,123 @@ typedef union {
 **  yy_default[]       Default action for each state.
 **
 *********** Begin parsing tables **********************************************/
-#define YY_ACTTAB_COUNT (284)
+#define YY_ACTTAB_COUNT (306)
 static const YYACTIONTYPE yy_action[] = {
- /*     0 */    85,  302,   84,   16,   14,   13,   12,  265,  266,  269,
- /*    10 */   267,  268,   71,   16,   14,   13,   12,  115,  280,   59,
- /*    20 */   242,  288,  291,  351,   61,   31,   73,   15,  289,  290,
- /*    30 */   242,   79,  350,  351,   61,  109,  341,  271,   16,   14,
- /*    40 */    13,   12,  350,    2,  270,  107,  341,   16,   14,   13,
- /*    50 */    12,  303,   84,  273,  274,  276,  277,  278,   16,   14,
- /*    60 */    13,   12,  265,  266,  269,  267,  268,   71,  111,   19,
- /*    70 */    18,  108,   71,  195,   58,  351,   28,   71,   23,  285,
- /*    80 */    54,   73,   15,   32,  350,   81,   73,    4,  305,  351,
- /*    90 */    62,    1,  271,    9,  351,   27,   21,  271,  350,  270,
- /*   100 */   101,   36,  271,  350,   66,   20,  305,   39,  273,  274,
- /*   110 */   276,  277,  278,  273,  274,  276,  277,  278,  273,  274,
- /*   120 */   276,  277,  278,  362,   44,  351,   28,  351,   28,  351,
- /*   130 */    65,  351,   61,   45,  350,  336,  350,   68,  350,  360,
- /*   140 */   350,  351,   63,   72,  340,  351,   64,  351,  348,   50,
- /*   150 */   350,   90,    3,    5,  350,   40,  350,  351,  347,  351,
- /*   160 */    74,  351,   60,  351,   70,   48,  350,  106,  350,   80,
- /*   170 */   350,   33,  350,   33,  105,  362,  305,  272,  305,   88,
- /*   180 */    34,   99,   35,    3,    5,   97,   26,    7,   48,  247,
- /*   190 */    67,  361,   11,   48,  275,   48,   94,   92,   91,   13,
- /*   200 */    12,  100,  233,  256,  257,  110,   77,  295,   75,   37,
- /*   210 */   208,   83,   30,   69,   86,   48,   41,   87,   89,  102,
- /*   220 */   114,   98,   95,   96,  287,  306,  331,  112,  103,  104,
- /*   230 */   113,   51,   52,    1,   53,  283,   57,   55,   56,    6,
- /*   240 */    17,  196,  197,   76,   38,   78,    5,   25,  209,   82,
- /*   250 */    10,   24,  215,   42,   43,  218,  110,   22,  282,   46,
- /*   260 */   219,  217,  213,  223,   29,  214,  221,  216,   93,  211,
- /*   270 */   212,   49,  210,  281,   47,  262,  281,  227,    8,  241,
- /*   280 */   253,  281,  281,  264,
+ /*     0 */    91,  319,   90,   16,   14,   13,   12,  277,  278,  281,
+ /*    10 */   279,  280,   16,   14,   13,   12,  277,  278,  281,  279,
+ /*    20 */   280,   74,  254,  121,  296,   62,   31,  304,  307,   19,
+ /*    30 */    18,  368,   64,   79,  305,  306,   61,   76,   15,   23,
+ /*    40 */   367,  301,   57,  115,  358,   83,  282,   87,  286,   86,
+ /*    50 */   285,   31,    1,  117,    2,  282,   87,    9,   86,  285,
+ /*    60 */    74,   47,   16,   14,   13,   12,  368,   64,  288,  289,
+ /*    70 */   291,  292,  293,  294,   74,  367,   76,   15,  113,  358,
+ /*    80 */   379,  254,   16,   14,   13,   12,  107,  286,  368,   28,
+ /*    90 */    76,    4,   74,  368,   27,   70,  378,  367,   85,    3,
+ /*   100 */     5,  286,  367,   69,  368,   28,   21,  288,  289,  291,
+ /*   110 */   292,  293,  294,  367,  353,    7,   20,  114,   42,  286,
+ /*   120 */   245,  288,  289,  291,  292,  293,  294,  368,   28,   16,
+ /*   130 */    14,   13,   12,  116,  320,   90,  367,   71,  103,  288,
+ /*   140 */   289,  291,  292,  293,  294,  368,   68,  368,   64,  368,
+ /*   150 */    65,   97,  368,   66,  367,   48,  367,   26,  367,   75,
+ /*   160 */   357,  367,  368,   67,  368,  365,   53,  368,  364,  368,
+ /*   170 */    77,  367,   32,  367,  268,  269,  367,  322,  367,   43,
+ /*   180 */   368,   63,  368,   73,  112,  379,   84,   36,   33,  367,
+ /*   190 */    33,  367,  322,  322,   96,  322,   94,   34,  105,   35,
+ /*   200 */   111,  377,    3,    5,  100,   98,  259,  287,   51,   11,
+ /*   210 */    51,  106,   51,   82,   51,  312,   13,   12,   80,   37,
+ /*   220 */   207,   40,  311,   39,  220,   89,   30,   51,  290,   92,
+ /*   230 */    72,   44,  108,  120,  303,   93,   95,  119,  104,  101,
+ /*   240 */   102,  323,  110,  348,  109,   54,  118,   55,   56,    1,
+ /*   250 */     6,   59,  299,   60,   58,   38,   17,   78,  208,  209,
+ /*   260 */    81,   41,    5,  221,  284,  283,   25,  227,   10,   88,
+ /*   270 */    45,   24,   46,  116,   22,  298,   29,  230,  231,  229,
+ /*   280 */   225,  223,  235,  226,  233,  228,   99,   49,  224,   50,
+ /*   290 */   222,   52,  253,  265,    8,  297,  239,  297,  297,  297,
+ /*   300 */   297,  274,  297,  297,  297,  276,
 };
 static const YYCODETYPE yy_lookahead[] = {
- /*     0 */    69,   70,   71,    3,    4,    5,    6,    7,    8,    9,
- /*    10 */    10,   11,    4,    3,    4,    5,    6,   51,   52,   53,
- /*    20 */    20,   55,   56,   71,   72,   19,   18,   19,   62,   63,
- /*    30 */    20,   65,   80,   71,   72,   83,   84,   29,    3,    4,
- /*    40 */     5,    6,   80,   35,   44,   83,   84,    3,    4,    5,
- /*    50 */     6,   70,   71,   45,   46,   47,   48,   49,    3,    4,
- /*    60 */     5,    6,    7,    8,    9,   10,   11,    4,   18,   12,
- /*    70 */    13,   36,    4,   16,   55,   71,   72,    4,   21,   60,
- /*    80 */    61,   18,   19,   68,   80,   81,   18,   19,   73,   71,
- /*    90 */    72,   34,   29,   82,   71,   72,   13,   29,   80,   44,
- /*   100 */    80,   68,   29,   80,   81,   22,   73,   24,   45,   46,
- /*   110 */    47,   48,   49,   45,   46,   47,   48,   49,   45,   46,
- /*   120 */    47,   48,   49,   71,   76,   71,   72,   71,   72,   71,
- /*   130 */    72,   71,   72,    4,   80,   81,   80,   81,   80,   87,
- /*   140 */    80,   71,   72,   85,   84,   71,   72,   71,   72,   74,
- /*   150 */    80,   17,    1,    2,   80,   26,   80,   71,   72,   71,
- /*   160 */    72,   71,   72,   71,   72,   31,   80,   64,   80,   64,
- /*   170 */    80,   68,   80,   68,   17,   71,   73,   29,   73,   17,
- /*   180 */    18,   17,   18,    1,    2,   76,   23,   19,   31,   20,
- /*   190 */    86,   87,   23,   31,   46,   31,   29,   30,   76,    5,
- /*   200 */     6,   76,   20,   40,   41,   37,   19,   67,   17,   66,
- /*   210 */    18,   75,   27,    5,   77,   31,   78,   76,   76,   18,
- /*   220 */    43,   76,   78,   77,   59,   73,   79,   38,   79,   76,
- /*   230 */    42,   58,   57,   34,   56,   59,   56,   58,   57,   33,
- /*   240 */    54,   18,   20,   18,   15,   14,    2,   23,   18,   23,
- /*   250 */     7,   23,    4,   18,   18,   28,   37,   39,    0,   18,
- /*   260 */    28,   28,   20,   29,   17,   25,   29,   28,   30,   20,
- /*   270 */    20,   18,   20,   88,   23,   29,   88,   32,   23,   18,
- /*   280 */    18,   88,   88,   29,   88,   88,   88,   88,   88,   88,
- /*   290 */    88,   88,   88,   88,   88,   88,   88,   88,   88,   88,
- /*   300 */    88,   88,   88,   88,   88,   88,   88,   88,   88,   88,
- /*   310 */    88,   88,   88,   88,   88,   88,   88,   88,   88,   88,
- /*   320 */    88,   88,   88,   88,   88,   88,   88,   88,   88,   88,
- /*   330 */    88,   88,   88,   88,
+ /*     0 */    76,   77,   78,    3,    4,    5,    6,    7,    8,    9,
+ /*    10 */    10,   11,    3,    4,    5,    6,    7,    8,    9,   10,
+ /*    20 */    11,    4,   22,   58,   59,   60,   21,   62,   63,   13,
+ /*    30 */    14,   78,   79,   17,   69,   70,   62,   20,   21,   23,
+ /*    40 */    87,   67,   68,   90,   91,   15,   46,   47,   31,   49,
+ /*    50 */    50,   21,   36,   20,   37,   46,   47,   89,   49,   50,
+ /*    60 */     4,   83,    3,    4,    5,    6,   78,   79,   51,   52,
+ /*    70 */    53,   54,   55,   56,    4,   87,   20,   21,   90,   91,
+ /*    80 */    78,   22,    3,    4,    5,    6,   87,   31,   78,   79,
+ /*    90 */    20,   21,    4,   78,   79,   93,   94,   87,   88,    1,
+ /*   100 */     2,   31,   87,   88,   78,   79,   14,   51,   52,   53,
+ /*   110 */    54,   55,   56,   87,   88,   21,   24,   38,   26,   31,
+ /*   120 */    22,   51,   52,   53,   54,   55,   56,   78,   79,    3,
+ /*   130 */     4,    5,    6,   39,   77,   78,   87,   88,   83,   51,
+ /*   140 */    52,   53,   54,   55,   56,   78,   79,   78,   79,   78,
+ /*   150 */    79,   83,   78,   79,   87,    4,   87,   25,   87,   92,
+ /*   160 */    91,   87,   78,   79,   78,   79,   81,   78,   79,   78,
+ /*   170 */    79,   87,   75,   87,   42,   43,   87,   80,   87,   28,
+ /*   180 */    78,   79,   78,   79,   71,   78,   71,   75,   75,   87,
+ /*   190 */    75,   87,   80,   80,   19,   80,   19,   20,   19,   20,
+ /*   200 */    19,   94,    1,    2,   31,   32,   22,   31,   33,   25,
+ /*   210 */    33,   83,   33,   21,   33,   73,    5,    6,   19,   72,
+ /*   220 */    18,   72,   74,   73,   20,   82,   29,   33,   52,   84,
+ /*   230 */     5,   85,   20,   45,   66,   83,   83,   44,   83,   85,
+ /*   240 */    84,   80,   83,   86,   86,   65,   40,   64,   63,   36,
+ /*   250 */    35,   64,   66,   63,   65,   16,   61,   15,   20,   22,
+ /*   260 */    20,   16,    2,   20,   48,   48,   25,    4,    7,   25,
+ /*   270 */    20,   25,   20,   39,   41,    0,   19,   30,   30,   30,
+ /*   280 */    22,   22,   31,   27,   31,   30,   32,   20,   22,   25,
+ /*   290 */    22,   20,   20,   20,   25,   95,   34,   95,   95,   95,
+ /*   300 */    95,   31,   95,   95,   95,   31,   95,   95,   95,   95,
+ /*   310 */    95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+ /*   320 */    95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+ /*   330 */    95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+ /*   340 */    95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+ /*   350 */    95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+ /*   360 */    95,   95,   95,
 };
-#define YY_SHIFT_COUNT    (115)
+#define YY_SHIFT_COUNT    (121)
 #define YY_SHIFT_MIN      (0)
-#define YY_SHIFT_MAX      (262)
+#define YY_SHIFT_MAX      (275)
 static const unsigned short int yy_shift_ofst[] = {
- /*     0 */    57,    8,   63,   68,   68,   68,   68,   63,   63,   63,
- /*    10 */    63,   63,   63,   63,   63,   63,   63,   83,    6,    6,
- /*    20 */    50,    6,   50,    6,   50,    6,   50,    0,   55,   73,
- /*    30 */   162,  164,  129,  129,  134,  157,  129,  187,  191,  192,
- /*    40 */   185,  184,  208,  184,  208,  185,  184,  201,  201,  184,
- /*    50 */     6,  177,  188,  189,  199,  177,  188,  189,  199,  206,
- /*    60 */    10,   35,   44,   44,   44,   44,  182,  163,  151,  167,
- /*    70 */   194,  148,  169,  168,  194,  223,  222,  225,  229,  231,
- /*    80 */   224,  244,  230,  226,  243,  228,  248,  227,  235,  232,
- /*    90 */   236,  233,  234,  237,  238,  239,  240,  242,  249,  241,
- /*   100 */   250,  251,  247,  245,  252,  253,  224,  255,  261,  255,
- /*   110 */   262,  219,  218,  246,  254,  258,
+ /*     0 */    16,   17,   56,   70,   70,   70,   70,   56,   56,   56,
+ /*    10 */    56,   56,   56,   56,   56,   56,   56,   92,   30,    5,
+ /*    20 */    33,    5,   33,    5,   33,    5,   33,    0,    9,   88,
+ /*    30 */   177,  179,  151,  151,  175,  181,  151,  192,  199,  202,
+ /*    40 */   192,  199,  204,  197,  194,  225,  194,  225,  197,  194,
+ /*    50 */   212,  212,  194,    5,  188,  193,  206,  213,  188,  193,
+ /*    60 */   206,  213,  215,   59,   79,  126,  126,  126,  126,   98,
+ /*    70 */   132,  201,  173,  211,  176,  184,   94,  211,  239,  242,
+ /*    80 */   238,  237,  240,  245,  241,  260,  216,  217,  243,  244,
+ /*    90 */   261,  246,  263,  247,  250,  248,  252,  249,  251,  253,
+ /*   100 */   254,  255,  256,  258,  259,  267,  266,  264,  257,  262,
+ /*   110 */   268,  271,  241,  269,  272,  269,  273,  234,  233,  270,
+ /*   120 */   274,  275,
 };
-#define YY_REDUCE_COUNT (59)
-#define YY_REDUCE_MIN   (-69)
-#define YY_REDUCE_MAX   (186)
+#define YY_REDUCE_COUNT (62)
+#define YY_REDUCE_MIN   (-76)
+#define YY_REDUCE_MAX   (195)
 static const short yy_reduce_ofst[] = {
- /*     0 */   -34,  -48,  -38,    4,   23,   54,   56,   58,   60,   18,
- /*    10 */    70,   74,   76,   86,   88,   90,   92,   19,  103,  105,
- /*    20 */   -69,  103,  104,   15,  -19,   33,   52,   11,   11,   20,
- /*    30 */    48,  109,   75,   75,  122,  125,   75,  140,  143,  136,
- /*    40 */   137,  141,  138,  142,  144,  146,  145,  147,  149,  153,
- /*    50 */   152,  165,  173,  175,  178,  176,  179,  181,  180,  186,
+ /*     0 */   -35,  -47,  -12,   10,   15,   26,   49,   67,   69,   71,
+ /*    10 */    74,   84,   86,   89,   91,  102,  104,  -26,  113,  115,
+ /*    20 */   -76,  113,    2,   97,   57,  112,  107,  -32,  -32,   -1,
+ /*    30 */   -22,   55,   85,   85,   68,  128,   85,  142,  147,  148,
+ /*    40 */   150,  149,  143,  145,  152,  146,  153,  154,  156,  155,
+ /*    50 */   157,  158,  159,  161,  168,  180,  183,  185,  186,  189,
+ /*    60 */   187,  190,  195,
 };
 static const YYACTIONTYPE yy_default[] = {
- /*     0 */   293,  279,  279,  279,  279,  279,  279,  279,  279,  279,
- /*    10 */   279,  279,  279,  279,  279,  279,  279,  293,  296,  279,
- /*    20 */   279,  279,  279,  279,  279,  279,  279,  279,  279,  279,
- /*    30 */   328,  328,  300,  307,  328,  328,  308,  279,  279,  279,
- /*    40 */   279,  328,  322,  328,  322,  279,  328,  279,  279,  328,
- /*    50 */   279,  365,  363,  356,  286,  365,  363,  356,  284,  332,
- /*    60 */   279,  342,  334,  304,  352,  353,  279,  357,  333,  327,
- /*    70 */   345,  279,  279,  354,  346,  279,  279,  279,  279,  279,
- /*    80 */   292,  337,  279,  309,  279,  301,  279,  279,  279,  279,
- /*    90 */   279,  279,  279,  324,  326,  279,  279,  279,  279,  279,
- /*   100 */   279,  330,  279,  279,  279,  279,  294,  339,  279,  338,
- /*   110 */   279,  354,  279,  279,  279,  279,
+ /*     0 */   309,  295,  295,  295,  295,  295,  295,  295,  295,  295,
+ /*    10 */   295,  295,  295,  295,  295,  295,  295,  309,  295,  295,
+ /*    20 */   295,  295,  295,  295,  295,  295,  295,  295,  295,  295,
+ /*    30 */   345,  345,  317,  324,  345,  345,  325,  295,  295,  313,
+ /*    40 */   295,  295,  295,  295,  345,  339,  345,  339,  295,  345,
+ /*    50 */   295,  295,  345,  295,  382,  380,  373,  302,  382,  380,
+ /*    60 */   373,  300,  349,  295,  359,  351,  321,  369,  370,  295,
+ /*    70 */   374,  350,  344,  362,  295,  295,  371,  363,  295,  295,
+ /*    80 */   295,  295,  295,  295,  308,  354,  295,  295,  295,  326,
+ /*    90 */   295,  318,  295,  295,  295,  295,  295,  295,  295,  341,
+ /*   100 */   343,  295,  295,  295,  295,  295,  295,  347,  295,  295,
+ /*   110 */   295,  295,  310,  356,  295,  355,  295,  371,  295,  295,
+ /*   120 */   295,  295,
 };
 /********** End of lemon-generated parsing tables *****************************/
 
@@ -448,82 +454,89 @@ static const char *const yyTokenName[] = {
   /*    9 */ "GE",
   /*   10 */ "LT",
   /*   11 */ "LE",
-  /*   12 */ "MATCH",
-  /*   13 */ "CREATE",
-  /*   14 */ "INDEX",
-  /*   15 */ "ON",
-  /*   16 */ "DROP",
-  /*   17 */ "COLON",
-  /*   18 */ "UQSTRING",
-  /*   19 */ "LEFT_PARENTHESIS",
-  /*   20 */ "RIGHT_PARENTHESIS",
-  /*   21 */ "MERGE",
-  /*   22 */ "SET",
-  /*   23 */ "COMMA",
-  /*   24 */ "DELETE",
-  /*   25 */ "RIGHT_ARROW",
-  /*   26 */ "LEFT_ARROW",
-  /*   27 */ "LEFT_BRACKET",
-  /*   28 */ "RIGHT_BRACKET",
-  /*   29 */ "INTEGER",
-  /*   30 */ "DOTDOT",
-  /*   31 */ "LEFT_CURLY_BRACKET",
-  /*   32 */ "RIGHT_CURLY_BRACKET",
-  /*   33 */ "WHERE",
-  /*   34 */ "RETURN",
-  /*   35 */ "DISTINCT",
-  /*   36 */ "AS",
-  /*   37 */ "DOT",
-  /*   38 */ "ORDER",
-  /*   39 */ "BY",
-  /*   40 */ "ASC",
-  /*   41 */ "DESC",
-  /*   42 */ "SKIP",
-  /*   43 */ "LIMIT",
-  /*   44 */ "NE",
-  /*   45 */ "STRING",
-  /*   46 */ "FLOAT",
-  /*   47 */ "TRUE",
-  /*   48 */ "FALSE",
-  /*   49 */ "NULLVAL",
-  /*   50 */ "error",
-  /*   51 */ "expr",
-  /*   52 */ "query",
-  /*   53 */ "matchClause",
-  /*   54 */ "whereClause",
-  /*   55 */ "createClause",
-  /*   56 */ "returnClause",
-  /*   57 */ "orderClause",
-  /*   58 */ "skipClause",
-  /*   59 */ "limitClause",
-  /*   60 */ "deleteClause",
-  /*   61 */ "setClause",
-  /*   62 */ "indexClause",
-  /*   63 */ "mergeClause",
-  /*   64 */ "chains",
-  /*   65 */ "indexOpToken",
-  /*   66 */ "indexLabel",
-  /*   67 */ "indexProp",
-  /*   68 */ "chain",
-  /*   69 */ "setList",
-  /*   70 */ "setElement",
-  /*   71 */ "variable",
-  /*   72 */ "arithmetic_expression",
-  /*   73 */ "node",
-  /*   74 */ "link",
-  /*   75 */ "deleteExpression",
-  /*   76 */ "properties",
-  /*   77 */ "edge",
-  /*   78 */ "edgeLength",
-  /*   79 */ "mapLiteral",
-  /*   80 */ "value",
-  /*   81 */ "cond",
-  /*   82 */ "relation",
-  /*   83 */ "returnElements",
-  /*   84 */ "returnElement",
-  /*   85 */ "arithmetic_expression_list",
-  /*   86 */ "columnNameList",
-  /*   87 */ "columnName",
+  /*   12 */ "UNKNOWN",
+  /*   13 */ "MATCH",
+  /*   14 */ "CREATE",
+  /*   15 */ "INDEX",
+  /*   16 */ "ON",
+  /*   17 */ "DROP",
+  /*   18 */ "TRIGRAM",
+  /*   19 */ "COLON",
+  /*   20 */ "UQSTRING",
+  /*   21 */ "LEFT_PARENTHESIS",
+  /*   22 */ "RIGHT_PARENTHESIS",
+  /*   23 */ "MERGE",
+  /*   24 */ "SET",
+  /*   25 */ "COMMA",
+  /*   26 */ "DELETE",
+  /*   27 */ "RIGHT_ARROW",
+  /*   28 */ "LEFT_ARROW",
+  /*   29 */ "LEFT_BRACKET",
+  /*   30 */ "RIGHT_BRACKET",
+  /*   31 */ "INTEGER",
+  /*   32 */ "DOTDOT",
+  /*   33 */ "LEFT_CURLY_BRACKET",
+  /*   34 */ "RIGHT_CURLY_BRACKET",
+  /*   35 */ "WHERE",
+  /*   36 */ "RETURN",
+  /*   37 */ "DISTINCT",
+  /*   38 */ "AS",
+  /*   39 */ "DOT",
+  /*   40 */ "ORDER",
+  /*   41 */ "BY",
+  /*   42 */ "ASC",
+  /*   43 */ "DESC",
+  /*   44 */ "SKIP",
+  /*   45 */ "LIMIT",
+  /*   46 */ "NE",
+  /*   47 */ "STARTS",
+  /*   48 */ "WITH",
+  /*   49 */ "ENDS",
+  /*   50 */ "CONTAINS",
+  /*   51 */ "STRING",
+  /*   52 */ "FLOAT",
+  /*   53 */ "TRUE",
+  /*   54 */ "FALSE",
+  /*   55 */ "NULLVAL",
+  /*   56 */ "PARAMETER",
+  /*   57 */ "error",
+  /*   58 */ "expr",
+  /*   59 */ "query",
+  /*   60 */ "matchClause",
+  /*   61 */ "whereClause",
+  /*   62 */ "createClause",
+  /*   63 */ "returnClause",
+  /*   64 */ "orderClause",
+  /*   65 */ "skipClause",
+  /*   66 */ "limitClause",
+  /*   67 */ "deleteClause",
+  /*   68 */ "setClause",
+  /*   69 */ "indexClause",
+  /*   70 */ "mergeClause",
+  /*   71 */ "chains",
+  /*   72 */ "indexLabel",
+  /*   73 */ "indexProp",
+  /*   74 */ "indexTrigrams",
+  /*   75 */ "chain",
+  /*   76 */ "setList",
+  /*   77 */ "setElement",
+  /*   78 */ "variable",
+  /*   79 */ "arithmetic_expression",
+  /*   80 */ "node",
+  /*   81 */ "link",
+  /*   82 */ "deleteExpression",
+  /*   83 */ "properties",
+  /*   84 */ "edge",
+  /*   85 */ "edgeLength",
+  /*   86 */ "mapLiteral",
+  /*   87 */ "value",
+  /*   88 */ "cond",
+  /*   89 */ "relation",
+  /*   90 */ "returnElements",
+  /*   91 */ "returnElement",
+  /*   92 */ "arithmetic_expression_list",
+  /*   93 */ "columnNameList",
+  /*   94 */ "columnName",
 };
 #endif /* defined(YYCOVERAGE) || !defined(NDEBUG) */
 
@@ -544,92 +557,97 @@ static const char *const yyRuleName[] = {
  /*  10 */ "matchClause ::= MATCH chains",
  /*  11 */ "createClause ::=",
  /*  12 */ "createClause ::= CREATE chains",
- /*  13 */ "indexClause ::= indexOpToken INDEX ON indexLabel indexProp",
- /*  14 */ "indexOpToken ::= CREATE",
- /*  15 */ "indexOpToken ::= DROP",
- /*  16 */ "indexLabel ::= COLON UQSTRING",
- /*  17 */ "indexProp ::= LEFT_PARENTHESIS UQSTRING RIGHT_PARENTHESIS",
- /*  18 */ "mergeClause ::= MERGE chain",
- /*  19 */ "setClause ::= SET setList",
- /*  20 */ "setList ::= setElement",
- /*  21 */ "setList ::= setList COMMA setElement",
- /*  22 */ "setElement ::= variable EQ arithmetic_expression",
- /*  23 */ "chain ::= node",
- /*  24 */ "chain ::= chain link node",
- /*  25 */ "chains ::= chain",
- /*  26 */ "chains ::= chains COMMA chain",
- /*  27 */ "deleteClause ::= DELETE deleteExpression",
- /*  28 */ "deleteExpression ::= UQSTRING",
- /*  29 */ "deleteExpression ::= deleteExpression COMMA UQSTRING",
- /*  30 */ "node ::= LEFT_PARENTHESIS UQSTRING COLON UQSTRING properties RIGHT_PARENTHESIS",
- /*  31 */ "node ::= LEFT_PARENTHESIS COLON UQSTRING properties RIGHT_PARENTHESIS",
- /*  32 */ "node ::= LEFT_PARENTHESIS UQSTRING properties RIGHT_PARENTHESIS",
- /*  33 */ "node ::= LEFT_PARENTHESIS properties RIGHT_PARENTHESIS",
- /*  34 */ "link ::= DASH edge RIGHT_ARROW",
- /*  35 */ "link ::= LEFT_ARROW edge DASH",
- /*  36 */ "edge ::= LEFT_BRACKET properties edgeLength RIGHT_BRACKET",
- /*  37 */ "edge ::= LEFT_BRACKET UQSTRING properties RIGHT_BRACKET",
- /*  38 */ "edge ::= LEFT_BRACKET COLON UQSTRING edgeLength properties RIGHT_BRACKET",
- /*  39 */ "edge ::= LEFT_BRACKET UQSTRING COLON UQSTRING properties RIGHT_BRACKET",
- /*  40 */ "edgeLength ::=",
- /*  41 */ "edgeLength ::= MUL INTEGER DOTDOT INTEGER",
- /*  42 */ "edgeLength ::= MUL INTEGER DOTDOT",
- /*  43 */ "edgeLength ::= MUL DOTDOT INTEGER",
- /*  44 */ "edgeLength ::= MUL INTEGER",
- /*  45 */ "edgeLength ::= MUL",
- /*  46 */ "properties ::=",
- /*  47 */ "properties ::= LEFT_CURLY_BRACKET mapLiteral RIGHT_CURLY_BRACKET",
- /*  48 */ "mapLiteral ::= UQSTRING COLON value",
- /*  49 */ "mapLiteral ::= UQSTRING COLON value COMMA mapLiteral",
- /*  50 */ "whereClause ::=",
- /*  51 */ "whereClause ::= WHERE cond",
- /*  52 */ "cond ::= arithmetic_expression relation arithmetic_expression",
- /*  53 */ "cond ::= LEFT_PARENTHESIS cond RIGHT_PARENTHESIS",
- /*  54 */ "cond ::= cond AND cond",
- /*  55 */ "cond ::= cond OR cond",
- /*  56 */ "returnClause ::= RETURN returnElements",
- /*  57 */ "returnClause ::= RETURN DISTINCT returnElements",
- /*  58 */ "returnElements ::= returnElements COMMA returnElement",
- /*  59 */ "returnElements ::= returnElement",
- /*  60 */ "returnElement ::= arithmetic_expression",
- /*  61 */ "returnElement ::= arithmetic_expression AS UQSTRING",
- /*  62 */ "arithmetic_expression ::= LEFT_PARENTHESIS arithmetic_expression RIGHT_PARENTHESIS",
- /*  63 */ "arithmetic_expression ::= arithmetic_expression ADD arithmetic_expression",
- /*  64 */ "arithmetic_expression ::= arithmetic_expression DASH arithmetic_expression",
- /*  65 */ "arithmetic_expression ::= arithmetic_expression MUL arithmetic_expression",
- /*  66 */ "arithmetic_expression ::= arithmetic_expression DIV arithmetic_expression",
- /*  67 */ "arithmetic_expression ::= UQSTRING LEFT_PARENTHESIS arithmetic_expression_list RIGHT_PARENTHESIS",
- /*  68 */ "arithmetic_expression ::= value",
- /*  69 */ "arithmetic_expression ::= variable",
- /*  70 */ "arithmetic_expression_list ::= arithmetic_expression_list COMMA arithmetic_expression",
- /*  71 */ "arithmetic_expression_list ::= arithmetic_expression",
- /*  72 */ "variable ::= UQSTRING",
- /*  73 */ "variable ::= UQSTRING DOT UQSTRING",
- /*  74 */ "orderClause ::=",
- /*  75 */ "orderClause ::= ORDER BY columnNameList",
- /*  76 */ "orderClause ::= ORDER BY columnNameList ASC",
- /*  77 */ "orderClause ::= ORDER BY columnNameList DESC",
- /*  78 */ "columnNameList ::= columnNameList COMMA columnName",
- /*  79 */ "columnNameList ::= columnName",
- /*  80 */ "columnName ::= variable",
- /*  81 */ "skipClause ::=",
- /*  82 */ "skipClause ::= SKIP INTEGER",
- /*  83 */ "limitClause ::=",
- /*  84 */ "limitClause ::= LIMIT INTEGER",
- /*  85 */ "relation ::= EQ",
- /*  86 */ "relation ::= GT",
- /*  87 */ "relation ::= LT",
- /*  88 */ "relation ::= LE",
- /*  89 */ "relation ::= GE",
- /*  90 */ "relation ::= NE",
- /*  91 */ "value ::= INTEGER",
- /*  92 */ "value ::= DASH INTEGER",
- /*  93 */ "value ::= STRING",
- /*  94 */ "value ::= FLOAT",
- /*  95 */ "value ::= DASH FLOAT",
- /*  96 */ "value ::= TRUE",
- /*  97 */ "value ::= FALSE",
- /*  98 */ "value ::= NULLVAL",
+ /*  13 */ "indexClause ::= CREATE INDEX ON indexLabel indexProp indexTrigrams",
+ /*  14 */ "indexClause ::= DROP INDEX ON indexLabel indexProp",
+ /*  15 */ "indexTrigrams ::=",
+ /*  16 */ "indexTrigrams ::= TRIGRAM",
+ /*  17 */ "indexLabel ::= COLON UQSTRING",
+ /*  18 */ "indexProp ::= LEFT_PARENTHESIS UQSTRING RIGHT_PARENTHESIS",
+ /*  19 */ "mergeClause ::= MERGE chain",
+ /*  20 */ "setClause ::= SET setList",
+ /*  21 */ "setList ::= setElement",
+ /*  22 */ "setList ::= setList COMMA setElement",
+ /*  23 */ "setElement ::= variable EQ arithmetic_expression",
+ /*  24 */ "chain ::= node",
+ /*  25 */ "chain ::= chain link node",
+ /*  26 */ "chains ::= chain",
+ /*  27 */ "chains ::= chains COMMA chain",
+ /*  28 */ "deleteClause ::= DELETE deleteExpression",
+ /*  29 */ "deleteExpression ::= UQSTRING",
+ /*  30 */ "deleteExpression ::= deleteExpression COMMA UQSTRING",
+ /*  31 */ "node ::= LEFT_PARENTHESIS UQSTRING COLON UQSTRING properties RIGHT_PARENTHESIS",
+ /*  32 */ "node ::= LEFT_PARENTHESIS COLON UQSTRING properties RIGHT_PARENTHESIS",
+ /*  33 */ "node ::= LEFT_PARENTHESIS UQSTRING properties RIGHT_PARENTHESIS",
+ /*  34 */ "node ::= LEFT_PARENTHESIS properties RIGHT_PARENTHESIS",
+ /*  35 */ "link ::= DASH edge RIGHT_ARROW",
+ /*  36 */ "link ::= LEFT_ARROW edge DASH",
+ /*  37 */ "edge ::= LEFT_BRACKET properties edgeLength RIGHT_BRACKET",
+ /*  38 */ "edge ::= LEFT_BRACKET UQSTRING properties RIGHT_BRACKET",
+ /*  39 */ "edge ::= LEFT_BRACKET COLON UQSTRING edgeLength properties RIGHT_BRACKET",
+ /*  40 */ "edge ::= LEFT_BRACKET UQSTRING COLON UQSTRING properties RIGHT_BRACKET",
+ /*  41 */ "edgeLength ::=",
+ /*  42 */ "edgeLength ::= MUL INTEGER DOTDOT INTEGER",
+ /*  43 */ "edgeLength ::= MUL INTEGER DOTDOT",
+ /*  44 */ "edgeLength ::= MUL DOTDOT INTEGER",
+ /*  45 */ "edgeLength ::= MUL INTEGER",
+ /*  46 */ "edgeLength ::= MUL",
+ /*  47 */ "properties ::=",
+ /*  48 */ "properties ::= LEFT_CURLY_BRACKET mapLiteral RIGHT_CURLY_BRACKET",
+ /*  49 */ "mapLiteral ::= UQSTRING COLON value",
+ /*  50 */ "mapLiteral ::= UQSTRING COLON value COMMA mapLiteral",
+ /*  51 */ "whereClause ::=",
+ /*  52 */ "whereClause ::= WHERE cond",
+ /*  53 */ "cond ::= arithmetic_expression relation arithmetic_expression",
+ /*  54 */ "cond ::= LEFT_PARENTHESIS cond RIGHT_PARENTHESIS",
+ /*  55 */ "cond ::= cond AND cond",
+ /*  56 */ "cond ::= cond OR cond",
+ /*  57 */ "returnClause ::= RETURN returnElements",
+ /*  58 */ "returnClause ::= RETURN DISTINCT returnElements",
+ /*  59 */ "returnElements ::= returnElements COMMA returnElement",
+ /*  60 */ "returnElements ::= returnElement",
+ /*  61 */ "returnElement ::= arithmetic_expression",
+ /*  62 */ "returnElement ::= arithmetic_expression AS UQSTRING",
+ /*  63 */ "arithmetic_expression ::= LEFT_PARENTHESIS arithmetic_expression RIGHT_PARENTHESIS",
+ /*  64 */ "arithmetic_expression ::= arithmetic_expression ADD arithmetic_expression",
+ /*  65 */ "arithmetic_expression ::= arithmetic_expression DASH arithmetic_expression",
+ /*  66 */ "arithmetic_expression ::= arithmetic_expression MUL arithmetic_expression",
+ /*  67 */ "arithmetic_expression ::= arithmetic_expression DIV arithmetic_expression",
+ /*  68 */ "arithmetic_expression ::= UQSTRING LEFT_PARENTHESIS arithmetic_expression_list RIGHT_PARENTHESIS",
+ /*  69 */ "arithmetic_expression ::= value",
+ /*  70 */ "arithmetic_expression ::= variable",
+ /*  71 */ "arithmetic_expression_list ::= arithmetic_expression_list COMMA arithmetic_expression",
+ /*  72 */ "arithmetic_expression_list ::= arithmetic_expression",
+ /*  73 */ "variable ::= UQSTRING",
+ /*  74 */ "variable ::= UQSTRING DOT UQSTRING",
+ /*  75 */ "orderClause ::=",
+ /*  76 */ "orderClause ::= ORDER BY columnNameList",
+ /*  77 */ "orderClause ::= ORDER BY columnNameList ASC",
+ /*  78 */ "orderClause ::= ORDER BY columnNameList DESC",
+ /*  79 */ "columnNameList ::= columnNameList COMMA columnName",
+ /*  80 */ "columnNameList ::= columnName",
+ /*  81 */ "columnName ::= variable",
+ /*  82 */ "skipClause ::=",
+ /*  83 */ "skipClause ::= SKIP INTEGER",
+ /*  84 */ "limitClause ::=",
+ /*  85 */ "limitClause ::= LIMIT INTEGER",
+ /*  86 */ "relation ::= EQ",
+ /*  87 */ "relation ::= GT",
+ /*  88 */ "relation ::= LT",
+ /*  89 */ "relation ::= LE",
+ /*  90 */ "relation ::= GE",
+ /*  91 */ "relation ::= NE",
+ /*  92 */ "relation ::= STARTS WITH",
+ /*  93 */ "relation ::= ENDS WITH",
+ /*  94 */ "relation ::= CONTAINS",
+ /*  95 */ "value ::= INTEGER",
+ /*  96 */ "value ::= DASH INTEGER",
+ /*  97 */ "value ::= STRING",
+ /*  98 */ "value ::= FLOAT",
+ /*  99 */ "value ::= DASH FLOAT",
+ /* 100 */ "value ::= TRUE",
+ /* 101 */ "value ::= FALSE",
+ /* 102 */ "value ::= NULLVAL",
+ /* 103 */ "value ::= PARAMETER",
 };
 #endif /* NDEBUG */
 
@@ -750,11 +768,11 @@ static void yy_destructor(
     ** inside the C code.
     */
 /********* Begin destructor definitions ***************************************/
-    case 81: /* cond */
+    case 88: /* cond */
 {
-#line 324 "grammar.y"
- Free_AST_FilterNode((yypminor->yy82)); 
-#line 758 "grammar.c"
+#line 330 "grammar.y"
+ Free_AST_FilterNode((yypminor->yy86)); 
+#line 776 "grammar.c"
 }
       break;
 /********* End destructor definitions *****************************************/
@@ -1049,105 +1067,110 @@ static const struct {
   YYCODETYPE lhs;       /* Symbol on the left-hand side of the rule */
   signed char nrhs;     /* Negative of the number of RHS symbols in the rule */
 } yyRuleInfo[] = {
-  {   52,   -1 }, /* (0) query ::= expr */
-  {   51,   -7 }, /* (1) expr ::= matchClause whereClause createClause returnClause orderClause skipClause limitClause */
-  {   51,   -3 }, /* (2) expr ::= matchClause whereClause createClause */
-  {   51,   -3 }, /* (3) expr ::= matchClause whereClause deleteClause */
-  {   51,   -3 }, /* (4) expr ::= matchClause whereClause setClause */
-  {   51,   -7 }, /* (5) expr ::= matchClause whereClause setClause returnClause orderClause skipClause limitClause */
-  {   51,   -1 }, /* (6) expr ::= createClause */
-  {   51,   -1 }, /* (7) expr ::= indexClause */
-  {   51,   -1 }, /* (8) expr ::= mergeClause */
-  {   51,   -1 }, /* (9) expr ::= returnClause */
-  {   53,   -2 }, /* (10) matchClause ::= MATCH chains */
-  {   55,    0 }, /* (11) createClause ::= */
-  {   55,   -2 }, /* (12) createClause ::= CREATE chains */
-  {   62,   -5 }, /* (13) indexClause ::= indexOpToken INDEX ON indexLabel indexProp */
-  {   65,   -1 }, /* (14) indexOpToken ::= CREATE */
-  {   65,   -1 }, /* (15) indexOpToken ::= DROP */
-  {   66,   -2 }, /* (16) indexLabel ::= COLON UQSTRING */
-  {   67,   -3 }, /* (17) indexProp ::= LEFT_PARENTHESIS UQSTRING RIGHT_PARENTHESIS */
-  {   63,   -2 }, /* (18) mergeClause ::= MERGE chain */
-  {   61,   -2 }, /* (19) setClause ::= SET setList */
-  {   69,   -1 }, /* (20) setList ::= setElement */
-  {   69,   -3 }, /* (21) setList ::= setList COMMA setElement */
-  {   70,   -3 }, /* (22) setElement ::= variable EQ arithmetic_expression */
-  {   68,   -1 }, /* (23) chain ::= node */
-  {   68,   -3 }, /* (24) chain ::= chain link node */
-  {   64,   -1 }, /* (25) chains ::= chain */
-  {   64,   -3 }, /* (26) chains ::= chains COMMA chain */
-  {   60,   -2 }, /* (27) deleteClause ::= DELETE deleteExpression */
-  {   75,   -1 }, /* (28) deleteExpression ::= UQSTRING */
-  {   75,   -3 }, /* (29) deleteExpression ::= deleteExpression COMMA UQSTRING */
-  {   73,   -6 }, /* (30) node ::= LEFT_PARENTHESIS UQSTRING COLON UQSTRING properties RIGHT_PARENTHESIS */
-  {   73,   -5 }, /* (31) node ::= LEFT_PARENTHESIS COLON UQSTRING properties RIGHT_PARENTHESIS */
-  {   73,   -4 }, /* (32) node ::= LEFT_PARENTHESIS UQSTRING properties RIGHT_PARENTHESIS */
-  {   73,   -3 }, /* (33) node ::= LEFT_PARENTHESIS properties RIGHT_PARENTHESIS */
-  {   74,   -3 }, /* (34) link ::= DASH edge RIGHT_ARROW */
-  {   74,   -3 }, /* (35) link ::= LEFT_ARROW edge DASH */
-  {   77,   -4 }, /* (36) edge ::= LEFT_BRACKET properties edgeLength RIGHT_BRACKET */
-  {   77,   -4 }, /* (37) edge ::= LEFT_BRACKET UQSTRING properties RIGHT_BRACKET */
-  {   77,   -6 }, /* (38) edge ::= LEFT_BRACKET COLON UQSTRING edgeLength properties RIGHT_BRACKET */
-  {   77,   -6 }, /* (39) edge ::= LEFT_BRACKET UQSTRING COLON UQSTRING properties RIGHT_BRACKET */
-  {   78,    0 }, /* (40) edgeLength ::= */
-  {   78,   -4 }, /* (41) edgeLength ::= MUL INTEGER DOTDOT INTEGER */
-  {   78,   -3 }, /* (42) edgeLength ::= MUL INTEGER DOTDOT */
-  {   78,   -3 }, /* (43) edgeLength ::= MUL DOTDOT INTEGER */
-  {   78,   -2 }, /* (44) edgeLength ::= MUL INTEGER */
-  {   78,   -1 }, /* (45) edgeLength ::= MUL */
-  {   76,    0 }, /* (46) properties ::= */
-  {   76,   -3 }, /* (47) properties ::= LEFT_CURLY_BRACKET mapLiteral RIGHT_CURLY_BRACKET */
-  {   79,   -3 }, /* (48) mapLiteral ::= UQSTRING COLON value */
-  {   79,   -5 }, /* (49) mapLiteral ::= UQSTRING COLON value COMMA mapLiteral */
-  {   54,    0 }, /* (50) whereClause ::= */
-  {   54,   -2 }, /* (51) whereClause ::= WHERE cond */
-  {   81,   -3 }, /* (52) cond ::= arithmetic_expression relation arithmetic_expression */
-  {   81,   -3 }, /* (53) cond ::= LEFT_PARENTHESIS cond RIGHT_PARENTHESIS */
-  {   81,   -3 }, /* (54) cond ::= cond AND cond */
-  {   81,   -3 }, /* (55) cond ::= cond OR cond */
-  {   56,   -2 }, /* (56) returnClause ::= RETURN returnElements */
-  {   56,   -3 }, /* (57) returnClause ::= RETURN DISTINCT returnElements */
-  {   83,   -3 }, /* (58) returnElements ::= returnElements COMMA returnElement */
-  {   83,   -1 }, /* (59) returnElements ::= returnElement */
-  {   84,   -1 }, /* (60) returnElement ::= arithmetic_expression */
-  {   84,   -3 }, /* (61) returnElement ::= arithmetic_expression AS UQSTRING */
-  {   72,   -3 }, /* (62) arithmetic_expression ::= LEFT_PARENTHESIS arithmetic_expression RIGHT_PARENTHESIS */
-  {   72,   -3 }, /* (63) arithmetic_expression ::= arithmetic_expression ADD arithmetic_expression */
-  {   72,   -3 }, /* (64) arithmetic_expression ::= arithmetic_expression DASH arithmetic_expression */
-  {   72,   -3 }, /* (65) arithmetic_expression ::= arithmetic_expression MUL arithmetic_expression */
-  {   72,   -3 }, /* (66) arithmetic_expression ::= arithmetic_expression DIV arithmetic_expression */
-  {   72,   -4 }, /* (67) arithmetic_expression ::= UQSTRING LEFT_PARENTHESIS arithmetic_expression_list RIGHT_PARENTHESIS */
-  {   72,   -1 }, /* (68) arithmetic_expression ::= value */
-  {   72,   -1 }, /* (69) arithmetic_expression ::= variable */
-  {   85,   -3 }, /* (70) arithmetic_expression_list ::= arithmetic_expression_list COMMA arithmetic_expression */
-  {   85,   -1 }, /* (71) arithmetic_expression_list ::= arithmetic_expression */
-  {   71,   -1 }, /* (72) variable ::= UQSTRING */
-  {   71,   -3 }, /* (73) variable ::= UQSTRING DOT UQSTRING */
-  {   57,    0 }, /* (74) orderClause ::= */
-  {   57,   -3 }, /* (75) orderClause ::= ORDER BY columnNameList */
-  {   57,   -4 }, /* (76) orderClause ::= ORDER BY columnNameList ASC */
-  {   57,   -4 }, /* (77) orderClause ::= ORDER BY columnNameList DESC */
-  {   86,   -3 }, /* (78) columnNameList ::= columnNameList COMMA columnName */
-  {   86,   -1 }, /* (79) columnNameList ::= columnName */
-  {   87,   -1 }, /* (80) columnName ::= variable */
-  {   58,    0 }, /* (81) skipClause ::= */
-  {   58,   -2 }, /* (82) skipClause ::= SKIP INTEGER */
-  {   59,    0 }, /* (83) limitClause ::= */
-  {   59,   -2 }, /* (84) limitClause ::= LIMIT INTEGER */
-  {   82,   -1 }, /* (85) relation ::= EQ */
-  {   82,   -1 }, /* (86) relation ::= GT */
-  {   82,   -1 }, /* (87) relation ::= LT */
-  {   82,   -1 }, /* (88) relation ::= LE */
-  {   82,   -1 }, /* (89) relation ::= GE */
-  {   82,   -1 }, /* (90) relation ::= NE */
-  {   80,   -1 }, /* (91) value ::= INTEGER */
-  {   80,   -2 }, /* (92) value ::= DASH INTEGER */
-  {   80,   -1 }, /* (93) value ::= STRING */
-  {   80,   -1 }, /* (94) value ::= FLOAT */
-  {   80,   -2 }, /* (95) value ::= DASH FLOAT */
-  {   80,   -1 }, /* (96) value ::= TRUE */
-  {   80,   -1 }, /* (97) value ::= FALSE */
-  {   80,   -1 }, /* (98) value ::= NULLVAL */
+  {   59,   -1 }, /* (0) query ::= expr */
+  {   58,   -7 }, /* (1) expr ::= matchClause whereClause createClause returnClause orderClause skipClause limitClause */
+  {   58,   -3 }, /* (2) expr ::= matchClause whereClause createClause */
+  {   58,   -3 }, /* (3) expr ::= matchClause whereClause deleteClause */
+  {   58,   -3 }, /* (4) expr ::= matchClause whereClause setClause */
+  {   58,   -7 }, /* (5) expr ::= matchClause whereClause setClause returnClause orderClause skipClause limitClause */
+  {   58,   -1 }, /* (6) expr ::= createClause */
+  {   58,   -1 }, /* (7) expr ::= indexClause */
+  {   58,   -1 }, /* (8) expr ::= mergeClause */
+  {   58,   -1 }, /* (9) expr ::= returnClause */
+  {   60,   -2 }, /* (10) matchClause ::= MATCH chains */
+  {   62,    0 }, /* (11) createClause ::= */
+  {   62,   -2 }, /* (12) createClause ::= CREATE chains */
+  {   69,   -6 }, /* (13) indexClause ::= CREATE INDEX ON indexLabel indexProp indexTrigrams */
+  {   69,   -5 }, /* (14) indexClause ::= DROP INDEX ON indexLabel indexProp */
+  {   74,    0 }, /* (15) indexTrigrams ::= */
+  {   74,   -1 }, /* (16) indexTrigrams ::= TRIGRAM */
+  {   72,   -2 }, /* (17) indexLabel ::= COLON UQSTRING */
+  {   73,   -3 }, /* (18) indexProp ::= LEFT_PARENTHESIS UQSTRING RIGHT_PARENTHESIS */
+  {   70,   -2 }, /* (19) mergeClause ::= MERGE chain */
+  {   68,   -2 }, /* (20) setClause ::= SET setList */
+  {   76,   -1 }, /* (21) setList ::= setElement */
+  {   76,   -3 }, /* (22) setList ::= setList COMMA setElement */
+  {   77,   -3 }, /* (23) setElement ::= variable EQ arithmetic_expression */
+  {   75,   -1 }, /* (24) chain ::= node */
+  {   75,   -3 }, /* (25) chain ::= chain link node */
+  {   71,   -1 }, /* (26) chains ::= chain */
+  {   71,   -3 }, /* (27) chains ::= chains COMMA chain */
+  {   67,   -2 }, /* (28) deleteClause ::= DELETE deleteExpression */
+  {   82,   -1 }, /* (29) deleteExpression ::= UQSTRING */
+  {   82,   -3 }, /* (30) deleteExpression ::= deleteExpression COMMA UQSTRING */
+  {   80,   -6 }, /* (31) node ::= LEFT_PARENTHESIS UQSTRING COLON UQSTRING properties RIGHT_PARENTHESIS */
+  {   80,   -5 }, /* (32) node ::= LEFT_PARENTHESIS COLON UQSTRING properties RIGHT_PARENTHESIS */
+  {   80,   -4 }, /* (33) node ::= LEFT_PARENTHESIS UQSTRING properties RIGHT_PARENTHESIS */
+  {   80,   -3 }, /* (34) node ::= LEFT_PARENTHESIS properties RIGHT_PARENTHESIS */
+  {   81,   -3 }, /* (35) link ::= DASH edge RIGHT_ARROW */
+  {   81,   -3 }, /* (36) link ::= LEFT_ARROW edge DASH */
+  {   84,   -4 }, /* (37) edge ::= LEFT_BRACKET properties edgeLength RIGHT_BRACKET */
+  {   84,   -4 }, /* (38) edge ::= LEFT_BRACKET UQSTRING properties RIGHT_BRACKET */
+  {   84,   -6 }, /* (39) edge ::= LEFT_BRACKET COLON UQSTRING edgeLength properties RIGHT_BRACKET */
+  {   84,   -6 }, /* (40) edge ::= LEFT_BRACKET UQSTRING COLON UQSTRING properties RIGHT_BRACKET */
+  {   85,    0 }, /* (41) edgeLength ::= */
+  {   85,   -4 }, /* (42) edgeLength ::= MUL INTEGER DOTDOT INTEGER */
+  {   85,   -3 }, /* (43) edgeLength ::= MUL INTEGER DOTDOT */
+  {   85,   -3 }, /* (44) edgeLength ::= MUL DOTDOT INTEGER */
+  {   85,   -2 }, /* (45) edgeLength ::= MUL INTEGER */
+  {   85,   -1 }, /* (46) edgeLength ::= MUL */
+  {   83,    0 }, /* (47) properties ::= */
+  {   83,   -3 }, /* (48) properties ::= LEFT_CURLY_BRACKET mapLiteral RIGHT_CURLY_BRACKET */
+  {   86,   -3 }, /* (49) mapLiteral ::= UQSTRING COLON value */
+  {   86,   -5 }, /* (50) mapLiteral ::= UQSTRING COLON value COMMA mapLiteral */
+  {   61,    0 }, /* (51) whereClause ::= */
+  {   61,   -2 }, /* (52) whereClause ::= WHERE cond */
+  {   88,   -3 }, /* (53) cond ::= arithmetic_expression relation arithmetic_expression */
+  {   88,   -3 }, /* (54) cond ::= LEFT_PARENTHESIS cond RIGHT_PARENTHESIS */
+  {   88,   -3 }, /* (55) cond ::= cond AND cond */
+  {   88,   -3 }, /* (56) cond ::= cond OR cond */
+  {   63,   -2 }, /* (57) returnClause ::= RETURN returnElements */
+  {   63,   -3 }, /* (58) returnClause ::= RETURN DISTINCT returnElements */
+  {   90,   -3 }, /* (59) returnElements ::= returnElements COMMA returnElement */
+  {   90,   -1 }, /* (60) returnElements ::= returnElement */
+  {   91,   -1 }, /* (61) returnElement ::= arithmetic_expression */
+  {   91,   -3 }, /* (62) returnElement ::= arithmetic_expression AS UQSTRING */
+  {   79,   -3 }, /* (63) arithmetic_expression ::= LEFT_PARENTHESIS arithmetic_expression RIGHT_PARENTHESIS */
+  {   79,   -3 }, /* (64) arithmetic_expression ::= arithmetic_expression ADD arithmetic_expression */
+  {   79,   -3 }, /* (65) arithmetic_expression ::= arithmetic_expression DASH arithmetic_expression */
+  {   79,   -3 }, /* (66) arithmetic_expression ::= arithmetic_expression MUL arithmetic_expression */
+  {   79,   -3 }, /* (67) arithmetic_expression ::= arithmetic_expression DIV arithmetic_expression */
+  {   79,   -4 }, /* (68) arithmetic_expression ::= UQSTRING LEFT_PARENTHESIS arithmetic_expression_list RIGHT_PARENTHESIS */
+  {   79,   -1 }, /* (69) arithmetic_expression ::= value */
+  {   79,   -1 }, /* (70) arithmetic_expression ::= variable */
+  {   92,   -3 }, /* (71) arithmetic_expression_list ::= arithmetic_expression_list COMMA arithmetic_expression */
+  {   92,   -1 }, /* (72) arithmetic_expression_list ::= arithmetic_expression */
+  {   78,   -1 }, /* (73) variable ::= UQSTRING */
+  {   78,   -3 }, /* (74) variable ::= UQSTRING DOT UQSTRING */
+  {   64,    0 }, /* (75) orderClause ::= */
+  {   64,   -3 }, /* (76) orderClause ::= ORDER BY columnNameList */
+  {   64,   -4 }, /* (77) orderClause ::= ORDER BY columnNameList ASC */
+  {   64,   -4 }, /* (78) orderClause ::= ORDER BY columnNameList DESC */
+  {   93,   -3 }, /* (79) columnNameList ::= columnNameList COMMA columnName */
+  {   93,   -1 }, /* (80) columnNameList ::= columnName */
+  {   94,   -1 }, /* (81) columnName ::= variable */
+  {   65,    0 }, /* (82) skipClause ::= */
+  {   65,   -2 }, /* (83) skipClause ::= SKIP INTEGER */
+  {   66,    0 }, /* (84) limitClause ::= */
+  {   66,   -2 }, /* (85) limitClause ::= LIMIT INTEGER */
+  {   89,   -1 }, /* (86) relation ::= EQ */
+  {   89,   -1 }, /* (87) relation ::= GT */
+  {   89,   -1 }, /* (88) relation ::= LT */
+  {   89,   -1 }, /* (89) relation ::= LE */
+  {   89,   -1 }, /* (90) relation ::= GE */
+  {   89,   -1 }, /* (91) relation ::= NE */
+  {   89,   -2 }, /* (92) relation ::= STARTS WITH */
+  {   89,   -2 }, /* (93) relation ::= ENDS WITH */
+  {   89,   -1 }, /* (94) relation ::= CONTAINS */
+  {   87,   -1 }, /* (95) value ::= INTEGER */
+  {   87,   -2 }, /* (96) value ::= DASH INTEGER */
+  {   87,   -1 }, /* (97) value ::= STRING */
+  {   87,   -1 }, /* (98) value ::= FLOAT */
+  {   87,   -2 }, /* (99) value ::= DASH FLOAT */
+  {   87,   -1 }, /* (100) value ::= TRUE */
+  {   87,   -1 }, /* (101) value ::= FALSE */
+  {   87,   -1 }, /* (102) value ::= NULLVAL */
+  {   87,   -1 }, /* (103) value ::= PARAMETER */
 };
 
 static void yy_accept(yyParser*);  /* Forward Declaration */
@@ -1228,752 +1251,783 @@ static void yy_reduce(
 /********** Begin reduce actions **********************************************/
         YYMINORTYPE yylhsminor;
       case 0: /* query ::= expr */
-#line 44 "grammar.y"
-{ ctx->root = yymsp[0].minor.yy40; }
-#line 1234 "grammar.c"
+#line 45 "grammar.y"
+{ ctx->root = yymsp[0].minor.yy122; }
+#line 1257 "grammar.c"
         break;
       case 1: /* expr ::= matchClause whereClause createClause returnClause orderClause skipClause limitClause */
-#line 46 "grammar.y"
+#line 47 "grammar.y"
 {
-	yylhsminor.yy40 = New_AST_Query(yymsp[-6].minor.yy133, yymsp[-5].minor.yy83, yymsp[-4].minor.yy140, NULL, NULL, NULL, yymsp[-3].minor.yy48, yymsp[-2].minor.yy52, yymsp[-1].minor.yy115, yymsp[0].minor.yy127, NULL);
+	yylhsminor.yy122 = New_AST_Query(yymsp[-6].minor.yy155, yymsp[-5].minor.yy181, yymsp[-4].minor.yy96, NULL, NULL, NULL, yymsp[-3].minor.yy188, yymsp[-2].minor.yy28, yymsp[-1].minor.yy173, yymsp[0].minor.yy77, NULL);
 }
-#line 1241 "grammar.c"
-  yymsp[-6].minor.yy40 = yylhsminor.yy40;
+#line 1264 "grammar.c"
+  yymsp[-6].minor.yy122 = yylhsminor.yy122;
         break;
       case 2: /* expr ::= matchClause whereClause createClause */
-#line 50 "grammar.y"
+#line 51 "grammar.y"
 {
-	yylhsminor.yy40 = New_AST_Query(yymsp[-2].minor.yy133, yymsp[-1].minor.yy83, yymsp[0].minor.yy140, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL);
+	yylhsminor.yy122 = New_AST_Query(yymsp[-2].minor.yy155, yymsp[-1].minor.yy181, yymsp[0].minor.yy96, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL);
 }
-#line 1249 "grammar.c"
-  yymsp[-2].minor.yy40 = yylhsminor.yy40;
+#line 1272 "grammar.c"
+  yymsp[-2].minor.yy122 = yylhsminor.yy122;
         break;
       case 3: /* expr ::= matchClause whereClause deleteClause */
-#line 54 "grammar.y"
+#line 55 "grammar.y"
 {
-	yylhsminor.yy40 = New_AST_Query(yymsp[-2].minor.yy133, yymsp[-1].minor.yy83, NULL, NULL, NULL, yymsp[0].minor.yy31, NULL, NULL, NULL, NULL, NULL);
+	yylhsminor.yy122 = New_AST_Query(yymsp[-2].minor.yy155, yymsp[-1].minor.yy181, NULL, NULL, NULL, yymsp[0].minor.yy115, NULL, NULL, NULL, NULL, NULL);
 }
-#line 1257 "grammar.c"
-  yymsp[-2].minor.yy40 = yylhsminor.yy40;
+#line 1280 "grammar.c"
+  yymsp[-2].minor.yy122 = yylhsminor.yy122;
         break;
       case 4: /* expr ::= matchClause whereClause setClause */
-#line 58 "grammar.y"
+#line 59 "grammar.y"
 {
-	yylhsminor.yy40 = New_AST_Query(yymsp[-2].minor.yy133, yymsp[-1].minor.yy83, NULL, NULL, yymsp[0].minor.yy12, NULL, NULL, NULL, NULL, NULL, NULL);
+	yylhsminor.yy122 = New_AST_Query(yymsp[-2].minor.yy155, yymsp[-1].minor.yy181, NULL, NULL, yymsp[0].minor.yy130, NULL, NULL, NULL, NULL, NULL, NULL);
 }
-#line 1265 "grammar.c"
-  yymsp[-2].minor.yy40 = yylhsminor.yy40;
+#line 1288 "grammar.c"
+  yymsp[-2].minor.yy122 = yylhsminor.yy122;
         break;
       case 5: /* expr ::= matchClause whereClause setClause returnClause orderClause skipClause limitClause */
-#line 62 "grammar.y"
+#line 63 "grammar.y"
 {
-	yylhsminor.yy40 = New_AST_Query(yymsp[-6].minor.yy133, yymsp[-5].minor.yy83, NULL, NULL, yymsp[-4].minor.yy12, NULL, yymsp[-3].minor.yy48, yymsp[-2].minor.yy52, yymsp[-1].minor.yy115, yymsp[0].minor.yy127, NULL);
+	yylhsminor.yy122 = New_AST_Query(yymsp[-6].minor.yy155, yymsp[-5].minor.yy181, NULL, NULL, yymsp[-4].minor.yy130, NULL, yymsp[-3].minor.yy188, yymsp[-2].minor.yy28, yymsp[-1].minor.yy173, yymsp[0].minor.yy77, NULL);
 }
-#line 1273 "grammar.c"
-  yymsp[-6].minor.yy40 = yylhsminor.yy40;
+#line 1296 "grammar.c"
+  yymsp[-6].minor.yy122 = yylhsminor.yy122;
         break;
       case 6: /* expr ::= createClause */
-#line 66 "grammar.y"
+#line 67 "grammar.y"
 {
-	yylhsminor.yy40 = New_AST_Query(NULL, NULL, yymsp[0].minor.yy140, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL);
+	yylhsminor.yy122 = New_AST_Query(NULL, NULL, yymsp[0].minor.yy96, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL);
 }
-#line 1281 "grammar.c"
-  yymsp[0].minor.yy40 = yylhsminor.yy40;
+#line 1304 "grammar.c"
+  yymsp[0].minor.yy122 = yylhsminor.yy122;
         break;
       case 7: /* expr ::= indexClause */
-#line 70 "grammar.y"
+#line 71 "grammar.y"
 {
-	yylhsminor.yy40 = New_AST_Query(NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, yymsp[0].minor.yy32);
+	yylhsminor.yy122 = New_AST_Query(NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, yymsp[0].minor.yy74);
 }
-#line 1289 "grammar.c"
-  yymsp[0].minor.yy40 = yylhsminor.yy40;
+#line 1312 "grammar.c"
+  yymsp[0].minor.yy122 = yylhsminor.yy122;
         break;
       case 8: /* expr ::= mergeClause */
-#line 74 "grammar.y"
+#line 75 "grammar.y"
 {
-	yylhsminor.yy40 = New_AST_Query(NULL, NULL, NULL, yymsp[0].minor.yy132, NULL, NULL, NULL, NULL, NULL, NULL, NULL);
+	yylhsminor.yy122 = New_AST_Query(NULL, NULL, NULL, yymsp[0].minor.yy10, NULL, NULL, NULL, NULL, NULL, NULL, NULL);
 }
-#line 1297 "grammar.c"
-  yymsp[0].minor.yy40 = yylhsminor.yy40;
+#line 1320 "grammar.c"
+  yymsp[0].minor.yy122 = yylhsminor.yy122;
         break;
       case 9: /* expr ::= returnClause */
-#line 78 "grammar.y"
+#line 79 "grammar.y"
 {
-	yylhsminor.yy40 = New_AST_Query(NULL, NULL, NULL, NULL, NULL, NULL, yymsp[0].minor.yy48, NULL, NULL, NULL, NULL);
+	yylhsminor.yy122 = New_AST_Query(NULL, NULL, NULL, NULL, NULL, NULL, yymsp[0].minor.yy188, NULL, NULL, NULL, NULL);
 }
-#line 1305 "grammar.c"
-  yymsp[0].minor.yy40 = yylhsminor.yy40;
+#line 1328 "grammar.c"
+  yymsp[0].minor.yy122 = yylhsminor.yy122;
         break;
       case 10: /* matchClause ::= MATCH chains */
-#line 84 "grammar.y"
+#line 85 "grammar.y"
 {
-	yymsp[-1].minor.yy133 = New_AST_MatchNode(yymsp[0].minor.yy130);
+	yymsp[-1].minor.yy155 = New_AST_MatchNode(yymsp[0].minor.yy116);
 }
-#line 1313 "grammar.c"
+#line 1336 "grammar.c"
         break;
       case 11: /* createClause ::= */
-#line 91 "grammar.y"
+#line 92 "grammar.y"
 {
-	yymsp[1].minor.yy140 = NULL;
+	yymsp[1].minor.yy96 = NULL;
 }
-#line 1320 "grammar.c"
+#line 1343 "grammar.c"
         break;
       case 12: /* createClause ::= CREATE chains */
-#line 95 "grammar.y"
+#line 96 "grammar.y"
 {
-	yymsp[-1].minor.yy140 = New_AST_CreateNode(yymsp[0].minor.yy130);
+	yymsp[-1].minor.yy96 = New_AST_CreateNode(yymsp[0].minor.yy116);
 }
-#line 1327 "grammar.c"
+#line 1350 "grammar.c"
         break;
-      case 13: /* indexClause ::= indexOpToken INDEX ON indexLabel indexProp */
-#line 101 "grammar.y"
+      case 13: /* indexClause ::= CREATE INDEX ON indexLabel indexProp indexTrigrams */
+#line 102 "grammar.y"
 {
-  yylhsminor.yy32 = New_AST_IndexNode(yymsp[-1].minor.yy0.strval, yymsp[0].minor.yy0.strval, yymsp[-4].minor.yy89);
+  yymsp[-5].minor.yy74 = New_AST_IndexNode(yymsp[-2].minor.yy0.strval, yymsp[-1].minor.yy0.strval, CREATE_INDEX, yymsp[0].minor.yy147);
 }
-#line 1334 "grammar.c"
-  yymsp[-4].minor.yy32 = yylhsminor.yy32;
-        break;
-      case 14: /* indexOpToken ::= CREATE */
-#line 107 "grammar.y"
-{ yymsp[0].minor.yy89 = CREATE_INDEX; }
-#line 1340 "grammar.c"
+#line 1357 "grammar.c"
         break;
-      case 15: /* indexOpToken ::= DROP */
-#line 108 "grammar.y"
-{ yymsp[0].minor.yy89 = DROP_INDEX; }
-#line 1345 "grammar.c"
-        break;
-      case 16: /* indexLabel ::= COLON UQSTRING */
-#line 110 "grammar.y"
+      case 14: /* indexClause ::= DROP INDEX ON indexLabel indexProp */
+#line 106 "grammar.y"
 {
-  yymsp[-1].minor.yy0 = yymsp[0].minor.yy0;
+  yymsp[-4].minor.yy74 = New_AST_IndexNode(yymsp[-1].minor.yy0.strval, yymsp[0].minor.yy0.strval, DROP_INDEX, false);
 }
-#line 1352 "grammar.c"
+#line 1364 "grammar.c"
+        break;
+      case 15: /* indexTrigrams ::= */
+#line 113 "grammar.y"
+{ yymsp[1].minor.yy147 = false; }
+#line 1369 "grammar.c"
         break;
-      case 17: /* indexProp ::= LEFT_PARENTHESIS UQSTRING RIGHT_PARENTHESIS */
+      case 16: /* indexTrigrams ::= TRIGRAM */
 #line 114 "grammar.y"
+{ yymsp[0].minor.yy147 = true; }
+#line 1374 "grammar.c"
+        break;
+      case 17: /* indexLabel ::= COLON UQSTRING */
+#line 116 "grammar.y"
 {
-  yymsp[-2].minor.yy0 = yymsp[-1].minor.yy0;
+  yymsp[-1].minor.yy0 = yymsp[0].minor.yy0;
 }
-#line 1359 "grammar.c"
+#line 1381 "grammar.c"
         break;
-      case 18: /* mergeClause ::= MERGE chain */
+      case 18: /* indexProp ::= LEFT_PARENTHESIS UQSTRING RIGHT_PARENTHESIS */
 #line 120 "grammar.y"
 {
-	yymsp[-1].minor.yy132 = New_AST_MergeNode(yymsp[0].minor.yy130);
+  yymsp[-2].minor.yy0 = yymsp[-1].minor.yy0;
 }
-#line 1366 "grammar.c"
+#line 1388 "grammar.c"
         break;
-      case 19: /* setClause ::= SET setList */
-#line 125 "grammar.y"
+      case 19: /* mergeClause ::= MERGE chain */
+#line 126 "grammar.y"
 {
-	yymsp[-1].minor.yy12 = New_AST_SetNode(yymsp[0].minor.yy130);
+	yymsp[-1].minor.yy10 = New_AST_MergeNode(yymsp[0].minor.yy116);
 }
-#line 1373 "grammar.c"
+#line 1395 "grammar.c"
         break;
-      case 20: /* setList ::= setElement */
-#line 130 "grammar.y"
+      case 20: /* setClause ::= SET setList */
+#line 131 "grammar.y"
 {
-	yylhsminor.yy130 = NewVector(AST_SetElement*, 1);
-	Vector_Push(yylhsminor.yy130, yymsp[0].minor.yy88);
+	yymsp[-1].minor.yy130 = New_AST_SetNode(yymsp[0].minor.yy116);
 }
-#line 1381 "grammar.c"
-  yymsp[0].minor.yy130 = yylhsminor.yy130;
+#line 1402 "grammar.c"
         break;
-      case 21: /* setList ::= setList COMMA setElement */
-#line 134 "grammar.y"
+      case 21: /* setList ::= setElement */
+#line 136 "grammar.y"
 {
-	Vector_Push(yymsp[-2].minor.yy130, yymsp[0].minor.yy88);
-	yylhsminor.yy130 = yymsp[-2].minor.yy130;
+	yylhsminor.yy116 = NewVector(AST_SetElement*, 1);
+	Vector_Push(yylhsminor.yy116, yymsp[0].minor.yy124);
 }
-#line 1390 "grammar.c"
-  yymsp[-2].minor.yy130 = yylhsminor.yy130;
+#line 1410 "grammar.c"
+  yymsp[0].minor.yy116 = yylhsminor.yy116;
         break;
-      case 22: /* setElement ::= variable EQ arithmetic_expression */
+      case 22: /* setList ::= setList COMMA setElement */
 #line 140 "grammar.y"
 {
-	yylhsminor.yy88 = New_AST_SetElement(yymsp[-2].minor.yy116, yymsp[0].minor.yy2);
+	Vector_Push(yymsp[-2].minor.yy116, yymsp[0].minor.yy124);
+	yylhsminor.yy116 = yymsp[-2].minor.yy116;
 }
-#line 1398 "grammar.c"
-  yymsp[-2].minor.yy88 = yylhsminor.yy88;
+#line 1419 "grammar.c"
+  yymsp[-2].minor.yy116 = yylhsminor.yy116;
         break;
-      case 23: /* chain ::= node */
+      case 23: /* setElement ::= variable EQ arithmetic_expression */
 #line 146 "grammar.y"
 {
-	yylhsminor.yy130 = NewVector(AST_GraphEntity*, 1);
-	Vector_Push(yylhsminor.yy130, yymsp[0].minor.yy69);
+	yylhsminor.yy124 = New_AST_SetElement(yymsp[-2].minor.yy120, yymsp[0].minor.yy154);
 }
-#line 1407 "grammar.c"
-  yymsp[0].minor.yy130 = yylhsminor.yy130;
+#line 1427 "grammar.c"
+  yymsp[-2].minor.yy124 = yylhsminor.yy124;
         break;
-      case 24: /* chain ::= chain link node */
-#line 151 "grammar.y"
+      case 24: /* chain ::= node */
+#line 152 "grammar.y"
 {
-	Vector_Push(yymsp[-2].minor.yy130, yymsp[-1].minor.yy61);
-	Vector_Push(yymsp[-2].minor.yy130, yymsp[0].minor.yy69);
-	yylhsminor.yy130 = yymsp[-2].minor.yy130;
+	yylhsminor.yy116 = NewVector(AST_GraphEntity*, 1);
+	Vector_Push(yylhsminor.yy116, yymsp[0].minor.yy89);
 }
-#line 1417 "grammar.c"
-  yymsp[-2].minor.yy130 = yylhsminor.yy130;
+#line 1436 "grammar.c"
+  yymsp[0].minor.yy116 = yylhsminor.yy116;
         break;
-      case 25: /* chains ::= chain */
-#line 159 "grammar.y"
+      case 25: /* chain ::= chain link node */
+#line 157 "grammar.y"
 {
-	yylhsminor.yy130 = NewVector(Vector*, 1);
-	Vector_Push(yylhsminor.yy130, yymsp[0].minor.yy130);
+	Vector_Push(yymsp[-2].minor.yy116, yymsp[-1].minor.yy35);
+	Vector_Push(yymsp[-2].minor.yy116, yymsp[0].minor.yy89);
+	yylhsminor.yy116 = yymsp[-2].minor.yy116;
 }
-#line 1426 "grammar.c"
-  yymsp[0].minor.yy130 = yylhsminor.yy130;
+#line 1446 "grammar.c"
+  yymsp[-2].minor.yy116 = yylhsminor.yy116;
         break;
-      case 26: /* chains ::= chains COMMA chain */
-#line 164 "grammar.y"
+      case 26: /* chains ::= chain */
+#line 165 "grammar.y"
 {
-	Vector_Push(yymsp[-2].minor.yy130, yymsp[0].minor.yy130);
-	yylhsminor.yy130 = yymsp[-2].minor.yy130;
+	yylhsminor.yy116 = NewVector(Vector*, 1);
+	Vector_Push(yylhsminor.yy116, yymsp[0].minor.yy116);
 }
-#line 1435 "grammar.c"
-  yymsp[-2].minor.yy130 = yylhsminor.yy130;
+#line 1455 "grammar.c"
+  yymsp[0].minor.yy116 = yylhsminor.yy116;
         break;
-      case 27: /* deleteClause ::= DELETE deleteExpression */
-#line 172 "grammar.y"
+      case 27: /* chains ::= chains COMMA chain */
+#line 170 "grammar.y"
 {
-	yymsp[-1].minor.yy31 = New_AST_DeleteNode(yymsp[0].minor.yy130);
+	Vector_Push(yymsp[-2].minor.yy116, yymsp[0].minor.yy116);
+	yylhsminor.yy116 = yymsp[-2].minor.yy116;
 }
-#line 1443 "grammar.c"
+#line 1464 "grammar.c"
+  yymsp[-2].minor.yy116 = yylhsminor.yy116;
         break;
-      case 28: /* deleteExpression ::= UQSTRING */
+      case 28: /* deleteClause ::= DELETE deleteExpression */
 #line 178 "grammar.y"
 {
-	yylhsminor.yy130 = NewVector(char*, 1);
-	Vector_Push(yylhsminor.yy130, yymsp[0].minor.yy0.strval);
+	yymsp[-1].minor.yy115 = New_AST_DeleteNode(yymsp[0].minor.yy116);
 }
-#line 1451 "grammar.c"
-  yymsp[0].minor.yy130 = yylhsminor.yy130;
+#line 1472 "grammar.c"
         break;
-      case 29: /* deleteExpression ::= deleteExpression COMMA UQSTRING */
-#line 183 "grammar.y"
+      case 29: /* deleteExpression ::= UQSTRING */
+#line 184 "grammar.y"
 {
-	Vector_Push(yymsp[-2].minor.yy130, yymsp[0].minor.yy0.strval);
-	yylhsminor.yy130 = yymsp[-2].minor.yy130;
+	yylhsminor.yy116 = NewVector(char*, 1);
+	Vector_Push(yylhsminor.yy116, yymsp[0].minor.yy0.strval);
 }
-#line 1460 "grammar.c"
-  yymsp[-2].minor.yy130 = yylhsminor.yy130;
+#line 1480 "grammar.c"
+  yymsp[0].minor.yy116 = yylhsminor.yy116;
         break;
-      case 30: /* node ::= LEFT_PARENTHESIS UQSTRING COLON UQSTRING properties RIGHT_PARENTHESIS */
-#line 191 "grammar.y"
+      case 30: /* deleteExpression ::= deleteExpression COMMA UQSTRING */
+#line 189 "grammar.y"
 {
-	yymsp[-5].minor.yy69 = New_AST_NodeEntity(yymsp[-4].minor.yy0.strval, yymsp[-2].minor.yy0.strval, yymsp[-1].minor.yy130);
+	Vector_Push(yymsp[-2].minor.yy116, yymsp[0].minor.yy0.strval);
+	yylhsminor.yy116 = yymsp[-2].minor.yy116;
 }
-#line 1468 "grammar.c"
+#line 1489 "grammar.c"
+  yymsp[-2].minor.yy116 = yylhsminor.yy116;
         break;
-      case 31: /* node ::= LEFT_PARENTHESIS COLON UQSTRING properties RIGHT_PARENTHESIS */
-#line 196 "grammar.y"
+      case 31: /* node ::= LEFT_PARENTHESIS UQSTRING COLON UQSTRING properties RIGHT_PARENTHESIS */
+#line 197 "grammar.y"
 {
-	yymsp[-4].minor.yy69 = New_AST_NodeEntity(NULL, yymsp[-2].minor.yy0.strval, yymsp[-1].minor.yy130);
+	yymsp[-5].minor.yy89 = New_AST_NodeEntity(yymsp[-4].minor.yy0.strval, yymsp[-2].minor.yy0.strval, yymsp[-1].minor.yy116);
 }
-#line 1475 "grammar.c"
+#line 1497 "grammar.c"
         break;
-      case 32: /* node ::= LEFT_PARENTHESIS UQSTRING properties RIGHT_PARENTHESIS */
-#line 201 "grammar.y"
+      case 32: /* node ::= LEFT_PARENTHESIS COLON UQSTRING properties RIGHT_PARENTHESIS */
+#line 202 "grammar.y"
 {
-	yymsp[-3].minor.yy69 = New_AST_NodeEntity(yymsp[-2].minor.yy0.strval, NULL, yymsp[-1].minor.yy130);
+	yymsp[-4].minor.yy89 = New_AST_NodeEntity(NULL, yymsp[-2].minor.yy0.strval, yymsp[-1].minor.yy116);
 }
-#line 1482 "grammar.c"
+#line 1504 "grammar.c"
         break;
-      case 33: /* node ::= LEFT_PARENTHESIS properties RIGHT_PARENTHESIS */
-#line 206 "grammar.y"
+      case 33: /* node ::= LEFT_PARENTHESIS UQSTRING properties RIGHT_PARENTHESIS */
+#line 207 "grammar.y"
 {
-	yymsp[-2].minor.yy69 = New_AST_NodeEntity(NULL, NULL, yymsp[-1].minor.yy130);
+	yymsp[-3].minor.yy89 = New_AST_NodeEntity(yymsp[-2].minor.yy0.strval, NULL, yymsp[-1].minor.yy116);
 }
-#line 1489 "grammar.c"
+#line 1511 "grammar.c"
         break;
-      case 34: /* link ::= DASH edge RIGHT_ARROW */
-#line 213 "grammar.y"
+      case 34: /* node ::= LEFT_PARENTHESIS properties RIGHT_PARENTHESIS */
+#line 212 "grammar.y"
 {
-	yymsp[-2].minor.yy61 = yymsp[-1].minor.yy61;
-	yymsp[-2].minor.yy61->direction = N_LEFT_TO_RIGHT;
+	yymsp[-2].minor.yy89 = New_AST_NodeEntity(NULL, NULL, yymsp[-1].minor.yy116);
 }
-#line 1497 "grammar.c"
+#line 1518 "grammar.c"
         break;
-      case 35: /* link ::= LEFT_ARROW edge DASH */
+      case 35: /* link ::= DASH edge RIGHT_ARROW */
 #line 219 "grammar.y"
 {
-	yymsp[-2].minor.yy61 = yymsp[-1].minor.yy61;
-	yymsp[-2].minor.yy61->direction = N_RIGHT_TO_LEFT;
+	yymsp[-2].minor.yy35 = yymsp[-1].minor.yy35;
+	yymsp[-2].minor.yy35->direction = N_LEFT_TO_RIGHT;
 }
-#line 1505 "grammar.c"
+#line 1526 "grammar.c"
         break;
-      case 36: /* edge ::= LEFT_BRACKET properties edgeLength RIGHT_BRACKET */
-#line 226 "grammar.y"
-{ 
-	yymsp[-3].minor.yy61 = New_AST_LinkEntity(NULL, NULL, yymsp[-2].minor.yy130, N_DIR_UNKNOWN, yymsp[-1].minor.yy138);
+      case 36: /* link ::= LEFT_ARROW edge DASH */
+#line 225 "grammar.y"
+{
+	yymsp[-2].minor.yy35 = yymsp[-1].minor.yy35;
+	yymsp[-2].minor.yy35->direction = N_RIGHT_TO_LEFT;
 }
-#line 1512 "grammar.c"
+#line 1534 "grammar.c"
         break;
-      case 37: /* edge ::= LEFT_BRACKET UQSTRING properties RIGHT_BRACKET */
-#line 231 "grammar.y"
+      case 37: /* edge ::= LEFT_BRACKET properties edgeLength RIGHT_BRACKET */
+#line 232 "grammar.y"
 { 
-	yymsp[-3].minor.yy61 = New_AST_LinkEntity(yymsp[-2].minor.yy0.strval, NULL, yymsp[-1].minor.yy130, N_DIR_UNKNOWN, NULL);
+	yymsp[-3].minor.yy35 = New_AST_LinkEntity(NULL, NULL, yymsp[-2].minor.yy116, N_DIR_UNKNOWN, yymsp[-1].minor.yy140);
 }
-#line 1519 "grammar.c"
+#line 1541 "grammar.c"
         break;
-      case 38: /* edge ::= LEFT_BRACKET COLON UQSTRING edgeLength properties RIGHT_BRACKET */
-#line 236 "grammar.y"
+      case 38: /* edge ::= LEFT_BRACKET UQSTRING properties RIGHT_BRACKET */
+#line 237 "grammar.y"
 { 
-	yymsp[-5].minor.yy61 = New_AST_LinkEntity(NULL, yymsp[-3].minor.yy0.strval, yymsp[-1].minor.yy130, N_DIR_UNKNOWN, yymsp[-2].minor.yy138);
+	yymsp[-3].minor.yy35 = New_AST_LinkEntity(yymsp[-2].minor.yy0.strval, NULL, yymsp[-1].minor.yy116, N_DIR_UNKNOWN, NULL);
 }
-#line 1526 "grammar.c"
+#line 1548 "grammar.c"
         break;
-      case 39: /* edge ::= LEFT_BRACKET UQSTRING COLON UQSTRING properties RIGHT_BRACKET */
-#line 241 "grammar.y"
+      case 39: /* edge ::= LEFT_BRACKET COLON UQSTRING edgeLength properties RIGHT_BRACKET */
+#line 242 "grammar.y"
 { 
-	yymsp[-5].minor.yy61 = New_AST_LinkEntity(yymsp[-4].minor.yy0.strval, yymsp[-2].minor.yy0.strval, yymsp[-1].minor.yy130, N_DIR_UNKNOWN, NULL);
+	yymsp[-5].minor.yy35 = New_AST_LinkEntity(NULL, yymsp[-3].minor.yy0.strval, yymsp[-1].minor.yy116, N_DIR_UNKNOWN, yymsp[-2].minor.yy140);
 }
-#line 1533 "grammar.c"
+#line 1555 "grammar.c"
         break;
-      case 40: /* edgeLength ::= */
-#line 248 "grammar.y"
-{
-	yymsp[1].minor.yy138 = NULL;
+      case 40: /* edge ::= LEFT_BRACKET UQSTRING COLON UQSTRING properties RIGHT_BRACKET */
+#line 247 "grammar.y"
+{ 
+	yymsp[-5].minor.yy35 = New_AST_LinkEntity(yymsp[-4].minor.yy0.strval, yymsp[-2].minor.yy0.strval, yymsp[-1].minor.yy116, N_DIR_UNKNOWN, NULL);
 }
-#line 1540 "grammar.c"
+#line 1562 "grammar.c"
         break;
-      case 41: /* edgeLength ::= MUL INTEGER DOTDOT INTEGER */
-#line 253 "grammar.y"
+      case 41: /* edgeLength ::= */
+#line 254 "grammar.y"
 {
-	yymsp[-3].minor.yy138 = New_AST_LinkLength(yymsp[-2].minor.yy0.intval, yymsp[0].minor.yy0.intval);
+	yymsp[1].minor.yy140 = NULL;
 }
-#line 1547 "grammar.c"
+#line 1569 "grammar.c"
         break;
-      case 42: /* edgeLength ::= MUL INTEGER DOTDOT */
-#line 258 "grammar.y"
+      case 42: /* edgeLength ::= MUL INTEGER DOTDOT INTEGER */
+#line 259 "grammar.y"
 {
-	yymsp[-2].minor.yy138 = New_AST_LinkLength(yymsp[-1].minor.yy0.intval, UINT_MAX-1);
+	yymsp[-3].minor.yy140 = New_AST_LinkLength(yymsp[-2].minor.yy0.intval, yymsp[0].minor.yy0.intval);
 }
-#line 1554 "grammar.c"
+#line 1576 "grammar.c"
         break;
-      case 43: /* edgeLength ::= MUL DOTDOT INTEGER */
-#line 263 "grammar.y"
+      case 43: /* edgeLength ::= MUL INTEGER DOTDOT */
+#line 264 "grammar.y"
 {
-	yymsp[-2].minor.yy138 = New_AST_LinkLength(1, yymsp[0].minor.yy0.intval);
+	yymsp[-2].minor.yy140 = New_AST_LinkLength(yymsp[-1].minor.yy0.intval, UINT_MAX-1);
 }
-#line 1561 "grammar.c"
+#line 1583 "grammar.c"
         break;
-      case 44: /* edgeLength ::= MUL INTEGER */
-#line 268 "grammar.y"
+      case 44: /* edgeLength ::= MUL DOTDOT INTEGER */
+#line 269 "grammar.y"
 {
-	yymsp[-1].minor.yy138 = New_AST_LinkLength(yymsp[0].minor.yy0.intval, yymsp[0].minor.yy0.intval);
+	yymsp[-2].minor.yy140 = New_AST_LinkLength(1, yymsp[0].minor.yy0.intval);
 }
-#line 1568 "grammar.c"
+#line 1590 "grammar.c"
         break;
-      case 45: /* edgeLength ::= MUL */
-#line 273 "grammar.y"
+      case 45: /* edgeLength ::= MUL INTEGER */
+#line 274 "grammar.y"
 {
-	yymsp[0].minor.yy138 = New_AST_LinkLength(1, UINT_MAX-1);
+	yymsp[-1].minor.yy140 = New_AST_LinkLength(yymsp[0].minor.yy0.intval, yymsp[0].minor.yy0.intval);
 }
-#line 1575 "grammar.c"
+#line 1597 "grammar.c"
         break;
-      case 46: /* properties ::= */
+      case 46: /* edgeLength ::= MUL */
 #line 279 "grammar.y"
 {
-	yymsp[1].minor.yy130 = NULL;
+	yymsp[0].minor.yy140 = New_AST_LinkLength(1, UINT_MAX-1);
 }
-#line 1582 "grammar.c"
+#line 1604 "grammar.c"
         break;
-      case 47: /* properties ::= LEFT_CURLY_BRACKET mapLiteral RIGHT_CURLY_BRACKET */
-#line 283 "grammar.y"
+      case 47: /* properties ::= */
+#line 285 "grammar.y"
 {
-	yymsp[-2].minor.yy130 = yymsp[-1].minor.yy130;
+	yymsp[1].minor.yy116 = NULL;
 }
-#line 1589 "grammar.c"
+#line 1611 "grammar.c"
         break;
-      case 48: /* mapLiteral ::= UQSTRING COLON value */
+      case 48: /* properties ::= LEFT_CURLY_BRACKET mapLiteral RIGHT_CURLY_BRACKET */
 #line 289 "grammar.y"
 {
-	yylhsminor.yy130 = NewVector(SIValue*, 2);
+	yymsp[-2].minor.yy116 = yymsp[-1].minor.yy116;
+}
+#line 1618 "grammar.c"
+        break;
+      case 49: /* mapLiteral ::= UQSTRING COLON value */
+#line 295 "grammar.y"
+{
+	yylhsminor.yy116 = NewVector(SIValue*, 2);
 
 	SIValue *key = malloc(sizeof(SIValue));
 	*key = SI_StringVal(yymsp[-2].minor.yy0.strval);
-	Vector_Push(yylhsminor.yy130, key);
+	Vector_Push(yylhsminor.yy116, key);
 
 	SIValue *val = malloc(sizeof(SIValue));
-	*val = yymsp[0].minor.yy22;
-	Vector_Push(yylhsminor.yy130, val);
+	*val = yymsp[0].minor.yy189;
+	Vector_Push(yylhsminor.yy116, val);
 }
-#line 1604 "grammar.c"
-  yymsp[-2].minor.yy130 = yylhsminor.yy130;
+#line 1633 "grammar.c"
+  yymsp[-2].minor.yy116 = yylhsminor.yy116;
         break;
-      case 49: /* mapLiteral ::= UQSTRING COLON value COMMA mapLiteral */
-#line 301 "grammar.y"
+      case 50: /* mapLiteral ::= UQSTRING COLON value COMMA mapLiteral */
+#line 307 "grammar.y"
 {
 	SIValue *key = malloc(sizeof(SIValue));
 	*key = SI_StringVal(yymsp[-4].minor.yy0.strval);
-	Vector_Push(yymsp[0].minor.yy130, key);
+	Vector_Push(yymsp[0].minor.yy116, key);
 
 	SIValue *val = malloc(sizeof(SIValue));
-	*val = yymsp[-2].minor.yy22;
-	Vector_Push(yymsp[0].minor.yy130, val);
+	*val = yymsp[-2].minor.yy189;
+	Vector_Push(yymsp[0].minor.yy116, val);
 	
-	yylhsminor.yy130 = yymsp[0].minor.yy130;
+	yylhsminor.yy116 = yymsp[0].minor.yy116;
 }
-#line 1620 "grammar.c"
-  yymsp[-4].minor.yy130 = yylhsminor.yy130;
+#line 1649 "grammar.c"
+  yymsp[-4].minor.yy116 = yylhsminor.yy116;
         break;
-      case 50: /* whereClause ::= */
-#line 315 "grammar.y"
+      case 51: /* whereClause ::= */
+#line 321 "grammar.y"
 { 
-	yymsp[1].minor.yy83 = NULL;
+	yymsp[1].minor.yy181 = NULL;
 }
-#line 1628 "grammar.c"
+#line 1657 "grammar.c"
         break;
-      case 51: /* whereClause ::= WHERE cond */
-#line 318 "grammar.y"
+      case 52: /* whereClause ::= WHERE cond */
+#line 324 "grammar.y"
 {
-	yymsp[-1].minor.yy83 = New_AST_WhereNode(yymsp[0].minor.yy82);
+	yymsp[-1].minor.yy181 = New_AST_WhereNode(yymsp[0].minor.yy86);
 }
-#line 1635 "grammar.c"
+#line 1664 "grammar.c"
         break;
-      case 52: /* cond ::= arithmetic_expression relation arithmetic_expression */
-#line 327 "grammar.y"
-{ yylhsminor.yy82 = New_AST_PredicateNode(yymsp[-2].minor.yy2, yymsp[-1].minor.yy108, yymsp[0].minor.yy2); }
-#line 1640 "grammar.c"
-  yymsp[-2].minor.yy82 = yylhsminor.yy82;
+      case 53: /* cond ::= arithmetic_expression relation arithmetic_expression */
+#line 333 "grammar.y"
+{ yylhsminor.yy86 = New_AST_PredicateNode(yymsp[-2].minor.yy154, yymsp[-1].minor.yy123, yymsp[0].minor.yy154); }
+#line 1669 "grammar.c"
+  yymsp[-2].minor.yy86 = yylhsminor.yy86;
         break;
-      case 53: /* cond ::= LEFT_PARENTHESIS cond RIGHT_PARENTHESIS */
-#line 329 "grammar.y"
-{ yymsp[-2].minor.yy82 = yymsp[-1].minor.yy82; }
-#line 1646 "grammar.c"
+      case 54: /* cond ::= LEFT_PARENTHESIS cond RIGHT_PARENTHESIS */
+#line 335 "grammar.y"
+{ yymsp[-2].minor.yy86 = yymsp[-1].minor.yy86; }
+#line 1675 "grammar.c"
         break;
-      case 54: /* cond ::= cond AND cond */
-#line 330 "grammar.y"
-{ yylhsminor.yy82 = New_AST_ConditionNode(yymsp[-2].minor.yy82, AND, yymsp[0].minor.yy82); }
-#line 1651 "grammar.c"
-  yymsp[-2].minor.yy82 = yylhsminor.yy82;
+      case 55: /* cond ::= cond AND cond */
+#line 336 "grammar.y"
+{ yylhsminor.yy86 = New_AST_ConditionNode(yymsp[-2].minor.yy86, AND, yymsp[0].minor.yy86); }
+#line 1680 "grammar.c"
+  yymsp[-2].minor.yy86 = yylhsminor.yy86;
         break;
-      case 55: /* cond ::= cond OR cond */
-#line 331 "grammar.y"
-{ yylhsminor.yy82 = New_AST_ConditionNode(yymsp[-2].minor.yy82, OR, yymsp[0].minor.yy82); }
-#line 1657 "grammar.c"
-  yymsp[-2].minor.yy82 = yylhsminor.yy82;
+      case 56: /* cond ::= cond OR cond */
+#line 337 "grammar.y"
+{ yylhsminor.yy86 = New_AST_ConditionNode(yymsp[-2].minor.yy86, OR, yymsp[0].minor.yy86); }
+#line 1686 "grammar.c"
+  yymsp[-2].minor.yy86 = yylhsminor.yy86;
         break;
-      case 56: /* returnClause ::= RETURN returnElements */
-#line 335 "grammar.y"
+      case 57: /* returnClause ::= RETURN returnElements */
+#line 341 "grammar.y"
 {
-	yymsp[-1].minor.yy48 = New_AST_ReturnNode(yymsp[0].minor.yy130, 0);
+	yymsp[-1].minor.yy188 = New_AST_ReturnNode(yymsp[0].minor.yy116, 0);
 }
-#line 1665 "grammar.c"
+#line 1694 "grammar.c"
         break;
-      case 57: /* returnClause ::= RETURN DISTINCT returnElements */
-#line 338 "grammar.y"
+      case 58: /* returnClause ::= RETURN DISTINCT returnElements */
+#line 344 "grammar.y"
 {
-	yymsp[-2].minor.yy48 = New_AST_ReturnNode(yymsp[0].minor.yy130, 1);
+	yymsp[-2].minor.yy188 = New_AST_ReturnNode(yymsp[0].minor.yy116, 1);
 }
-#line 1672 "grammar.c"
+#line 1701 "grammar.c"
         break;
-      case 58: /* returnElements ::= returnElements COMMA returnElement */
-#line 345 "grammar.y"
+      case 59: /* returnElements ::= returnElements COMMA returnElement */
+#line 351 "grammar.y"
 {
-	Vector_Push(yymsp[-2].minor.yy130, yymsp[0].minor.yy170);
-	yylhsminor.yy130 = yymsp[-2].minor.yy130;
+	Vector_Push(yymsp[-2].minor.yy116, yymsp[0].minor.yy34);
+	yylhsminor.yy116 = yymsp[-2].minor.yy116;
 }
-#line 1680 "grammar.c"
-  yymsp[-2].minor.yy130 = yylhsminor.yy130;
+#line 1709 "grammar.c"
+  yymsp[-2].minor.yy116 = yylhsminor.yy116;
         break;
-      case 59: /* returnElements ::= returnElement */
-#line 350 "grammar.y"
+      case 60: /* returnElements ::= returnElement */
+#line 356 "grammar.y"
 {
-	yylhsminor.yy130 = NewVector(AST_ReturnElementNode*, 1);
-	Vector_Push(yylhsminor.yy130, yymsp[0].minor.yy170);
+	yylhsminor.yy116 = NewVector(AST_ReturnElementNode*, 1);
+	Vector_Push(yylhsminor.yy116, yymsp[0].minor.yy34);
 }
-#line 1689 "grammar.c"
-  yymsp[0].minor.yy130 = yylhsminor.yy130;
+#line 1718 "grammar.c"
+  yymsp[0].minor.yy116 = yylhsminor.yy116;
         break;
-      case 60: /* returnElement ::= arithmetic_expression */
-#line 357 "grammar.y"
+      case 61: /* returnElement ::= arithmetic_expression */
+#line 363 "grammar.y"
 {
-	yylhsminor.yy170 = New_AST_ReturnElementNode(yymsp[0].minor.yy2, NULL);
+	yylhsminor.yy34 = New_AST_ReturnElementNode(yymsp[0].minor.yy154, NULL);
 }
-#line 1697 "grammar.c"
-  yymsp[0].minor.yy170 = yylhsminor.yy170;
+#line 1726 "grammar.c"
+  yymsp[0].minor.yy34 = yylhsminor.yy34;
         break;
-      case 61: /* returnElement ::= arithmetic_expression AS UQSTRING */
-#line 362 "grammar.y"
+      case 62: /* returnElement ::= arithmetic_expression AS UQSTRING */
+#line 368 "grammar.y"
 {
-	yylhsminor.yy170 = New_AST_ReturnElementNode(yymsp[-2].minor.yy2, yymsp[0].minor.yy0.strval);
+	yylhsminor.yy34 = New_AST_ReturnElementNode(yymsp[-2].minor.yy154, yymsp[0].minor.yy0.strval);
 }
-#line 1705 "grammar.c"
-  yymsp[-2].minor.yy170 = yylhsminor.yy170;
+#line 1734 "grammar.c"
+  yymsp[-2].minor.yy34 = yylhsminor.yy34;
         break;
-      case 62: /* arithmetic_expression ::= LEFT_PARENTHESIS arithmetic_expression RIGHT_PARENTHESIS */
-#line 369 "grammar.y"
+      case 63: /* arithmetic_expression ::= LEFT_PARENTHESIS arithmetic_expression RIGHT_PARENTHESIS */
+#line 375 "grammar.y"
 {
-	yymsp[-2].minor.yy2 = yymsp[-1].minor.yy2;
+	yymsp[-2].minor.yy154 = yymsp[-1].minor.yy154;
 }
-#line 1713 "grammar.c"
+#line 1742 "grammar.c"
         break;
-      case 63: /* arithmetic_expression ::= arithmetic_expression ADD arithmetic_expression */
-#line 381 "grammar.y"
+      case 64: /* arithmetic_expression ::= arithmetic_expression ADD arithmetic_expression */
+#line 387 "grammar.y"
 {
 	Vector *args = NewVector(AST_ArithmeticExpressionNode*, 2);
-	Vector_Push(args, yymsp[-2].minor.yy2);
-	Vector_Push(args, yymsp[0].minor.yy2);
-	yylhsminor.yy2 = New_AST_AR_EXP_OpNode("ADD", args);
+	Vector_Push(args, yymsp[-2].minor.yy154);
+	Vector_Push(args, yymsp[0].minor.yy154);
+	yylhsminor.yy154 = New_AST_AR_EXP_OpNode("ADD", args);
 }
-#line 1723 "grammar.c"
-  yymsp[-2].minor.yy2 = yylhsminor.yy2;
+#line 1752 "grammar.c"
+  yymsp[-2].minor.yy154 = yylhsminor.yy154;
         break;
-      case 64: /* arithmetic_expression ::= arithmetic_expression DASH arithmetic_expression */
-#line 388 "grammar.y"
+      case 65: /* arithmetic_expression ::= arithmetic_expression DASH arithmetic_expression */
+#line 394 "grammar.y"
 {
 	Vector *args = NewVector(AST_ArithmeticExpressionNode*, 2);
-	Vector_Push(args, yymsp[-2].minor.yy2);
-	Vector_Push(args, yymsp[0].minor.yy2);
-	yylhsminor.yy2 = New_AST_AR_EXP_OpNode("SUB", args);
+	Vector_Push(args, yymsp[-2].minor.yy154);
+	Vector_Push(args, yymsp[0].minor.yy154);
+	yylhsminor.yy154 = New_AST_AR_EXP_OpNode("SUB", args);
 }
-#line 1734 "grammar.c"
-  yymsp[-2].minor.yy2 = yylhsminor.yy2;
+#line 1763 "grammar.c"
+  yymsp[-2].minor.yy154 = yylhsminor.yy154;
         break;
-      case 65: /* arithmetic_expression ::= arithmetic_expression MUL arithmetic_expression */
-#line 395 "grammar.y"
+      case 66: /* arithmetic_expression ::= arithmetic_expression MUL arithmetic_expression */
+#line 401 "grammar.y"
 {
 	Vector *args = NewVector(AST_ArithmeticExpressionNode*, 2);
-	Vector_Push(args, yymsp[-2].minor.yy2);
-	Vector_Push(args, yymsp[0].minor.yy2);
-	yylhsminor.yy2 = New_AST_AR_EXP_OpNode("MUL", args);
+	Vector_Push(args, yymsp[-2].minor.yy154);
+	Vector_Push(args, yymsp[0].minor.yy154);
+	yylhsminor.yy154 = New_AST_AR_EXP_OpNode("MUL", args);
 }
-#line 1745 "grammar.c"
-  yymsp[-2].minor.yy2 = yylhsminor.yy2;
+#line 1774 "grammar.c"
+  yymsp[-2].minor.yy154 = yylhsminor.yy154;
         break;
-      case 66: /* arithmetic_expression ::= arithmetic_expression DIV arithmetic_expression */
-#line 402 "grammar.y"
+      case 67: /* arithmetic_expression ::= arithmetic_expression DIV arithmetic_expression */
+#line 408 "grammar.y"
 {
 	Vector *args = NewVector(AST_ArithmeticExpressionNode*, 2);
-	Vector_Push(args, yymsp[-2].minor.yy2);
-	Vector_Push(args, yymsp[0].minor.yy2);
-	yylhsminor.yy2 = New_AST_AR_EXP_OpNode("DIV", args);
-}
-#line 1756 "grammar.c"
-  yymsp[-2].minor.yy2 = yylhsminor.yy2;
-        break;
-      case 67: /* arithmetic_expression ::= UQSTRING LEFT_PARENTHESIS arithmetic_expression_list RIGHT_PARENTHESIS */
-#line 410 "grammar.y"
-{
-	yylhsminor.yy2 = New_AST_AR_EXP_OpNode(yymsp[-3].minor.yy0.strval, yymsp[-1].minor.yy130);
+	Vector_Push(args, yymsp[-2].minor.yy154);
+	Vector_Push(args, yymsp[0].minor.yy154);
+	yylhsminor.yy154 = New_AST_AR_EXP_OpNode("DIV", args);
 }
-#line 1764 "grammar.c"
-  yymsp[-3].minor.yy2 = yylhsminor.yy2;
+#line 1785 "grammar.c"
+  yymsp[-2].minor.yy154 = yylhsminor.yy154;
         break;
-      case 68: /* arithmetic_expression ::= value */
-#line 415 "grammar.y"
+      case 68: /* arithmetic_expression ::= UQSTRING LEFT_PARENTHESIS arithmetic_expression_list RIGHT_PARENTHESIS */
+#line 416 "grammar.y"
 {
-	yylhsminor.yy2 = New_AST_AR_EXP_ConstOperandNode(yymsp[0].minor.yy22);
+	yylhsminor.yy154 = New_AST_AR_EXP_OpNode(yymsp[-3].minor.yy0.strval, yymsp[-1].minor.yy116);
 }
-#line 1772 "grammar.c"
-  yymsp[0].minor.yy2 = yylhsminor.yy2;
+#line 1793 "grammar.c"
+  yymsp[-3].minor.yy154 = yylhsminor.yy154;
         break;
-      case 69: /* arithmetic_expression ::= variable */
-#line 420 "grammar.y"
+      case 69: /* arithmetic_expression ::= value */
+#line 421 "grammar.y"
 {
-	yylhsminor.yy2 = New_AST_AR_EXP_VariableOperandNode(yymsp[0].minor.yy116->alias, yymsp[0].minor.yy116->property);
-	free(yymsp[0].minor.yy116);
+	yylhsminor.yy154 = New_AST_AR_EXP_ConstOperandNode(yymsp[0].minor.yy189);
 }
-#line 1781 "grammar.c"
-  yymsp[0].minor.yy2 = yylhsminor.yy2;
+#line 1801 "grammar.c"
+  yymsp[0].minor.yy154 = yylhsminor.yy154;
         break;
-      case 70: /* arithmetic_expression_list ::= arithmetic_expression_list COMMA arithmetic_expression */
-#line 427 "grammar.y"
+      case 70: /* arithmetic_expression ::= variable */
+#line 426 "grammar.y"
 {
-	Vector_Push(yymsp[-2].minor.yy130, yymsp[0].minor.yy2);
-	yylhsminor.yy130 = yymsp[-2].minor.yy130;
+	yylhsminor.yy154 = New_AST_AR_EXP_VariableOperandNode(yymsp[0].minor.yy120->alias, yymsp[0].minor.yy120->property);
+	free(yymsp[0].minor.yy120);
 }
-#line 1790 "grammar.c"
-  yymsp[-2].minor.yy130 = yylhsminor.yy130;
+#line 1810 "grammar.c"
+  yymsp[0].minor.yy154 = yylhsminor.yy154;
         break;
-      case 71: /* arithmetic_expression_list ::= arithmetic_expression */
-#line 431 "grammar.y"
+      case 71: /* arithmetic_expression_list ::= arithmetic_expression_list COMMA arithmetic_expression */
+#line 433 "grammar.y"
 {
-	yylhsminor.yy130 = NewVector(AST_ArithmeticExpressionNode*, 1);
-	Vector_Push(yylhsminor.yy130, yymsp[0].minor.yy2);
+	Vector_Push(yymsp[-2].minor.yy116, yymsp[0].minor.yy154);
+	yylhsminor.yy116 = yymsp[-2].minor.yy116;
 }
-#line 1799 "grammar.c"
-  yymsp[0].minor.yy130 = yylhsminor.yy130;
+#line 1819 "grammar.c"
+  yymsp[-2].minor.yy116 = yylhsminor.yy116;
         break;
-      case 72: /* variable ::= UQSTRING */
-#line 438 "grammar.y"
+      case 72: /* arithmetic_expression_list ::= arithmetic_expression */
+#line 437 "grammar.y"
 {
-	yylhsminor.yy116 = New_AST_Variable(yymsp[0].minor.yy0.strval, NULL);
+	yylhsminor.yy116 = NewVector(AST_ArithmeticExpressionNode*, 1);
+	Vector_Push(yylhsminor.yy116, yymsp[0].minor.yy154);
 }
-#line 1807 "grammar.c"
+#line 1828 "grammar.c"
   yymsp[0].minor.yy116 = yylhsminor.yy116;
         break;
-      case 73: /* variable ::= UQSTRING DOT UQSTRING */
-#line 442 "grammar.y"
+      case 73: /* variable ::= UQSTRING */
+#line 444 "grammar.y"
 {
-	yylhsminor.yy116 = New_AST_Variable(yymsp[-2].minor.yy0.strval, yymsp[0].minor.yy0.strval);
+	yylhsminor.yy120 = New_AST_Variable(yymsp[0].minor.yy0.strval, NULL);
 }
-#line 1815 "grammar.c"
-  yymsp[-2].minor.yy116 = yylhsminor.yy116;
+#line 1836 "grammar.c"
+  yymsp[0].minor.yy120 = yylhsminor.yy120;
         break;
-      case 74: /* orderClause ::= */
+      case 74: /* variable ::= UQSTRING DOT UQSTRING */
 #line 448 "grammar.y"
 {
-	yymsp[1].minor.yy52 = NULL;
+	yylhsminor.yy120 = New_AST_Variable(yymsp[-2].minor.yy0.strval, yymsp[0].minor.yy0.strval);
 }
-#line 1823 "grammar.c"
+#line 1844 "grammar.c"
+  yymsp[-2].minor.yy120 = yylhsminor.yy120;
         break;
-      case 75: /* orderClause ::= ORDER BY columnNameList */
-#line 451 "grammar.y"
+      case 75: /* orderClause ::= */
+#line 454 "grammar.y"
 {
-	yymsp[-2].minor.yy52 = New_AST_OrderNode(yymsp[0].minor.yy130, ORDER_DIR_ASC);
+	yymsp[1].minor.yy28 = NULL;
 }
-#line 1830 "grammar.c"
+#line 1852 "grammar.c"
         break;
-      case 76: /* orderClause ::= ORDER BY columnNameList ASC */
-#line 454 "grammar.y"
+      case 76: /* orderClause ::= ORDER BY columnNameList */
+#line 457 "grammar.y"
 {
-	yymsp[-3].minor.yy52 = New_AST_OrderNode(yymsp[-1].minor.yy130, ORDER_DIR_ASC);
+	yymsp[-2].minor.yy28 = New_AST_OrderNode(yymsp[0].minor.yy116, ORDER_DIR_ASC);
 }
-#line 1837 "grammar.c"
+#line 1859 "grammar.c"
         break;
-      case 77: /* orderClause ::= ORDER BY columnNameList DESC */
-#line 457 "grammar.y"
+      case 77: /* orderClause ::= ORDER BY columnNameList ASC */
+#line 460 "grammar.y"
 {
-	yymsp[-3].minor.yy52 = New_AST_OrderNode(yymsp[-1].minor.yy130, ORDER_DIR_DESC);
+	yymsp[-3].minor.yy28 = New_AST_OrderNode(yymsp[-1].minor.yy116, ORDER_DIR_ASC);
 }
-#line 1844 "grammar.c"
+#line 1866 "grammar.c"
         break;
-      case 78: /* columnNameList ::= columnNameList COMMA columnName */
-#line 462 "grammar.y"
+      case 78: /* orderClause ::= ORDER BY columnNameList DESC */
+#line 463 "grammar.y"
 {
-	Vector_Push(yymsp[-2].minor.yy130, yymsp[0].minor.yy54);
-	yylhsminor.yy130 = yymsp[-2].minor.yy130;
+	yymsp[-3].minor.yy28 = New_AST_OrderNode(yymsp[-1].minor.yy116, ORDER_DIR_DESC);
 }
-#line 1852 "grammar.c"
-  yymsp[-2].minor.yy130 = yylhsminor.yy130;
+#line 1873 "grammar.c"
         break;
-      case 79: /* columnNameList ::= columnName */
-#line 466 "grammar.y"
+      case 79: /* columnNameList ::= columnNameList COMMA columnName */
+#line 468 "grammar.y"
 {
-	yylhsminor.yy130 = NewVector(AST_ColumnNode*, 1);
-	Vector_Push(yylhsminor.yy130, yymsp[0].minor.yy54);
+	Vector_Push(yymsp[-2].minor.yy116, yymsp[0].minor.yy90);
+	yylhsminor.yy116 = yymsp[-2].minor.yy116;
 }
-#line 1861 "grammar.c"
-  yymsp[0].minor.yy130 = yylhsminor.yy130;
+#line 1881 "grammar.c"
+  yymsp[-2].minor.yy116 = yylhsminor.yy116;
         break;
-      case 80: /* columnName ::= variable */
+      case 80: /* columnNameList ::= columnName */
 #line 472 "grammar.y"
 {
-	if(yymsp[0].minor.yy116->property != NULL) {
-		yylhsminor.yy54 = AST_ColumnNodeFromVariable(yymsp[0].minor.yy116);
+	yylhsminor.yy116 = NewVector(AST_ColumnNode*, 1);
+	Vector_Push(yylhsminor.yy116, yymsp[0].minor.yy90);
+}
+#line 1890 "grammar.c"
+  yymsp[0].minor.yy116 = yylhsminor.yy116;
+        break;
+      case 81: /* columnName ::= variable */
+#line 478 "grammar.y"
+{
+	if(yymsp[0].minor.yy120->property != NULL) {
+		yylhsminor.yy90 = AST_ColumnNodeFromVariable(yymsp[0].minor.yy120);
 	} else {
-		yylhsminor.yy54 = AST_ColumnNodeFromAlias(yymsp[0].minor.yy116->alias);
+		yylhsminor.yy90 = AST_ColumnNodeFromAlias(yymsp[0].minor.yy120->alias);
 	}
 
-	Free_AST_Variable(yymsp[0].minor.yy116);
+	Free_AST_Variable(yymsp[0].minor.yy120);
 }
-#line 1875 "grammar.c"
-  yymsp[0].minor.yy54 = yylhsminor.yy54;
+#line 1904 "grammar.c"
+  yymsp[0].minor.yy90 = yylhsminor.yy90;
         break;
-      case 81: /* skipClause ::= */
-#line 484 "grammar.y"
+      case 82: /* skipClause ::= */
+#line 490 "grammar.y"
 {
-	yymsp[1].minor.yy115 = NULL;
+	yymsp[1].minor.yy173 = NULL;
 }
-#line 1883 "grammar.c"
+#line 1912 "grammar.c"
         break;
-      case 82: /* skipClause ::= SKIP INTEGER */
-#line 487 "grammar.y"
+      case 83: /* skipClause ::= SKIP INTEGER */
+#line 493 "grammar.y"
 {
-	yymsp[-1].minor.yy115 = New_AST_SkipNode(yymsp[0].minor.yy0.intval);
+	yymsp[-1].minor.yy173 = New_AST_SkipNode(yymsp[0].minor.yy0.intval);
 }
-#line 1890 "grammar.c"
+#line 1919 "grammar.c"
         break;
-      case 83: /* limitClause ::= */
-#line 493 "grammar.y"
+      case 84: /* limitClause ::= */
+#line 499 "grammar.y"
 {
-	yymsp[1].minor.yy127 = NULL;
+	yymsp[1].minor.yy77 = NULL;
 }
-#line 1897 "grammar.c"
+#line 1926 "grammar.c"
         break;
-      case 84: /* limitClause ::= LIMIT INTEGER */
-#line 496 "grammar.y"
+      case 85: /* limitClause ::= LIMIT INTEGER */
+#line 502 "grammar.y"
 {
-	yymsp[-1].minor.yy127 = New_AST_LimitNode(yymsp[0].minor.yy0.intval);
+	yymsp[-1].minor.yy77 = New_AST_LimitNode(yymsp[0].minor.yy0.intval);
 }
-#line 1904 "grammar.c"
+#line 1933 "grammar.c"
         break;
-      case 85: /* relation ::= EQ */
-#line 502 "grammar.y"
-{ yymsp[0].minor.yy108 = EQ; }
-#line 1909 "grammar.c"
+      case 86: /* relation ::= EQ */
+#line 508 "grammar.y"
+{ yymsp[0].minor.yy123 = EQ; }
+#line 1938 "grammar.c"
         break;
-      case 86: /* relation ::= GT */
-#line 503 "grammar.y"
-{ yymsp[0].minor.yy108 = GT; }
-#line 1914 "grammar.c"
+      case 87: /* relation ::= GT */
+#line 509 "grammar.y"
+{ yymsp[0].minor.yy123 = GT; }
+#line 1943 "grammar.c"
         break;
-      case 87: /* relation ::= LT */
-#line 504 "grammar.y"
-{ yymsp[0].minor.yy108 = LT; }
-#line 1919 "grammar.c"
+      case 88: /* relation ::= LT */
+#line 510 "grammar.y"
+{ yymsp[0].minor.yy123 = LT; }
+#line 1948 "grammar.c"
+        break;
+      case 89: /* relation ::= LE */
+#line 511 "grammar.y"
+{ yymsp[0].minor.yy123 = LE; }
+#line 1953 "grammar.c"
         break;
-      case 88: /* relation ::= LE */
-#line 505 "grammar.y"
-{ yymsp[0].minor.yy108 = LE; }
-#line 1924 "grammar.c"
-        break;
-      case 89: /* relation ::= GE */
-#line 506 "grammar.y"
-{ yymsp[0].minor.yy108 = GE; }
-#line 1929 "grammar.c"
-        break;
-      case 90: /* relation ::= NE */
-#line 507 "grammar.y"
-{ yymsp[0].minor.yy108 = NE; }
-#line 1934 "grammar.c"
-        break;
-      case 91: /* value ::= INTEGER */
-#line 518 "grammar.y"
-{  yylhsminor.yy22 = SI_DoubleVal(yymsp[0].minor.yy0.intval); }
-#line 1939 "grammar.c"
-  yymsp[0].minor.yy22 = yylhsminor.yy22;
-        break;
-      case 92: /* value ::= DASH INTEGER */
-#line 519 "grammar.y"
-{  yymsp[-1].minor.yy22 = SI_DoubleVal(-yymsp[0].minor.yy0.intval); }
-#line 1945 "grammar.c"
-        break;
-      case 93: /* value ::= STRING */
-#line 520 "grammar.y"
-{  yylhsminor.yy22 = SI_StringVal(yymsp[0].minor.yy0.strval); }
-#line 1950 "grammar.c"
-  yymsp[0].minor.yy22 = yylhsminor.yy22;
-        break;
-      case 94: /* value ::= FLOAT */
-#line 521 "grammar.y"
-{  yylhsminor.yy22 = SI_DoubleVal(yymsp[0].minor.yy0.dval); }
-#line 1956 "grammar.c"
-  yymsp[0].minor.yy22 = yylhsminor.yy22;
-        break;
-      case 95: /* value ::= DASH FLOAT */
-#line 522 "grammar.y"
-{  yymsp[-1].minor.yy22 = SI_DoubleVal(-yymsp[0].minor.yy0.dval); }
-#line 1962 "grammar.c"
-        break;
-      case 96: /* value ::= TRUE */
-#line 523 "grammar.y"
-{ yymsp[0].minor.yy22 = SI_BoolVal(1); }
-#line 1967 "grammar.c"
-        break;
-      case 97: /* value ::= FALSE */
-#line 524 "grammar.y"
-{ yymsp[0].minor.yy22 = SI_BoolVal(0); }
-#line 1972 "grammar.c"
-        break;
-      case 98: /* value ::= NULLVAL */
-#line 525 "grammar.y"
-{ yymsp[0].minor.yy22 = SI_NullVal(); }
-#line 1977 "grammar.c"
+      case 90: /* relation ::= GE */
+#line 512 "grammar.y"
+{ yymsp[0].minor.yy123 = GE; }
+#line 1958 "grammar.c"
+        break;
+      case 91: /* relation ::= NE */
+#line 513 "grammar.y"
+{ yymsp[0].minor.yy123 = NE; }
+#line 1963 "grammar.c"
+        break;
+      case 92: /* relation ::= STARTS WITH */
+#line 514 "grammar.y"
+{ yymsp[-1].minor.yy123 = STARTS; }
+#line 1968 "grammar.c"
+        break;
+      case 93: /* relation ::= ENDS WITH */
+#line 515 "grammar.y"
+{ yymsp[-1].minor.yy123 = ENDS; }
+#line 1973 "grammar.c"
+        break;
+      case 94: /* relation ::= CONTAINS */
+#line 516 "grammar.y"
+{ yymsp[0].minor.yy123 = CONTAINS; }
+#line 1978 "grammar.c"
+        break;
+      case 95: /* value ::= INTEGER */
+#line 527 "grammar.y"
+{  yylhsminor.yy189 = SI_DoubleVal(yymsp[0].minor.yy0.intval); }
+#line 1983 "grammar.c"
+  yymsp[0].minor.yy189 = yylhsminor.yy189;
+        break;
+      case 96: /* value ::= DASH INTEGER */
+#line 528 "grammar.y"
+{  yymsp[-1].minor.yy189 = SI_DoubleVal(-yymsp[0].minor.yy0.intval); }
+#line 1989 "grammar.c"
+        break;
+      case 97: /* value ::= STRING */
+#line 529 "grammar.y"
+{  yylhsminor.yy189 = SI_StringVal(yymsp[0].minor.yy0.strval); }
+#line 1994 "grammar.c"
+  yymsp[0].minor.yy189 = yylhsminor.yy189;
+        break;
+      case 98: /* value ::= FLOAT */
+#line 530 "grammar.y"
+{  yylhsminor.yy189 = SI_DoubleVal(yymsp[0].minor.yy0.dval); }
+#line 2000 "grammar.c"
+  yymsp[0].minor.yy189 = yylhsminor.yy189;
+        break;
+      case 99: /* value ::= DASH FLOAT */
+#line 531 "grammar.y"
+{  yymsp[-1].minor.yy189 = SI_DoubleVal(-yymsp[0].minor.yy0.dval); }
+#line 2006 "grammar.c"
+        break;
+      case 100: /* value ::= TRUE */
+#line 532 "grammar.y"
+{ yymsp[0].minor.yy189 = SI_BoolVal(1); }
+#line 2011 "grammar.c"
+        break;
+      case 101: /* value ::= FALSE */
+#line 533 "grammar.y"
+{ yymsp[0].minor.yy189 = SI_BoolVal(0); }
+#line 2016 "grammar.c"
+        break;
+      case 102: /* value ::= NULLVAL */
+#line 534 "grammar.y"
+{ yymsp[0].minor.yy189 = SI_NullVal(); }
+#line 2021 "grammar.c"
+        break;
+      case 103: /* value ::= PARAMETER */
+#line 537 "grammar.y"
+{
+	yylhsminor.yy189 = SI_StringVal(yymsp[0].minor.yy0.strval);
+	free(yymsp[0].minor.yy0.strval);
+	Vector_Push(ctx->parameters, yylhsminor.yy189.stringval);
+}
+#line 2030 "grammar.c"
+  yymsp[0].minor.yy189 = yylhsminor.yy189;
         break;
       default:
         break;
@@ -2031,14 +2085,14 @@ static void yy_syntax_error(
   ParseARG_FETCH;
 #define TOKEN yyminor
 /************ Begin %syntax_error code ****************************************/
-#line 31 "grammar.y"
+#line 32 "grammar.y"
 
 	char buf[256];
 	snprintf(buf, 256, "Syntax error at offset %d near '%s'", TOKEN.pos, TOKEN.s);
 
 	ctx->ok = 0;
 	ctx->errorMsg = strdup(buf);
-#line 2042 "grammar.c"
+#line 2096 "grammar.c"
 /************ End %syntax_error code ******************************************/
   ParseARG_STORE; /* Suppress warning about unused %extra_argument variable */
 }
@@ -2252,38 +2306,78 @@ void Parse(
 #endif
   return;
 }
-#line 527 "grammar.y"
+#line 543 "grammar.y"
 
 
 	/* Definitions of flex stuff */
 	typedef struct yy_buffer_state *YY_BUFFER_STATE;
-	int             yylex( void );
-	extern int             yylex_destroy (void);
-	YY_BUFFER_STATE yy_scan_string( const char * );
-  	YY_BUFFER_STATE yy_scan_bytes( const char *, size_t );
-  	extern int yylineno;
-  	extern char *yytext;
-	extern int yycolumn;
+	typedef void* yyscan_t;
+	int yylex(yyscan_t yyscanner);
+	int yylex_init_extra(Token *user_defined, yyscan_t *scanner);
+	int yylex_destroy(yyscan_t yyscanner);
+	void yyset_column(int column_no, yyscan_t yyscanner);
+	YY_BUFFER_STATE yy_scan_bytes(const char *bytes, size_t len, yyscan_t yyscanner);
 
+	/* Both lexer and parser state are local to each call, queries can be parsed concurrently. */
 	AST_Query *Query_Parse(const char *q, size_t len, char **err) {
-		yycolumn = 1;	// Reset lexer's token tracking position
-		yy_scan_bytes(q, len);
+		Token tok;
+		yyscan_t scanner;
+		yylex_init_extra(&tok, &scanner);
+		yy_scan_bytes(q, len, scanner);
+		yyset_column(1, scanner);	// Reset lexer's token tracking position
   		void* pParser = ParseAlloc(malloc);
-  		int t = 0;
+		int t = 0;
 
-		parseCtx ctx = {.root = NULL, .ok = 1, .errorMsg = NULL};
+		parseCtx ctx = {.root = NULL, .ok = 1, .errorMsg = NULL, .parameters = NewVector(char*, 0)};
 
-		while( (t = yylex()) != 0) {
+		while( (t = yylex(scanner)) != 0) {
 			Parse(pParser, t, tok, &ctx);
 		}
 		if (ctx.ok) {
 			Parse(pParser, 0, tok, &ctx);
   		}
 		ParseFree(pParser, free);
+		if (ctx.root) {
+			ctx.root->parameters = ctx.parameters;
+		} else {
+			Vector_Free(ctx.parameters);
+		}
 		if (err) {
 			*err = ctx.errorMsg;
 		}
-		yylex_destroy();
+		yylex_destroy(scanner);
 		return ctx.root;
 	}
-#line 2290 "grammar.c"
+
+	/* Tokenizes query without parsing it, looking for clauses which modify the graph. */
+	bool Query_ReadOnly(const char *q, size_t len) {
+		Token tok;
+		yyscan_t scanner;
+		yylex_init_extra(&tok, &scanner);
+		yy_scan_bytes(q, len, scanner);
+		yyset_column(1, scanner);
+
+		int t = 0;
+		bool readonly = true;
+		while(readonly && (t = yylex(scanner)) != 0) {
+			switch(t) {
+				case CREATE:
+				case MERGE:
+				case DELETE:
+				case SET:
+				case DROP:
+					readonly = false;
+					break;
+				case UQSTRING:
+				case STRING:
+				case PARAMETER:
+					free(tok.strval);
+					break;
+				default:
+					break;
+			}
+		}
+		yylex_destroy(scanner);
+		return readonly;
+	}
+#line 2384 "grammar.c"
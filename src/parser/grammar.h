@@ -9,41 +9,48 @@
 #define GE                               9
 #define LT                              10
 #define LE                              11
-#define MATCH                           12
-#define CREATE                          13
-#define INDEX                           14
-#define ON                              15
-#define DROP                            16
-#define COLON                           17
-#define UQSTRING                        18
-#define LEFT_PARENTHESIS                19
-#define RIGHT_PARENTHESIS               20
-#define MERGE                           21
-#define SET                             22
-#define COMMA                           23
-#define DELETE                          24
-#define RIGHT_ARROW                     25
-#define LEFT_ARROW                      26
-#define LEFT_BRACKET                    27
-#define RIGHT_BRACKET                   28
-#define INTEGER                         29
-#define DOTDOT                          30
-#define LEFT_CURLY_BRACKET              31
-#define RIGHT_CURLY_BRACKET             32
-#define WHERE                           33
-#define RETURN                          34
-#define DISTINCT                        35
-#define AS                              36
-#define DOT                             37
-#define ORDER                           38
-#define BY                              39
-#define ASC                             40
-#define DESC                            41
-#define SKIP                            42
-#define LIMIT                           43
-#define NE                              44
-#define STRING                          45
-#define FLOAT                           46
-#define TRUE                            47
-#define FALSE                           48
-#define NULLVAL                         49
+#define UNKNOWN                         12
+#define MATCH                           13
+#define CREATE                          14
+#define INDEX                           15
+#define ON                              16
+#define DROP                            17
+#define TRIGRAM                         18
+#define COLON                           19
+#define UQSTRING                        20
+#define LEFT_PARENTHESIS                21
+#define RIGHT_PARENTHESIS               22
+#define MERGE                           23
+#define SET                             24
+#define COMMA                           25
+#define DELETE                          26
+#define RIGHT_ARROW                     27
+#define LEFT_ARROW                      28
+#define LEFT_BRACKET                    29
+#define RIGHT_BRACKET                   30
+#define INTEGER                         31
+#define DOTDOT                          32
+#define LEFT_CURLY_BRACKET              33
+#define RIGHT_CURLY_BRACKET             34
+#define WHERE                           35
+#define RETURN                          36
+#define DISTINCT                        37
+#define AS                              38
+#define DOT                             39
+#define ORDER                           40
+#define BY                              41
+#define ASC                             42
+#define DESC                            43
+#define SKIP                            44
+#define LIMIT                           45
+#define NE                              46
+#define STARTS                          47
+#define WITH                            48
+#define ENDS                            49
+#define CONTAINS                        50
+#define STRING                          51
+#define FLOAT                           52
+#define TRUE                            53
+#define FALSE                           54
+#define NULLVAL                         55
+#define PARAMETER                       56
@@ -4,6 +4,9 @@
 %left MUL DIV.
 %nonassoc EQ GT GE LT LE.
 
+/* Returned by the lexer for characters no other rule matches, never accepted by the grammar. */
+%token UNKNOWN.
+
 %token_type {Token}
 
 %include {
@@ -18,8 +21,6 @@
 	#include "parse.h"
 	#include "../value.h"
 
-	void yyerror(char *s);
-
 	/*
 	**    YYSTACKDEPTH       is the maximum depth of the parser's stack.  If
 	**                       zero the stack is dynamically sized using realloc()
@@ -98,14 +99,19 @@ createClause(A) ::= CREATE chains(B). {
 
 %type indexClause { AST_IndexNode* }
 
-indexClause(A) ::= indexOpToken(B) INDEX ON indexLabel(C) indexProp(D) . {
-  A = New_AST_IndexNode(C.strval, D.strval, B);
+indexClause(A) ::= CREATE INDEX ON indexLabel(B) indexProp(C) indexTrigrams(D) . {
+  A = New_AST_IndexNode(B.strval, C.strval, CREATE_INDEX, D);
+}
+
+indexClause(A) ::= DROP INDEX ON indexLabel(B) indexProp(C) . {
+  A = New_AST_IndexNode(B.strval, C.strval, DROP_INDEX, false);
 }
 
-%type indexOpToken { AST_IndexOpType }
+// Trigrams of indexed strings serve CONTAINS and ENDS WITH, built on request.
+%type indexTrigrams {bool}
 
-indexOpToken(A) ::= CREATE . { A = CREATE_INDEX; }
-indexOpToken(A) ::= DROP . { A = DROP_INDEX; }
+indexTrigrams(A) ::= . { A = false; }
+indexTrigrams(A) ::= TRIGRAM . { A = true; }
 
 indexLabel(A) ::= COLON UQSTRING(B) . {
   A = B;
@@ -505,6 +511,9 @@ relation(A) ::= LT. { A = LT; }
 relation(A) ::= LE. { A = LE; }
 relation(A) ::= GE. { A = GE; }
 relation(A) ::= NE. { A = NE; }
+relation(A) ::= STARTS WITH. { A = STARTS; }
+relation(A) ::= ENDS WITH. { A = ENDS; }
+relation(A) ::= CONTAINS. { A = CONTAINS; }
 
 //%type arithmetic_operator {int}
 //arithmetic_operator(A) ::= MUL. { A = MUL; }
@@ -524,37 +533,84 @@ value(A) ::= TRUE. { A = SI_BoolVal(1); }
 value(A) ::= FALSE. { A = SI_BoolVal(0); }
 value(A) ::= NULLVAL. { A = SI_NullVal(); }
 
+// query parameter, placeholder is bound prior to execution
+value(A) ::= PARAMETER(B). {
+	A = SI_StringVal(B.strval);
+	free(B.strval);
+	Vector_Push(ctx->parameters, A.stringval);
+}
+
 %code {
 
 	/* Definitions of flex stuff */
 	typedef struct yy_buffer_state *YY_BUFFER_STATE;
-	int             yylex( void );
-	extern int             yylex_destroy (void);
-	YY_BUFFER_STATE yy_scan_string( const char * );
-  	YY_BUFFER_STATE yy_scan_bytes( const char *, size_t );
-  	extern int yylineno;
-  	extern char *yytext;
-	extern int yycolumn;
-
+	typedef void* yyscan_t;
+	int yylex(yyscan_t yyscanner);
+	int yylex_init_extra(Token *user_defined, yyscan_t *scanner);
+	int yylex_destroy(yyscan_t yyscanner);
+	void yyset_column(int column_no, yyscan_t yyscanner);
+	YY_BUFFER_STATE yy_scan_bytes(const char *bytes, size_t len, yyscan_t yyscanner);
+
+	/* Both lexer and parser state are local to each call, queries can be parsed concurrently. */
 	AST_Query *Query_Parse(const char *q, size_t len, char **err) {
-		yycolumn = 1;	// Reset lexer's token tracking position
-		yy_scan_bytes(q, len);
+		Token tok;
+		yyscan_t scanner;
+		yylex_init_extra(&tok, &scanner);
+		yy_scan_bytes(q, len, scanner);
+		yyset_column(1, scanner);	// Reset lexer's token tracking position
   		void* pParser = ParseAlloc(malloc);
-  		int t = 0;
+		int t = 0;
 
-		parseCtx ctx = {.root = NULL, .ok = 1, .errorMsg = NULL};
+		parseCtx ctx = {.root = NULL, .ok = 1, .errorMsg = NULL, .parameters = NewVector(char*, 0)};
 
-		while( (t = yylex()) != 0) {
+		while( (t = yylex(scanner)) != 0) {
 			Parse(pParser, t, tok, &ctx);
 		}
 		if (ctx.ok) {
 			Parse(pParser, 0, tok, &ctx);
   		}
 		ParseFree(pParser, free);
+		if (ctx.root) {
+			ctx.root->parameters = ctx.parameters;
+		} else {
+			Vector_Free(ctx.parameters);
+		}
 		if (err) {
 			*err = ctx.errorMsg;
 		}
-		yylex_destroy();
+		yylex_destroy(scanner);
 		return ctx.root;
 	}
+
+	/* Tokenizes query without parsing it, looking for clauses which modify the graph. */
+	bool Query_ReadOnly(const char *q, size_t len) {
+		Token tok;
+		yyscan_t scanner;
+		yylex_init_extra(&tok, &scanner);
+		yy_scan_bytes(q, len, scanner);
+		yyset_column(1, scanner);
+
+		int t = 0;
+		bool readonly = true;
+		while(readonly && (t = yylex(scanner)) != 0) {
+			switch(t) {
+				case CREATE:
+				case MERGE:
+				case DELETE:
+				case SET:
+				case DROP:
+					readonly = false;
+					break;
+				case UQSTRING:
+				case STRING:
+				case PARAMETER:
+					free(tok.strval);
+					break;
+				default:
+					break;
+			}
+		}
+		yylex_destroy(scanner);
+		return readonly;
+	}
 }
\ No newline at end of file
@@ -14,6 +14,7 @@ typedef struct {
     AST_Query *root;
     int ok;
     char *errorMsg;
+    Vector *parameters;    // Names of $parameters encountered.
 } parseCtx;
 
 #endif
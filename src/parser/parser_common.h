@@ -8,7 +8,12 @@
 #ifndef __PARSER_COMMON_H__
 #define __PARSER_COMMON_H__
 #include <stdlib.h>
+#include <stdbool.h>
 #include "ast.h"
 
 AST_Query *Query_Parse(const char *q, size_t len, char **err);
+
+/* Determines whether query q is read only without parsing it,
+ * agrees with AST_ReadOnly on the AST Query_Parse would produce. */
+bool Query_ReadOnly(const char *q, size_t len);
 #endif
@@ -17,6 +17,4 @@ typedef struct {
   int pos;  // position in the query
 } Token;
 
-extern Token tok;
-
 #endif
@@ -0,0 +1,313 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#include "query_cache.h"
+
+#include <assert.h>
+#include <pthread.h>
+#include "util/arr.h"
+#include "query_executor.h"
+#include "util/triemap/triemap.h"
+
+typedef struct _QueryCacheEntry {
+    char *key;                      // Graph name followed by query text.
+    size_t key_len;                 // Key length.
+    CachedQuery **pool;             // Idle ASTs.
+    struct _QueryCacheEntry *prev;  // More recently used entry.
+    struct _QueryCacheEntry *next;  // Less recently used entry.
+} QueryCacheEntry;
+
+static pthread_mutex_t _cache_lock = PTHREAD_MUTEX_INITIALIZER;
+static TrieMap *_cache = NULL;              // Maps key to QueryCacheEntry.
+static QueryCacheEntry *_lru_head = NULL;   // Most recently used entry.
+static QueryCacheEntry *_lru_tail = NULL;   // Least recently used entry.
+static QueryCacheStats _cache_stats = {0};
+
+//------------------------------------------------------------------------------
+// Parameter placeholders
+//------------------------------------------------------------------------------
+
+static void _CachedQuery_CollectConstant(CachedQuery *cq, SIValue *v) {
+    char *name = (char*)AST_GetParameterName(cq->ast, *v);
+    if(!name) return;
+
+    // Entities can be shared between clauses, e.g. MERGE and MATCH.
+    for(int i = 0; i < array_len(cq->slots); i++) {
+        if(cq->slots[i].value == v) return;
+    }
+
+    ParameterSlot slot = {.name = name, .value = v};
+    cq->slots = array_append(cq->slots, slot);
+}
+
+static void _CachedQuery_CollectExpression(CachedQuery *cq, AST_ArithmeticExpressionNode *exp) {
+    if(!exp) return;
+
+    if(exp->type == AST_AR_EXP_OP) {
+        for(int i = 0; i < Vector_Size(exp->op.args); i++) {
+            AST_ArithmeticExpressionNode *child;
+            Vector_Get(exp->op.args, i, &child);
+            _CachedQuery_CollectExpression(cq, child);
+        }
+    } else if(exp->operand.type == AST_AR_EXP_CONSTANT) {
+        _CachedQuery_CollectConstant(cq, &exp->operand.constant);
+    }
+}
+
+static void _CachedQuery_CollectFilter(CachedQuery *cq, AST_FilterNode *filter) {
+    if(!filter) return;
+
+    if(filter->t == N_PRED) {
+        _CachedQuery_CollectExpression(cq, filter->pn.lhs);
+        _CachedQuery_CollectExpression(cq, filter->pn.rhs);
+    } else {
+        _CachedQuery_CollectFilter(cq, filter->cn.left);
+        _CachedQuery_CollectFilter(cq, filter->cn.right);
+    }
+}
+
+static void _CachedQuery_CollectEntities(CachedQuery *cq, Vector *entities) {
+    if(!entities) return;
+
+    for(int i = 0; i < Vector_Size(entities); i++) {
+        AST_GraphEntity *entity;
+        Vector_Get(entities, i, &entity);
+        if(!entity->properties) continue;
+
+        // Properties are stored as key value pairs.
+        for(int j = 1; j < Vector_Size(entity->properties); j += 2) {
+            SIValue *value;
+            Vector_Get(entity->properties, j, &value);
+            _CachedQuery_CollectConstant(cq, value);
+        }
+    }
+}
+
+/* Locates every placeholder within the AST, including copies introduced
+ * by ModifyAST, e.g. inline properties migrated to the WHERE clause. */
+static void _CachedQuery_CollectSlots(CachedQuery *cq) {
+    AST_Query *ast = cq->ast;
+    array_clear(cq->slots);
+    if(Vector_Size(ast->parameters) == 0) return;
+
+    if(ast->matchNode) _CachedQuery_CollectEntities(cq, ast->matchNode->_mergedPatterns);
+    if(ast->createNode) _CachedQuery_CollectEntities(cq, ast->createNode->graphEntities);
+    if(ast->mergeNode) _CachedQuery_CollectEntities(cq, ast->mergeNode->graphEntities);
+    if(ast->whereNode) _CachedQuery_CollectFilter(cq, ast->whereNode->filters);
+
+    if(ast->setNode) {
+        for(int i = 0; i < Vector_Size(ast->setNode->set_elements); i++) {
+            AST_SetElement *elem;
+            Vector_Get(ast->setNode->set_elements, i, &elem);
+            _CachedQuery_CollectExpression(cq, elem->exp);
+        }
+    }
+
+    if(ast->returnNode) {
+        for(int i = 0; i < Vector_Size(ast->returnNode->returnElements); i++) {
+            AST_ReturnElementNode *elem;
+            Vector_Get(ast->returnNode->returnElements, i, &elem);
+            _CachedQuery_CollectExpression(cq, elem->exp);
+        }
+    }
+}
+
+// Restores placeholders, such that slots can be located again.
+static void _CachedQuery_Unbind(CachedQuery *cq) {
+    for(int i = 0; i < array_len(cq->slots); i++) {
+        ParameterSlot *slot = cq->slots + i;
+        *slot->value = (SIValue){.stringval = slot->name, .type = T_STRING};
+    }
+}
+
+//------------------------------------------------------------------------------
+// CachedQuery
+//------------------------------------------------------------------------------
+
+CachedQuery* CachedQuery_New(const char *graph, const char *query, AST_Query *ast) {
+    assert(graph && query && ast);
+
+    size_t graph_len = strlen(graph);
+    size_t query_len = strlen(query);
+
+    CachedQuery *cq = malloc(sizeof(CachedQuery));
+    cq->key_len = graph_len + 1 + query_len;
+    cq->key = malloc(cq->key_len + 1);
+    memcpy(cq->key, graph, graph_len + 1);
+    memcpy(cq->key + graph_len + 1, query, query_len + 1);
+    cq->query = cq->key + graph_len + 1;
+    cq->ast = ast;
+    cq->slots = array_new(ParameterSlot, 0);
+    cq->prepared = false;
+    cq->schema_version = 0;
+    return cq;
+}
+
+AST_Validation CachedQuery_Prepare(RedisModuleCtx *ctx, CachedQuery *cq, GraphContext *gc) {
+    if(cq->prepared) {
+        if(cq->schema_version == gc->schema_version) return AST_VALID;
+
+        /* AST was modified against an outdated schema,
+         * ModifyAST isn't reversible, parse query again. */
+        char *errMsg = NULL;
+        Free_AST_Query(cq->ast);
+        cq->ast = ParseQuery(cq->query, strlen(cq->query), &errMsg);
+        cq->prepared = false;
+        array_clear(cq->slots);
+        assert(cq->ast);
+    }
+
+    // Perform query validations before and after ModifyAST
+    if(AST_PerformValidations(ctx, cq->ast) != AST_VALID) return AST_INVALID;
+    ModifyAST(gc, cq->ast);
+    if(AST_PerformValidations(ctx, cq->ast) != AST_VALID) return AST_INVALID;
+
+    _CachedQuery_CollectSlots(cq);
+    cq->schema_version = gc->schema_version;
+    cq->prepared = true;
+    return AST_VALID;
+}
+
+int CachedQuery_Bind(RedisModuleCtx *ctx, CachedQuery *cq, QueryParam *params) {
+    /* Bound values remain owned by params, entities created
+     * or updated by the query store copies of them. */
+    for(int i = 0; i < array_len(cq->slots); i++) {
+        ParameterSlot *slot = cq->slots + i;
+        SIValue *v = (params) ? QueryParams_Get(params, slot->name) : NULL;
+        if(!v) {
+            char *reply;
+            asprintf(&reply, "Missing value for parameter $%s.", slot->name);
+            RedisModule_ReplyWithError(ctx, reply);
+            free(reply);
+            return 0;
+        }
+        *slot->value = *v;
+    }
+    return 1;
+}
+
+void CachedQuery_Free(CachedQuery *cq) {
+    if(!cq) return;
+    _CachedQuery_Unbind(cq);
+    Free_AST_Query(cq->ast);
+    array_free(cq->slots);
+    free(cq->key);
+    free(cq);
+}
+
+//------------------------------------------------------------------------------
+// Query cache
+//------------------------------------------------------------------------------
+
+static void _QueryCache_Unlink(QueryCacheEntry *entry) {
+    if(entry->prev) entry->prev->next = entry->next;
+    else _lru_head = entry->next;
+    if(entry->next) entry->next->prev = entry->prev;
+    else _lru_tail = entry->prev;
+    entry->prev = NULL;
+    entry->next = NULL;
+}
+
+static void _QueryCache_PushFront(QueryCacheEntry *entry) {
+    entry->prev = NULL;
+    entry->next = _lru_head;
+    if(_lru_head) _lru_head->prev = entry;
+    _lru_head = entry;
+    if(!_lru_tail) _lru_tail = entry;
+}
+
+static void _QueryCache_FreeEntry(void *value) {
+    QueryCacheEntry *entry = value;
+    for(int i = 0; i < array_len(entry->pool); i++) CachedQuery_Free(entry->pool[i]);
+    array_free(entry->pool);
+    free(entry->key);
+    free(entry);
+}
+
+// Discards least recently used entry.
+static void _QueryCache_Evict() {
+    QueryCacheEntry *entry = _lru_tail;
+    _QueryCache_Unlink(entry);
+    TrieMap_Delete(_cache, entry->key, entry->key_len, _QueryCache_FreeEntry);
+    _cache_stats.size--;
+}
+
+static QueryCacheEntry* _QueryCache_Find(const char *key, size_t key_len) {
+    if(!_cache) _cache = NewTrieMap();
+    QueryCacheEntry *entry = TrieMap_Find(_cache, (char*)key, key_len);
+    if(entry == TRIEMAP_NOTFOUND) return NULL;
+    return entry;
+}
+
+CachedQuery* QueryCache_Checkout(const char *graph, const char *query) {
+    size_t graph_len = strlen(graph);
+    size_t key_len = graph_len + 1 + strlen(query);
+    if(key_len > UINT16_MAX) return NULL;   // TrieMap keys are limited in length.
+
+    char key[key_len];
+    memcpy(key, graph, graph_len + 1);
+    memcpy(key + graph_len + 1, query, key_len - graph_len - 1);
+
+    CachedQuery *cq = NULL;
+    pthread_mutex_lock(&_cache_lock);
+    QueryCacheEntry *entry = _QueryCache_Find(key, key_len);
+    if(entry && array_len(entry->pool) > 0) {
+        cq = array_pop(entry->pool);
+        _QueryCache_Unlink(entry);
+        _QueryCache_PushFront(entry);
+        _cache_stats.hits++;
+    } else {
+        _cache_stats.misses++;
+    }
+    pthread_mutex_unlock(&_cache_lock);
+
+    return cq;
+}
+
+void QueryCache_Release(CachedQuery *cq) {
+    if(!cq) return;
+
+    // Only ASTs which passed validation are reused.
+    if(!cq->prepared || cq->key_len > UINT16_MAX) {
+        CachedQuery_Free(cq);
+        return;
+    }
+
+    _CachedQuery_Unbind(cq);
+
+    pthread_mutex_lock(&_cache_lock);
+    QueryCacheEntry *entry = _QueryCache_Find(cq->key, cq->key_len);
+    if(!entry) {
+        if(_cache_stats.size == QUERY_CACHE_CAPACITY) _QueryCache_Evict();
+        entry = malloc(sizeof(QueryCacheEntry));
+        entry->key = malloc(cq->key_len);
+        memcpy(entry->key, cq->key, cq->key_len);
+        entry->key_len = cq->key_len;
+        entry->pool = array_new(CachedQuery*, 1);
+        entry->prev = NULL;
+        entry->next = NULL;
+        TrieMap_Add(_cache, entry->key, entry->key_len, entry, NULL);
+        _QueryCache_PushFront(entry);
+        _cache_stats.size++;
+    }
+
+    if(array_len(entry->pool) < QUERY_CACHE_POOL_SIZE) {
+        entry->pool = array_append(entry->pool, cq);
+        cq = NULL;
+    }
+    pthread_mutex_unlock(&_cache_lock);
+
+    // Pool is full.
+    if(cq) CachedQuery_Free(cq);
+}
+
+void QueryCache_GetStats(QueryCacheStats *stats) {
+    assert(stats);
+    pthread_mutex_lock(&_cache_lock);
+    *stats = _cache_stats;
+    pthread_mutex_unlock(&_cache_lock);
+}
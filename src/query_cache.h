@@ -0,0 +1,70 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#ifndef QUERY_CACHE_H
+#define QUERY_CACHE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "redismodule.h"
+#include "query_params.h"
+#include "parser/ast.h"
+#include "graph/graphcontext.h"
+
+/* Query cache keeps parsed, validated and modified ASTs, keyed by graph name
+ * and query text, such that repeated queries skip parsing and AST rewrites.
+ * Each query text maps to a pool of ASTs, an AST is used by a single query
+ * at a time, parameters are bound to it prior to execution.
+ * Execution plans hold execution state and are built per query. */
+
+#define QUERY_CACHE_CAPACITY 512   // Maximum number of distinct queries cached.
+#define QUERY_CACHE_POOL_SIZE 8    // Maximum number of idle ASTs per query.
+
+typedef struct {
+    char *name;      // Parameter name.
+    SIValue *value;  // Placeholder constant within AST.
+} ParameterSlot;
+
+typedef struct {
+    char *key;                  // Graph name followed by query text.
+    size_t key_len;             // Key length.
+    const char *query;          // Query text, within key.
+    AST_Query *ast;             // Query AST.
+    ParameterSlot *slots;       // Parameter placeholders within AST.
+    bool prepared;              // AST was validated and modified.
+    uint64_t schema_version;    // Graph schema version AST was modified against.
+} CachedQuery;
+
+typedef struct {
+    uint64_t hits;      // Number of queries served from cache.
+    uint64_t misses;    // Number of queries parsed.
+    uint64_t size;      // Number of distinct queries cached.
+} QueryCacheStats;
+
+/* Wraps a newly parsed AST for query issued against graph. */
+CachedQuery* CachedQuery_New(const char *graph, const char *query, AST_Query *ast);
+
+/* Validates and modifies AST, unless it was already prepared against
+ * gc's current schema. On failure an error is replied and AST_INVALID returned. */
+AST_Validation CachedQuery_Prepare(RedisModuleCtx *ctx, CachedQuery *cq, GraphContext *gc);
+
+/* Binds parameters values to their placeholders.
+ * On missing parameter an error is replied and 0 returned. */
+int CachedQuery_Bind(RedisModuleCtx *ctx, CachedQuery *cq, QueryParam *params);
+
+void CachedQuery_Free(CachedQuery *cq);
+
+/* Retrieves an idle AST for query issued against graph, NULL if none is available. */
+CachedQuery* QueryCache_Checkout(const char *graph, const char *query);
+
+/* Returns cq to the cache, cq must not be accessed once this function returns. */
+void QueryCache_Release(CachedQuery *cq);
+
+/* Retrieves a snapshot of query cache statistics. */
+void QueryCache_GetStats(QueryCacheStats *stats);
+
+#endif
@@ -0,0 +1,86 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#include "query_params.h"
+#include <assert.h>
+#include <stdbool.h>
+#include "util/arr.h"
+
+// Parses literal s into v, returns false if s is not a valid literal.
+static bool _QueryParams_ParseValue(const char *s, size_t len, SIValue *v) {
+    if(len == 0) return false;
+
+    // String literal, enclosed by "" or ''.
+    if(len >= 2 && (s[0] == '"' || s[0] == '\'') && s[len-1] == s[0]) {
+        char *str = strndup(s+1, len-2);
+        *v = (SIValue){.stringval = str, .type = T_STRING};
+        return true;
+    }
+
+    if(strcasecmp(s, "true") == 0) {
+        *v = SI_BoolVal(1);
+        return true;
+    }
+    if(strcasecmp(s, "false") == 0) {
+        *v = SI_BoolVal(0);
+        return true;
+    }
+    if(strcasecmp(s, "null") == 0) {
+        *v = SI_NullVal();
+        return true;
+    }
+
+    // Numeric values are represented as doubles, same as query literals.
+    char *end;
+    double d = strtod(s, &end);
+    if(end != s + len) return false;
+    *v = SI_DoubleVal(d);
+    return true;
+}
+
+QueryParam* QueryParams_Parse(RedisModuleString **argv, int argc, char **err) {
+    if(argc % 2 != 0) {
+        *err = strdup("Query parameters must be specified as name value pairs.");
+        return NULL;
+    }
+
+    QueryParam *params = array_new(QueryParam, argc/2);
+    for(int i = 0; i < argc; i += 2) {
+        size_t len;
+        const char *name = RedisModule_StringPtrLen(argv[i], NULL);
+        const char *value = RedisModule_StringPtrLen(argv[i+1], &len);
+        if(name[0] == '$') name++;
+
+        QueryParam param = {.name = strdup(name)};
+        if(!_QueryParams_ParseValue(value, len, &param.value)) {
+            asprintf(err, "Invalid value for parameter '%s', expecting a number, a quoted string, true, false or null.", param.name);
+            free(param.name);
+            QueryParams_Free(params);
+            return NULL;
+        }
+        params = array_append(params, param);
+    }
+
+    return params;
+}
+
+SIValue* QueryParams_Get(QueryParam *params, const char *name) {
+    assert(params && name);
+    for(int i = 0; i < array_len(params); i++) {
+        if(strcmp(params[i].name, name) == 0) return &params[i].value;
+    }
+    return NULL;
+}
+
+void QueryParams_Free(QueryParam *params) {
+    if(!params) return;
+    for(int i = 0; i < array_len(params); i++) {
+        free(params[i].name);
+        SIValue_Free(&params[i].value);
+    }
+    array_free(params);
+}
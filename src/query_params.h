@@ -0,0 +1,32 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#ifndef QUERY_PARAMS_H
+#define QUERY_PARAMS_H
+
+#include "redismodule.h"
+#include "value.h"
+
+/* Query parameters are specified as name value pairs following the query:
+ * GRAPH.QUERY <graph> <query> [<name> <value> ...]
+ * Values are literals: numbers, quoted strings, true, false or null. */
+
+typedef struct {
+    char *name;     // Parameter name, without '$' prefix.
+    SIValue value;  // Parameter value.
+} QueryParam;
+
+/* Parses argc name value pairs from argv into an array of parameters,
+ * returns NULL and sets err on malformed input. */
+QueryParam* QueryParams_Parse(RedisModuleString **argv, int argc, char **err);
+
+/* Retrieves the value of parameter name, NULL if not specified. */
+SIValue* QueryParams_Get(QueryParam *params, const char *name);
+
+void QueryParams_Free(QueryParam *params);
+
+#endif
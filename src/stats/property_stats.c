@@ -0,0 +1,243 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#include "property_stats.h"
+#include <ctype.h>
+#include "../util/arr.h"
+#include "../util/hll.h"
+#include "../util/rmalloc.h"
+#include "../parser/grammar.h"
+#include "../GraphBLASExt/tuples_iter.h"
+
+/* Accumulates a single property's values during a scan. */
+typedef struct {
+    const char *property;
+    uint64_t null_count;
+    double *values;         // Numeric values encountered.
+    HLL *hll;               // Distinct values sketch.
+} _PropertyCollector;
+
+/* Hashes v such that values which compare equal share a hash,
+ * buf is a scratch buffer of cap bytes, grown as needed. */
+static uint64_t _HashValue(SIValue v, char **buf, size_t *cap) {
+    if(v.type == T_STRING) {
+        // Strings are compared case insensitive.
+        size_t len = strlen(v.stringval);
+        if(len > *cap) {
+            *cap = len;
+            *buf = rm_realloc(*buf, *cap);
+        }
+        for(size_t i = 0; i < len; i++) (*buf)[i] = tolower(v.stringval[i]);
+        return HLL_Hash(*buf, len);
+    }
+
+    if(v.type & SI_NUMERIC) {
+        // Numerics of different types are compared as doubles.
+        double d;
+        SIValue_ToDouble(&v, &d);
+        if(d == 0) d = 0;   // -0 == 0
+        return HLL_Hash(&d, sizeof(d));
+    }
+
+    return HLL_Hash(&v.type, sizeof(v.type));
+}
+
+static int _CompareDoubles(const void *a, const void *b) {
+    double da = *(const double*)a;
+    double db = *(const double*)b;
+    return (da > db) - (da < db);
+}
+
+static PropertyStats* _PropertyStats_Build(const char *label, _PropertyCollector *c,
+                                           uint64_t entity_count) {
+    PropertyStats *stats = rm_malloc(sizeof(PropertyStats));
+    stats->label = rm_strdup(label);
+    stats->property = rm_strdup(c->property);
+    stats->entity_count = entity_count;
+    stats->null_count = c->null_count;
+    stats->distinct = (entity_count > c->null_count) ? HLL_Count(c->hll) : 0;
+
+    // Equi-depth histogram, bucket boundaries are evenly spaced ranks.
+    uint64_t n = array_len(c->values);
+    stats->numeric_count = n;
+    stats->bucket_count = (n < STATS_HISTOGRAM_BUCKETS) ? n : STATS_HISTOGRAM_BUCKETS;
+    stats->bounds = NULL;
+    if(n > 0) {
+        qsort(c->values, n, sizeof(double), _CompareDoubles);
+        stats->bounds = rm_malloc(sizeof(double) * (stats->bucket_count + 1));
+        for(int i = 0; i <= stats->bucket_count; i++) {
+            stats->bounds[i] = c->values[(i * (n - 1)) / stats->bucket_count];
+        }
+    }
+
+    return stats;
+}
+
+PropertyStats** PropertyStats_Collect(Graph *g, const LabelStore *store) {
+    // Collector per property in label schema.
+    _PropertyCollector *collectors = array_new(_PropertyCollector, store->properties->cardinality);
+    char *ptr;
+    tm_len_t len;
+    void *v;
+    TrieMapIterator *schema_it = TrieMap_Iterate(store->properties, "", 0);
+    while(TrieMapIterator_Next(schema_it, &ptr, &len, &v)) {
+        _PropertyCollector c;
+        char *property = rm_malloc(len + 1);
+        memcpy(property, ptr, len);
+        property[len] = '\0';
+        c.property = property;
+        c.null_count = 0;
+        c.values = array_new(double, 0);
+        c.hll = HLL_New();
+        collectors = array_append(collectors, c);
+    }
+    TrieMapIterator_Free(schema_it);
+
+    // Scan labeled nodes.
+    Node node;
+    NodeID node_id;
+    uint64_t entity_count = 0;
+    int collector_count = array_len(collectors);
+    size_t key_cap = 64;
+    char *key_buf = rm_malloc(key_cap);
+    TuplesIter *it = TuplesIter_new(Graph_GetLabel(g, store->id));
+    while(TuplesIter_next(it, NULL, &node_id) != TuplesIter_DEPLETED) {
+        Graph_GetNode(g, node_id, &node);
+        entity_count++;
+
+        for(int i = 0; i < collector_count; i++) {
+            _PropertyCollector *c = collectors + i;
+            SIValue *value = GraphEntity_Get_Property((GraphEntity*)&node, c->property);
+            if(value == PROPERTY_NOTFOUND) {
+                c->null_count++;
+                continue;
+            }
+
+            HLL_AddHash(c->hll, _HashValue(*value, &key_buf, &key_cap));
+            if(value->type & SI_NUMERIC) {
+                double d;
+                SIValue_ToDouble(value, &d);
+                c->values = array_append(c->values, d);
+            }
+        }
+    }
+    TuplesIter_free(it);
+    rm_free(key_buf);
+
+    PropertyStats **stats = array_new(PropertyStats*, collector_count);
+    for(int i = 0; i < collector_count; i++) {
+        _PropertyCollector *c = collectors + i;
+        stats = array_append(stats, _PropertyStats_Build(store->label, c, entity_count));
+        rm_free((char*)c->property);
+        array_free(c->values);
+        HLL_Free(c->hll);
+    }
+    array_free(collectors);
+
+    return stats;
+}
+
+// Fraction of numeric values smaller than d.
+static double _PropertyStats_FractionBelow(const PropertyStats *stats, double d) {
+    int buckets = stats->bucket_count;
+    const double *bounds = stats->bounds;
+    if(d <= bounds[0]) return 0;
+    if(d > bounds[buckets]) return 1;
+
+    // Locate bucket containing d, assume values are spread evenly within it.
+    int b = 0;
+    while(b < buckets - 1 && bounds[b + 1] < d) b++;
+    double width = bounds[b + 1] - bounds[b];
+    double within = (width > 0) ? (d - bounds[b]) / width : 1;
+    return (b + within) / buckets;
+}
+
+double PropertyStats_Selectivity(const PropertyStats *stats, int op, SIValue v) {
+    if(stats->entity_count == 0) return 0;
+
+    double non_null = (double)(stats->entity_count - stats->null_count) / stats->entity_count;
+    double distinct = (stats->distinct < 1) ? 1 : stats->distinct;
+
+    switch(op) {
+        case EQ:
+            return non_null / distinct;
+        case NE:
+            return non_null * (1 - 1 / distinct);
+        case LT:
+        case LE:
+        case GT:
+        case GE:
+            break;
+        default:
+            return STATS_UNKNOWN;
+    }
+
+    // Range predicates are estimated by the numeric histogram.
+    if(!(v.type & SI_NUMERIC)) return STATS_UNKNOWN;
+    if(stats->numeric_count == 0) return 0;
+
+    double d;
+    SIValue_ToDouble(&v, &d);
+    double below = _PropertyStats_FractionBelow(stats, d);
+    double numeric = (double)stats->numeric_count / stats->entity_count;
+    return (op == LT || op == LE) ? numeric * below : numeric * (1 - below);
+}
+
+void PropertyStats_RdbSave(RedisModuleIO *rdb, const PropertyStats *stats) {
+    /* Format:
+     * label
+     * property
+     * entity count
+     * null count
+     * numeric count
+     * distinct
+     * #buckets
+     * bucket boundaries X (#buckets + 1)
+     */
+
+    RedisModule_SaveStringBuffer(rdb, stats->label, strlen(stats->label) + 1);
+    RedisModule_SaveStringBuffer(rdb, stats->property, strlen(stats->property) + 1);
+    RedisModule_SaveUnsigned(rdb, stats->entity_count);
+    RedisModule_SaveUnsigned(rdb, stats->null_count);
+    RedisModule_SaveUnsigned(rdb, stats->numeric_count);
+    RedisModule_SaveDouble(rdb, stats->distinct);
+    RedisModule_SaveUnsigned(rdb, stats->bucket_count);
+    if(stats->bounds) {
+        for(int i = 0; i <= stats->bucket_count; i++) RedisModule_SaveDouble(rdb, stats->bounds[i]);
+    }
+}
+
+static char* _RdbLoadString(RedisModuleIO *rdb) {
+    char *buf = RedisModule_LoadStringBuffer(rdb, NULL);
+    char *str = rm_strdup(buf);
+    RedisModule_Free(buf);
+    return str;
+}
+
+PropertyStats* PropertyStats_RdbLoad(RedisModuleIO *rdb) {
+    PropertyStats *stats = rm_malloc(sizeof(PropertyStats));
+    stats->label = _RdbLoadString(rdb);
+    stats->property = _RdbLoadString(rdb);
+    stats->entity_count = RedisModule_LoadUnsigned(rdb);
+    stats->null_count = RedisModule_LoadUnsigned(rdb);
+    stats->numeric_count = RedisModule_LoadUnsigned(rdb);
+    stats->distinct = RedisModule_LoadDouble(rdb);
+    stats->bucket_count = RedisModule_LoadUnsigned(rdb);
+    stats->bounds = NULL;
+    if(stats->numeric_count > 0) {
+        stats->bounds = rm_malloc(sizeof(double) * (stats->bucket_count + 1));
+        for(int i = 0; i <= stats->bucket_count; i++) stats->bounds[i] = RedisModule_LoadDouble(rdb);
+    }
+    return stats;
+}
+
+void PropertyStats_Free(PropertyStats *stats) {
+    rm_free(stats->label);
+    rm_free(stats->property);
+    if(stats->bounds) rm_free(stats->bounds);
+    rm_free(stats);
+}
@@ -0,0 +1,48 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#ifndef __PROPERTY_STATS_H__
+#define __PROPERTY_STATS_H__
+
+#include "../value.h"
+#include "../redismodule.h"
+#include "../graph/graph.h"
+#include "../stores/store.h"
+
+#define STATS_HISTOGRAM_BUCKETS 32  // Maximum number of histogram buckets.
+#define STATS_UNKNOWN -1            // Selectivity can't be estimated from statistics.
+
+/* PropertyStats describes the distribution of a property's values
+ * across all nodes of a label, as collected by GRAPH.ANALYZE.
+ * Numeric values are summarized by an equi-depth histogram, where each
+ * bucket holds the same number of values, the number of distinct values
+ * is estimated by a HyperLogLog sketch. */
+typedef struct {
+    char *label;
+    char *property;
+    uint64_t entity_count;      // Number of nodes analyzed.
+    uint64_t null_count;        // Number of nodes missing property.
+    uint64_t numeric_count;     // Number of numeric values.
+    double distinct;            // Estimated number of distinct values.
+    int bucket_count;           // Number of histogram buckets.
+    double *bounds;             // Histogram bucket boundaries, bucket_count + 1 values.
+} PropertyStats;
+
+/* Scans all nodes of label, collecting statistics for each property
+ * in the label's schema, returns an array of PropertyStats*. */
+PropertyStats** PropertyStats_Collect(Graph *g, const LabelStore *store);
+
+/* Estimated fraction of nodes for which property op v holds,
+ * STATS_UNKNOWN if statistics do not cover the predicate. */
+double PropertyStats_Selectivity(const PropertyStats *stats, int op, SIValue v);
+
+void PropertyStats_RdbSave(RedisModuleIO *rdb, const PropertyStats *stats);
+PropertyStats* PropertyStats_RdbLoad(RedisModuleIO *rdb);
+
+void PropertyStats_Free(PropertyStats *stats);
+
+#endif
@@ -19,11 +19,13 @@ LabelStore* LabelStore_New(const char *label, int id) {
     return store;
 }
 
-void LabelStore_UpdateSchema(LabelStore *store, int prop_count, char **properties) {
+int LabelStore_UpdateSchema(LabelStore *store, int prop_count, char **properties) {
+    int added = 0;
     for(int idx = 0; idx < prop_count; idx++) {
         char *property = properties[idx];
-        TrieMap_Add(store->properties, property, strlen(property), NULL, NULL);
+        added += TrieMap_Add(store->properties, property, strlen(property), NULL, NULL);
     }
+    return added;
 }
 
 void LabelStore_Free(LabelStore *store) {
@@ -26,8 +26,9 @@ typedef struct {
 // Creates a new label store.
 LabelStore* LabelStore_New(const char *label, int id);
 
-/* Update store schema with given properties. */
-void LabelStore_UpdateSchema(LabelStore *store, int prop_count, char **properties);
+/* Update store schema with given properties,
+ * returns the number of properties new to the store. */
+int LabelStore_UpdateSchema(LabelStore *store, int prop_count, char **properties);
 
 /* Free store. */
 void LabelStore_Free(LabelStore *store);
@@ -0,0 +1,72 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#include "hll.h"
+#include <math.h>
+#include <string.h>
+#include "rmalloc.h"
+
+HLL* HLL_New(void) {
+    return rm_calloc(1, sizeof(HLL));
+}
+
+uint64_t HLL_Hash(const void *data, size_t len) {
+    // FNV-1a, followed by MurmurHash3's finalizer to spread low entropy input.
+    const unsigned char *p = data;
+    uint64_t h = 14695981039346656037ULL;
+    for(size_t i = 0; i < len; i++) {
+        h ^= p[i];
+        h *= 1099511628211ULL;
+    }
+
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+}
+
+void HLL_AddHash(HLL *hll, uint64_t hash) {
+    // Low bits select a register, remaining bits determine rank.
+    uint32_t idx = hash & (HLL_REGISTERS - 1);
+    uint64_t rest = hash >> HLL_PRECISION;
+
+    uint8_t rank = 1;
+    while(rank <= 64 - HLL_PRECISION && !(rest & 1)) {
+        rank++;
+        rest >>= 1;
+    }
+
+    if(rank > hll->registers[idx]) hll->registers[idx] = rank;
+}
+
+void HLL_Add(HLL *hll, const void *data, size_t len) {
+    HLL_AddHash(hll, HLL_Hash(data, len));
+}
+
+double HLL_Count(const HLL *hll) {
+    double m = HLL_REGISTERS;
+    double alpha = 0.7213 / (1 + 1.079 / m);
+
+    double sum = 0;
+    int zeros = 0;
+    for(int i = 0; i < HLL_REGISTERS; i++) {
+        sum += 1.0 / ((uint64_t)1 << hll->registers[i]);
+        if(hll->registers[i] == 0) zeros++;
+    }
+
+    double estimate = alpha * m * m / sum;
+
+    // Small cardinalities are better estimated by linear counting.
+    if(estimate <= 2.5 * m && zeros > 0) estimate = m * log(m / zeros);
+    return estimate;
+}
+
+void HLL_Free(HLL *hll) {
+    rm_free(hll);
+}
@@ -0,0 +1,42 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#ifndef __HLL_H__
+#define __HLL_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+/* HyperLogLog estimates the number of distinct elements added to it
+ * using a fixed amount of memory, with a standard error of
+ * 1.04 / sqrt(HLL_REGISTERS), roughly 1%. */
+
+#define HLL_PRECISION 14                    // Number of hash bits selecting a register.
+#define HLL_REGISTERS (1 << HLL_PRECISION)  // Number of registers.
+
+typedef struct {
+    uint8_t registers[HLL_REGISTERS];
+} HLL;
+
+/* Creates an empty HyperLogLog. */
+HLL* HLL_New(void);
+
+/* Adds element, represented by len bytes at data. */
+void HLL_Add(HLL *hll, const void *data, size_t len);
+
+/* Adds element, represented by its 64 bit hash. */
+void HLL_AddHash(HLL *hll, uint64_t hash);
+
+/* Estimated number of distinct elements added. */
+double HLL_Count(const HLL *hll);
+
+/* 64 bit hash of len bytes at data. */
+uint64_t HLL_Hash(const void *data, size_t len);
+
+void HLL_Free(HLL *hll);
+
+#endif
@@ -387,18 +387,18 @@ skiplistKey skiplistPopTail(skiplist *sl) {
 }
 
 void _update_lower_bound(skiplistIterator *iter, skiplistKey bound, int exclusive) {
-  int cmp = iter->sl->compare(iter->current->key, bound);
-  if (cmp < 0) {
-    // This filter improves the bound
-    iter->current = skiplistFindAtLeast(iter->sl, bound, exclusive);
-    iter->rangeMin = bound;
-    iter->minExclusive = exclusive;
-  } else if (cmp == 0 && exclusive && !iter->minExclusive) {
-    // Handle the unlikely edge that we compared equally, but are now specifying
-    // GT rather than GE
-    iter->current = iter->current->level[0].forward;
-    iter->minExclusive = 1;
+  if (iter->rangeMin) {
+    int cmp = iter->sl->compare(iter->rangeMin, bound);
+    // The current bound is at least as narrow.
+    if (cmp > 0 || (cmp == 0 && (iter->minExclusive || !exclusive))) return;
+    iter->sl->freeKey(iter->rangeMin);
   }
+
+  // This filter improves the bound, keep a copy so the iterator can be reset
+  // once the filter is gone.
+  iter->rangeMin = iter->sl->cloneKey(bound);
+  iter->minExclusive = exclusive;
+  iter->current = skiplistFindAtLeast(iter->sl, bound, exclusive);
 }
 
 void _update_upper_bound(skiplistIterator *iter, skiplistKey bound, int exclusive) {
@@ -469,7 +469,7 @@ skiplistIterator* skiplistIterateRange(skiplist *sl, skiplistKey min, skiplistKe
   skiplistIterator *iter = zmalloc(sizeof(skiplistIterator));
   iter->current = n;
   iter->currentValOffset = 0;
-  iter->rangeMin = min;
+  iter->rangeMin = (min && sl->cloneKey) ? sl->cloneKey(min) : min;
   iter->minExclusive = minExclusive;
   iter->rangeMax = max;
   iter->maxExclusive = maxExclusive;
@@ -498,7 +498,10 @@ void skiplistIterate_Reset(skiplistIterator *iter) {
 }
 
 void skiplistIterate_Free(skiplistIterator *iter) {
-  // If we have an upper bound and a free routine, free the bound.
+  // If we have bounds and a free routine, free the bounds.
+  if (iter->rangeMin && iter->sl->freeKey) {
+    iter->sl->freeKey(iter->rangeMin);
+  }
   if (iter->rangeMax && iter->sl->freeKey) {
     iter->sl->freeKey(iter->rangeMax);
   }
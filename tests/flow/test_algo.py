@@ -0,0 +1,249 @@
+import os
+import sys
+import time
+import unittest
+import warnings
+from redisgraph import Graph, Node, Edge
+
+import redis
+sys.path.append(os.path.dirname(os.path.abspath(__file__)) + '/../../demo/social/')
+from .disposableredis import DisposableRedis
+from base import FlowTestsBase
+import social_utils
+
+GRAPH_ID = "G"
+redis_con = None
+
+def disposable_redis():
+    return DisposableRedis(loadmodule=os.path.dirname(os.path.abspath(__file__)) + '/../../src/redisgraph.so')
+
+class AlgoFlowTest(FlowTestsBase):
+    @classmethod
+    def setUpClass(cls):
+        print "AlgoFlowTest"
+        global redis_con
+        cls.r = disposable_redis()
+        cls.r.start()
+        redis_con = cls.r.client()
+
+        # 0->1, 0->2, 1->2, 2->0, 3->2 and an unrelated 3-[:s]->4.
+        redis_graph = Graph(GRAPH_ID, redis_con)
+        nodes = [Node(label="N", properties={"v": v}) for v in range(4)]
+        nodes.append(Node(label="M", properties={"v": 4}))
+        for n in nodes:
+            redis_graph.add_node(n)
+        for src, dest in [(0, 1), (0, 2), (1, 2), (2, 0), (3, 2)]:
+            redis_graph.add_edge(Edge(nodes[src], "r", nodes[dest]))
+        redis_graph.add_edge(Edge(nodes[3], "s", nodes[4]))
+        redis_graph.commit()
+
+        social_graph = Graph(social_utils.graph_name, redis_con)
+        social_utils.populate_graph(redis_con, social_graph)
+
+    @classmethod
+    def tearDownClass(cls):
+        cls.r.stop()
+
+    def algo(self, graph, *args):
+        return redis_con.execute_command("GRAPH.ALGO", graph, *args)
+
+    def test01_pagerank(self):
+        result = self.algo(GRAPH_ID, "PAGERANK", "LABEL", "N", "RELATION", "r",
+                           "ITERATIONS", 100, "TOLERANCE", 0.000000001)
+        ranks = dict((node_id, float(rank)) for node_id, rank in result)
+        expected = {0: 0.372527, 1: 0.195824, 2: 0.394149, 3: 0.0375}
+        self.assertEqual(sorted(ranks.keys()), sorted(expected.keys()))
+        for node_id in expected:
+            self.assertAlmostEqual(ranks[node_id], expected[node_id], places=5)
+
+    # Nodes of every label are ranked when no label is specified.
+    def test02_pagerank_all_nodes(self):
+        result = self.algo(GRAPH_ID, "PAGERANK")
+        self.assertEqual(len(result), 5)
+        self.assertAlmostEqual(sum(float(rank) for _, rank in result), 1.0, places=5)
+
+    def test03_pagerank_write(self):
+        result = self.algo(GRAPH_ID, "PAGERANK", "LABEL", "N", "RELATION", "r",
+                           "ITERATIONS", 100, "WRITE", "rank")
+        self.assertEqual(result, 4)
+
+        q = "MATCH (n:N) RETURN n.v ORDER BY n.rank DESC LIMIT 1"
+        result = redis_con.execute_command("GRAPH.QUERY", GRAPH_ID, q)[0][1:]
+        self.assertEqual(result, [["2.000000"]])
+
+    def test04_invalid_arguments(self):
+        invalid = [["NOSUCHALGO"],
+                   ["PAGERANK", "LABEL"],
+                   ["PAGERANK", "DAMPING", 2],
+                   ["PAGERANK", "ITERATIONS", 0],
+                   ["PAGERANK", "NOSUCHOPTION", 1],
+                   ["PAGERANK", "LABEL", "NOSUCHLABEL"],
+                   ["PAGERANK", "RELATION", "NOSUCHRELATION"]]
+        for args in invalid:
+            with self.assertRaises(redis.exceptions.ResponseError):
+                self.algo(GRAPH_ID, *args)
+
+    # Rank friendships of the demo social graph.
+    def test05_pagerank_social(self):
+        start = time.time()
+        result = self.algo(social_utils.graph_name, "PAGERANK", "LABEL", "person", "RELATION", "friend")
+        elapsed_ms = (time.time() - start) * 1000
+
+        persons = redis_con.execute_command("GRAPH.QUERY", social_utils.graph_name,
+                                            "MATCH (p:person) RETURN count(p)")[0][1][0]
+        self.assertEqual(len(result), int(float(persons)))
+        self.assertAlmostEqual(sum(float(rank) for _, rank in result), 1.0, places=5)
+
+        max_run_time_ms = 15
+        if elapsed_ms > max_run_time_ms:
+            warnings.warn('PageRank over social graph took %f ms, but should be %d ms' %
+                          (elapsed_ms, max_run_time_ms))
+
+    def test06_wcc(self):
+        # Node 4 is only reachable through an s relationship.
+        result = self.algo(GRAPH_ID, "WCC", "RELATION", "r")
+        components = dict((node_id, component) for node_id, component in result)
+        self.assertEqual(components, {0: 0, 1: 0, 2: 0, 3: 0, 4: 4})
+
+        # Link direction is ignored.
+        result = self.algo(GRAPH_ID, "WCC")
+        components = dict((node_id, component) for node_id, component in result)
+        self.assertEqual(components, {0: 0, 1: 0, 2: 0, 3: 0, 4: 0})
+
+    def test07_wcc_write(self):
+        result = self.algo(GRAPH_ID, "WCC", "RELATION", "r", "WRITE", "component")
+        self.assertEqual(result, 5)
+
+        q = "MATCH (n) RETURN n.component, count(n) ORDER BY n.component"
+        result = redis_con.execute_command("GRAPH.QUERY", GRAPH_ID, q)[0][1:]
+        self.assertEqual(result, [["0.000000", "4.000000"], ["4.000000", "1.000000"]])
+
+    # Every person of the demo social graph is assigned a component.
+    def test08_wcc_social(self):
+        result = self.algo(social_utils.graph_name, "WCC", "LABEL", "person", "RELATION", "friend")
+        persons = redis_con.execute_command("GRAPH.QUERY", social_utils.graph_name,
+                                            "MATCH (p:person) RETURN count(p)")[0][1][0]
+        self.assertEqual(len(result), int(float(persons)))
+        for node_id, component in result:
+            self.assertLessEqual(component, node_id)
+
+    def test09_triangle_count(self):
+        # Nodes 0, 1 and 2 form the only triangle, regardless of link direction.
+        self.assertEqual(self.algo(GRAPH_ID, "TRIANGLECOUNT"), 1)
+        self.assertEqual(self.algo(GRAPH_ID, "TRIANGLECOUNT", "RELATION", "s"), 0)
+
+        with self.assertRaises(redis.exceptions.ResponseError):
+            self.algo(GRAPH_ID, "TRIANGLECOUNT", "WRITE", "triangles")
+
+    def test10_triangles(self):
+        result = self.algo(GRAPH_ID, "TRIANGLES", "RELATION", "r")
+        triangles = dict((node_id, t) for node_id, t in result)
+        self.assertEqual(triangles, {0: 1, 1: 1, 2: 1, 3: 0, 4: 0})
+
+        result = self.algo(GRAPH_ID, "CLUSTERING", "LABEL", "N", "RELATION", "r")
+        coefficients = dict((node_id, float(cc)) for node_id, cc in result)
+        expected = {0: 1.0, 1: 1.0, 2: 1.0/3, 3: 0.0}
+        self.assertEqual(sorted(coefficients.keys()), sorted(expected.keys()))
+        for node_id in expected:
+            self.assertAlmostEqual(coefficients[node_id], expected[node_id], places=5)
+
+    # Per node triangles agree with the global count over the demo social graph.
+    def test11_triangles_social(self):
+        start = time.time()
+        result = self.algo(social_utils.graph_name, "TRIANGLES", "LABEL", "person", "RELATION", "friend")
+        elapsed_ms = (time.time() - start) * 1000
+        total = self.algo(social_utils.graph_name, "TRIANGLECOUNT", "LABEL", "person", "RELATION", "friend")
+        self.assertEqual(sum(t for _, t in result), total * 3)
+
+        max_run_time_ms = 15
+        if elapsed_ms > max_run_time_ms:
+            warnings.warn('Triangle counting over social graph took %f ms, but should be %d ms' %
+                          (elapsed_ms, max_run_time_ms))
+
+    def test12_lpa(self):
+        result = self.algo(GRAPH_ID, "LPA", "RELATION", "r", "SEED", 3)
+        communities = dict((node_id, community) for node_id, community in result)
+        self.assertEqual(len(communities), 5)
+        # Nodes 0, 1 and 2 are all linked to one another, node 4 has no r links.
+        self.assertEqual(communities[0], communities[1])
+        self.assertEqual(communities[0], communities[2])
+        self.assertEqual(communities[4], 4)
+
+        # Same seed, same communities.
+        self.assertEqual(self.algo(GRAPH_ID, "LPA", "RELATION", "r", "SEED", 3), result)
+
+        with self.assertRaises(redis.exceptions.ResponseError):
+            self.algo(GRAPH_ID, "LPA", "SEED", "x")
+
+    def test13_lpa_write(self):
+        result = self.algo(social_utils.graph_name, "LPA", "LABEL", "person", "RELATION", "friend",
+                           "WRITE", "community")
+        persons = redis_con.execute_command("GRAPH.QUERY", social_utils.graph_name,
+                                            "MATCH (p:person) RETURN count(p)")[0][1][0]
+        self.assertEqual(result, int(float(persons)))
+
+        q = "MATCH (p:person) RETURN count(p.community)"
+        result = redis_con.execute_command("GRAPH.QUERY", social_utils.graph_name, q)[0][1][0]
+        self.assertEqual(result, persons)
+
+    def test14_khop(self):
+        # 3->2, 3-[:s]->4, 2->0, 0->1.
+        self.assertEqual(self.algo(GRAPH_ID, "KHOP", "SOURCE", 3, "HOPS", 3), [2, 1, 1])
+        self.assertEqual(self.algo(GRAPH_ID, "KHOP", "SOURCE", 3, "HOPS", 4, "RELATION", "r"), [1, 1, 1, 0])
+        self.assertEqual(self.algo(GRAPH_ID, "KHOP", "SOURCE", 4, "DIRECTION", "IN"), [1])
+
+        result = self.algo(GRAPH_ID, "KHOP", "SOURCE", 0, "HOPS", 2, "DIRECTION", "BOTH", "OUTPUT", "NODES")
+        levels = dict((node_id, level) for node_id, level in result)
+        self.assertEqual(levels, {0: 0, 1: 1, 2: 1, 3: 2})
+
+        invalid = [["KHOP", "HOPS", 2],
+                   ["KHOP", "SOURCE", 100],
+                   ["KHOP", "SOURCE", 4, "LABEL", "N"],
+                   ["KHOP", "SOURCE", 0, "HOPS", 0],
+                   ["KHOP", "SOURCE", 0, "DIRECTION", "UP"],
+                   ["KHOP", "SOURCE", 0, "OUTPUT", "PATHS"]]
+        for args in invalid:
+            with self.assertRaises(redis.exceptions.ResponseError):
+                self.algo(GRAPH_ID, *args)
+
+    # Reachable nodes agree with a variable length traversal over the demo social graph.
+    def test15_khop_social(self):
+        q = "MATCH (p:person) RETURN ID(p), p.name ORDER BY p.name LIMIT 1"
+        source = int(float(redis_con.execute_command("GRAPH.QUERY", social_utils.graph_name, q)[0][1][0]))
+
+        start = time.time()
+        result = self.algo(social_utils.graph_name, "KHOP", "SOURCE", source, "HOPS", 3,
+                           "LABEL", "person", "RELATION", "friend", "OUTPUT", "NODES")
+        elapsed_ms = (time.time() - start) * 1000
+        reached = set(node_id for node_id, level in result if level > 0)
+
+        q = "MATCH (p:person)-[:friend*1..3]->(f:person) WHERE ID(p) = %d RETURN DISTINCT ID(f)" % source
+        traversed = redis_con.execute_command("GRAPH.QUERY", social_utils.graph_name, q)[0][1:]
+        traversed = set(int(float(row[0])) for row in traversed) - set([source])
+        self.assertEqual(reached, traversed)
+
+        max_run_time_ms = 15
+        if elapsed_ms > max_run_time_ms:
+            warnings.warn('K-hop over social graph took %f ms, but should be %d ms' %
+                          (elapsed_ms, max_run_time_ms))
+
+    # Written results are visible through indices on the written property.
+    def test16_write_indexed(self):
+        redis_con.execute_command("GRAPH.QUERY", GRAPH_ID, "CREATE INDEX ON :N(component)")
+
+        # Only nodes 3 and 4 are linked through s relationships.
+        result = self.algo(GRAPH_ID, "WCC", "RELATION", "s", "WRITE", "component")
+        self.assertEqual(result, 5)
+
+        q = "MATCH (n:N) WHERE n.component = 0 RETURN n.v"
+        plan = redis_con.execute_command("GRAPH.EXPLAIN", GRAPH_ID, q)
+        self.assertIn("Index Scan", plan)
+        result = redis_con.execute_command("GRAPH.QUERY", GRAPH_ID, q)[0][1:]
+        self.assertEqual(result, [["0.000000"]])
+
+        q = "MATCH (n:N) WHERE n.component = 3 RETURN n.v"
+        result = redis_con.execute_command("GRAPH.QUERY", GRAPH_ID, q)[0][1:]
+        self.assertEqual(result, [["3.000000"]])
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,85 @@
+import os
+import sys
+import unittest
+from redisgraph import Graph, Node, Edge
+
+import redis
+from .disposableredis import DisposableRedis
+
+from base import FlowTestsBase
+
+GRAPH_ID = "G"
+redis_con = None
+
+def disposable_redis():
+    return DisposableRedis(loadmodule=os.path.dirname(os.path.abspath(__file__)) + '/../../src/redisgraph.so')
+
+class AnalyzeFlowTest(FlowTestsBase):
+    @classmethod
+    def setUpClass(cls):
+        print "AnalyzeFlowTest"
+        global redis_con
+        cls.r = disposable_redis()
+        cls.r.start()
+        redis_con = cls.r.client()
+
+        # 100 persons, age 0-99, 10 distinct cities, every other person missing a city.
+        redis_graph = Graph(GRAPH_ID, redis_con)
+        for i in range(100):
+            props = {"age": i}
+            if i % 2 == 0:
+                props["city"] = "city%d" % (i % 20)
+            redis_graph.add_node(Node(label="person", properties=props))
+        redis_graph.add_node(Node(label="country", properties={"name": "Israel"}))
+        redis_graph.commit()
+
+    @classmethod
+    def tearDownClass(cls):
+        cls.r.stop()
+
+    def analyze(self, *args):
+        reply = redis_con.execute_command("GRAPH.ANALYZE", GRAPH_ID, *args)
+        return dict(((label, prop), (float(null_fraction), distinct))
+                    for label, prop, null_fraction, distinct in reply)
+
+    # Label scan estimate for a filtered person scan.
+    def estimate(self, where):
+        plan = redis_con.execute_command("GRAPH.EXPLAIN", GRAPH_ID,
+                                         "MATCH (p:person) WHERE %s RETURN p" % where)
+        line = [line for line in plan.split("\n") if "Filter" in line][0]
+        return float(line.split("Estimated records: ")[1])
+
+    def test01_analyze_label(self):
+        stats = self.analyze("person")
+        self.assertEqual(len(stats), 2)
+
+        null_fraction, distinct = stats[("person", "age")]
+        self.assertEqual(null_fraction, 0)
+        self.assertAlmostEqual(distinct, 100, delta=5)
+
+        null_fraction, distinct = stats[("person", "city")]
+        self.assertEqual(null_fraction, 0.5)
+        self.assertEqual(distinct, 10)
+
+    def test02_analyze_all_labels(self):
+        stats = self.analyze()
+        self.assertEqual(len(stats), 3)
+        self.assertIn(("country", "name"), stats)
+
+    def test03_unknown_label(self):
+        with self.assertRaises(redis.exceptions.ResponseError):
+            self.analyze("animal")
+
+    # Statistics refine estimates and survive a reload.
+    def test04_estimates(self):
+        # 50 persons have a city, split evenly across 10 cities.
+        self.assertAlmostEqual(self.estimate("p.city = 'city2'"), 5, delta=0.5)
+        # Histogram estimate of ages below 25.
+        self.assertAlmostEqual(self.estimate("p.age < 25"), 25, delta=2)
+
+        redis_con.execute_command("DEBUG", "RELOAD")
+        self.assertAlmostEqual(self.estimate("p.city = 'city2'"), 5, delta=0.5)
+        self.assertAlmostEqual(self.estimate("p.age < 25"), 25, delta=2)
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,122 @@
+import os
+import sys
+import unittest
+from redisgraph import Graph, Node, Edge
+
+import redis
+from .disposableredis import DisposableRedis
+
+from base import FlowTestsBase
+
+GRAPH_ID = "G"
+redis_con = None
+
+def disposable_redis():
+    return DisposableRedis(loadmodule=os.path.dirname(os.path.abspath(__file__)) + '/../../src/redisgraph.so')
+
+class CountFlowTest(FlowTestsBase):
+    @classmethod
+    def setUpClass(cls):
+        print "CountFlowTest"
+        global redis_con
+        cls.r = disposable_redis()
+        cls.r.start()
+        redis_con = cls.r.client()
+
+        # Person i knows persons i+1 .. 4, persons also visit a single city.
+        redis_graph = Graph(GRAPH_ID, redis_con)
+        persons = [Node(label="person", properties={"v": v}) for v in range(5)]
+        city = Node(label="city", properties={"name": "Tel Aviv"})
+        for n in persons + [city]:
+            redis_graph.add_node(n)
+        for i in range(5):
+            for j in range(i + 1, 5):
+                redis_graph.add_edge(Edge(persons[i], "knows", persons[j]))
+            redis_graph.add_edge(Edge(persons[i], "visited", city))
+        redis_graph.commit()
+
+    @classmethod
+    def tearDownClass(cls):
+        cls.r.stop()
+
+    def query(self, q):
+        return redis_con.execute_command("GRAPH.QUERY", GRAPH_ID, q)[0][1:]
+
+    def plan(self, q):
+        return redis_con.execute_command("GRAPH.EXPLAIN", GRAPH_ID, q)
+
+    # A count over a single traversal is evaluated without producing records.
+    def test01_count(self):
+        q = "MATCH (a:person)-[:knows]->(b) RETURN count(b)"
+        self.assertIn("Count", self.plan(q))
+        self.assertNotIn("Conditional Traverse", self.plan(q))
+        self.assertEqual(self.query(q), [["10.000000"]])
+
+        q = "MATCH (a)-[:visited]->(c:city) RETURN count(a)"
+        self.assertEqual(self.query(q), [["5.000000"]])
+
+    def test02_count_by_source(self):
+        q = "MATCH (a:person)-[:knows]->(b) RETURN a.v, count(b) ORDER BY a.v"
+        self.assertIn("Count", self.plan(q))
+        expected = [["0.000000", "4.000000"],
+                    ["1.000000", "3.000000"],
+                    ["2.000000", "2.000000"],
+                    ["3.000000", "1.000000"]]
+        self.assertEqual(self.query(q), expected)
+
+    def test03_count_by_destination(self):
+        q = "MATCH (a:person)-[:knows]->(b) RETURN b.v, count(a) ORDER BY b.v"
+        expected = [["1.000000", "1.000000"],
+                    ["2.000000", "2.000000"],
+                    ["3.000000", "3.000000"],
+                    ["4.000000", "4.000000"]]
+        self.assertEqual(self.query(q), expected)
+
+    # Missing relationships produce no groups, as would an empty traversal.
+    def test04_empty(self):
+        q = "MATCH (a:person)-[:owns]->(b) RETURN count(b)"
+        self.assertEqual(self.query(q), [])
+
+    # Filtered or multi term groupings are aggregated record by record.
+    def test05_not_reduced(self):
+        q = "MATCH (a:person)-[:knows]->(b) WHERE a.v > 2 RETURN count(b)"
+        self.assertIn("Conditional Traverse", self.plan(q))
+        self.assertEqual(self.query(q), [["1.000000"]])
+
+        q = "MATCH (a:person)-[:knows]->(b) RETURN a.v, b.v, count(b)"
+        self.assertIn("Conditional Traverse", self.plan(q))
+        self.assertEqual(len(self.query(q)), 10)
+
+    # Entity counts are read from the graph, without scanning.
+    def test06_node_count(self):
+        q = "MATCH (n:person) RETURN count(n)"
+        plan = self.plan(q)
+        self.assertIn("Count", plan)
+        self.assertNotIn("Scan", plan)
+        self.assertEqual(self.query(q), [["5.000000"]])
+
+        q = "MATCH (n) RETURN count(n)"
+        self.assertNotIn("Scan", self.plan(q))
+        self.assertEqual(self.query(q), [["6.000000"]])
+
+        q = "MATCH (n:country) RETURN count(n)"
+        self.assertEqual(self.query(q), [])
+
+    def test07_edge_count(self):
+        q = "MATCH ()-[e:knows]->() RETURN count(e)"
+        plan = self.plan(q)
+        self.assertIn("Count", plan)
+        self.assertNotIn("Conditional Traverse", plan)
+        self.assertEqual(self.query(q), [["10.000000"]])
+
+        q = "MATCH (a)-[e]->(b) RETURN count(a)"
+        self.assertNotIn("Conditional Traverse", self.plan(q))
+        self.assertEqual(self.query(q), [["15.000000"]])
+
+        # Labeled ends restrict the counted edges.
+        q = "MATCH (a)-[e:visited]->(c:city) RETURN count(e)"
+        self.assertIn("Conditional Traverse", self.plan(q))
+        self.assertEqual(self.query(q), [["5.000000"]])
+
+if __name__ == '__main__':
+    unittest.main()
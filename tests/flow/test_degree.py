@@ -0,0 +1,78 @@
+import os
+import sys
+import unittest
+from redisgraph import Graph, Node, Edge
+
+import redis
+from .disposableredis import DisposableRedis
+
+from base import FlowTestsBase
+
+GRAPH_ID = "G"
+redis_con = None
+
+def disposable_redis():
+    return DisposableRedis(loadmodule=os.path.dirname(os.path.abspath(__file__)) + '/../../src/redisgraph.so')
+
+class DegreeFlowTest(FlowTestsBase):
+    @classmethod
+    def setUpClass(cls):
+        print "DegreeFlowTest"
+        global redis_con
+        cls.r = disposable_redis()
+        cls.r.start()
+        redis_con = cls.r.client()
+
+        # 1 knows 2 and 3, 3 knows 2, 2 likes 1.
+        redis_graph = Graph(GRAPH_ID, redis_con)
+        nodes = {}
+        for v in range(1, 4):
+            nodes[v] = Node(label="person", properties={"v": v})
+            redis_graph.add_node(nodes[v])
+        for src, dest in [(1, 2), (1, 3), (3, 2)]:
+            redis_graph.add_edge(Edge(nodes[src], "knows", nodes[dest]))
+        redis_graph.add_edge(Edge(nodes[2], "likes", nodes[1]))
+        redis_graph.commit()
+
+    @classmethod
+    def tearDownClass(cls):
+        cls.r.stop()
+
+    def query(self, q):
+        return redis_con.execute_command("GRAPH.QUERY", GRAPH_ID, q)[0][1:]
+
+    def test01_degree(self):
+        q = "MATCH (n:person) RETURN n.v, indegree(n), outdegree(n), degree(n) ORDER BY n.v"
+        expected = [["1.000000", "1", "2", "3"],
+                    ["2.000000", "2", "1", "3"],
+                    ["3.000000", "1", "1", "2"]]
+        self.assertEqual(self.query(q), expected)
+
+    def test02_degree_by_relationship_type(self):
+        q = """MATCH (n:person) RETURN n.v, indegree(n, 'knows'), outdegree(n, 'likes'), degree(n, 'unknown')
+               ORDER BY n.v"""
+        expected = [["1.000000", "0", "0", "0"],
+                    ["2.000000", "2", "1", "0"],
+                    ["3.000000", "1", "0", "0"]]
+        self.assertEqual(self.query(q), expected)
+
+    # Degrees follow edge creation and deletion.
+    def test03_degree_maintained(self):
+        redis_con.execute_command("GRAPH.QUERY", GRAPH_ID, "MATCH (a:person {v:3}), (b:person {v:1}) CREATE (a)-[:likes]->(b)")
+        redis_con.execute_command("GRAPH.QUERY", GRAPH_ID, "MATCH (a:person {v:1})-[e:knows]->(b:person {v:2}) DELETE e")
+
+        q = "MATCH (n:person) RETURN n.v, indegree(n), outdegree(n) ORDER BY n.v"
+        expected = [["1.000000", "2", "1"],
+                    ["2.000000", "1", "1"],
+                    ["3.000000", "1", "2"]]
+        self.assertEqual(self.query(q), expected)
+
+    # Relationships have no degree.
+    def test04_degree_of_relationship(self):
+        for f in ["indegree", "outdegree", "degree"]:
+            q = "MATCH (a:person)-[e:knows]->(b:person) RETURN %s(e)" % f
+            with self.assertRaises(redis.exceptions.ResponseError):
+                self.query(q)
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,90 @@
+import os
+import sys
+import unittest
+from redisgraph import Graph, Node, Edge
+
+import redis
+from .disposableredis import DisposableRedis
+
+from base import FlowTestsBase
+
+GRAPH_ID = "edge_index"
+redis_con = None
+
+def disposable_redis():
+    return DisposableRedis(loadmodule=os.path.dirname(os.path.abspath(__file__)) + '/../../src/redisgraph.so')
+
+class EdgeIndexFlowTest(FlowTestsBase):
+    @classmethod
+    def setUpClass(cls):
+        print "EdgeIndexFlowTest"
+        global redis_con
+        cls.r = disposable_redis()
+        cls.r.start()
+        redis_con = cls.r.client()
+
+        # 10 accounts, each transferring to the next, amount is 10 times the sender's ID.
+        redis_graph = Graph(GRAPH_ID, redis_con)
+        accounts = [Node(label="account", properties={"id": i}) for i in range(10)]
+        for a in accounts:
+            redis_graph.add_node(a)
+        for i, a in enumerate(accounts):
+            redis_graph.add_edge(Edge(a, "transfer", accounts[(i + 1) % 10], properties={"amount": i * 10}))
+        redis_graph.commit()
+
+    @classmethod
+    def tearDownClass(cls):
+        cls.r.stop()
+
+    def query(self, q):
+        return redis_con.execute_command("GRAPH.QUERY", GRAPH_ID, q)[0]
+
+    def explain(self, q):
+        return redis_con.execute_command("GRAPH.EXPLAIN", GRAPH_ID, q)
+
+    # Filters on an indexed relationship property are resolved by the index.
+    def test01_edge_index_scan(self):
+        q = """MATCH (a)-[t:transfer]->(b) WHERE t.amount >= 70 RETURN a.id, t.amount, b.id ORDER BY t.amount"""
+        self.assertNotIn("Edge Index Scan", self.explain(q))
+        expected = self.query(q)
+
+        self.query("CREATE INDEX ON :transfer(amount)")
+        plan = self.explain(q)
+        self.assertIn("Edge Index Scan", plan)
+        self.assertNotIn("Conditional Traverse", plan)
+        self.assertNotIn("Filter", plan)
+
+        result = self.query(q)
+        self.assertEqual(result, expected)
+        self.assertEqual(result[1:], [["7.000000", "70.000000", "8.000000"],
+                                      ["8.000000", "80.000000", "9.000000"],
+                                      ["9.000000", "90.000000", "0.000000"]])
+
+    # Endpoints are bound according to the pattern's direction and labels.
+    def test02_edge_index_endpoints(self):
+        q = """MATCH (b:account)<-[t:transfer]-(a) WHERE t.amount = 30 RETURN a.id, b.id"""
+        self.assertIn("Edge Index Scan", self.explain(q))
+        self.assertEqual(self.query(q)[1:], [["3.000000", "4.000000"]])
+
+        q = """MATCH (a:missing)-[t:transfer]->(b) WHERE t.amount = 30 RETURN a.id, b.id"""
+        self.assertEqual(self.query(q)[1:], [])
+
+    # Dropping the index restores the traversal.
+    def test03_drop_edge_index(self):
+        self.query("DROP INDEX ON :transfer(amount)")
+        q = """MATCH (a)-[t:transfer]->(b) WHERE t.amount >= 70 RETURN count(t)"""
+        plan = self.explain(q)
+        self.assertNotIn("Edge Index Scan", plan)
+        self.assertIn("Conditional Traverse", plan)
+        self.assertEqual(self.query(q)[1:], [["3.000000"]])
+
+    # A node label sharing the relationship type's name takes precedence.
+    def test04_label_precedence(self):
+        self.query("CREATE (:transfer {amount: 1})")
+        self.query("CREATE INDEX ON :transfer(amount)")
+        q = """MATCH (a)-[t:transfer]->(b) WHERE t.amount >= 70 RETURN count(t)"""
+        self.assertNotIn("Edge Index Scan", self.explain(q))
+        self.assertIn("Index Scan", self.explain("MATCH (n:transfer) WHERE n.amount = 1 RETURN n"))
+
+if __name__ == '__main__':
+    unittest.main()
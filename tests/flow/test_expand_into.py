@@ -0,0 +1,107 @@
+import os
+import sys
+import unittest
+from redisgraph import Graph, Node, Edge
+
+import redis
+from .disposableredis import DisposableRedis
+
+from base import FlowTestsBase
+
+GRAPH_ID = "G"
+redis_con = None
+
+def disposable_redis():
+    return DisposableRedis(loadmodule=os.path.dirname(os.path.abspath(__file__)) + '/../../src/redisgraph.so')
+
+class ExpandIntoFlowTest(FlowTestsBase):
+    @classmethod
+    def setUpClass(cls):
+        print "ExpandIntoFlowTest"
+        global redis_con
+        cls.r = disposable_redis()
+        cls.r.start()
+        redis_con = cls.r.client()
+
+        # Triangle 1->2->3->1, a tail 2->4->5, a self loop on 1
+        # and a second relationship type closing the triangle 3-[:q]->1.
+        redis_graph = Graph(GRAPH_ID, redis_con)
+        nodes = {}
+        for v in range(1, 6):
+            nodes[v] = Node(label="N", properties={"v": v})
+            redis_graph.add_node(nodes[v])
+        for src, dest in [(1, 2), (2, 3), (3, 1), (2, 4), (4, 5), (1, 1)]:
+            redis_graph.add_edge(Edge(nodes[src], "r", nodes[dest]))
+        redis_graph.add_edge(Edge(nodes[3], "q", nodes[1], properties={"w": 9}))
+        redis_graph.commit()
+
+    @classmethod
+    def tearDownClass(cls):
+        cls.r.stop()
+
+    def query(self, q):
+        return sorted(redis_con.execute_command("GRAPH.QUERY", GRAPH_ID, q)[0][1:])
+
+    def plan(self, q):
+        return redis_con.execute_command("GRAPH.EXPLAIN", GRAPH_ID, q)
+
+    # Closing a cycle checks connectivity rather than expanding the last node.
+    def test01_cycle(self):
+        q = "MATCH (a)-[:r]->(b)-[:r]->(c)-[:r]->(a) RETURN a.v, b.v, c.v"
+        self.assertIn("Expand Into", self.plan(q))
+        expected = [["1.000000", "1.000000", "1.000000"],
+                    ["1.000000", "2.000000", "3.000000"],
+                    ["2.000000", "3.000000", "1.000000"],
+                    ["3.000000", "1.000000", "2.000000"]]
+        self.assertEqual(self.query(q), expected)
+
+    # There are no cycles of length 2, other than the self loop.
+    def test02_no_cycle(self):
+        q = "MATCH (a)-[:r]->(b)-[:r]->(a) RETURN a.v, b.v"
+        self.assertEqual(self.query(q), [["1.000000", "1.000000"]])
+
+    def test03_self_loop(self):
+        q = "MATCH (a)-[:r]->(a) RETURN a.v"
+        self.assertIn("Expand Into", self.plan(q))
+        self.assertEqual(self.query(q), [["1.000000"]])
+
+    # A record is produced for each edge connecting the closing pair.
+    def test04_referenced_edge(self):
+        q = "MATCH (a:N)-[:r]->(b:N)-[:r]->(c:N)-[e]->(a) WHERE a.v != c.v RETURN a.v, c.v, e.w"
+        expected = [["1.000000", "3.000000", None],
+                    ["1.000000", "3.000000", "9.000000"],
+                    ["2.000000", "1.000000", None],
+                    ["3.000000", "2.000000", None]]
+        self.assertEqual(self.query(q), expected)
+
+    # Dense cycles intersect the traversal with the closing relation
+    # rather than checking connectivity per path.
+    def test05_dense_cycle(self):
+        # Complete directed graph over 8 nodes, labeled K.
+        redis_graph = Graph("K", redis_con)
+        nodes = [Node(label="K", properties={"v": v}) for v in range(8)]
+        for n in nodes:
+            redis_graph.add_node(n)
+        for src in nodes:
+            for dest in nodes:
+                if src != dest:
+                    redis_graph.add_edge(Edge(src, "r", dest))
+        redis_graph.commit()
+
+        q = "MATCH (a)-[:r]->(b)-[:r]->(c)-[:r]->(a) RETURN a.v, b.v, c.v"
+        plan = redis_con.execute_command("GRAPH.EXPLAIN", "K", q)
+        self.assertIn("Conditional Traverse Into", plan)
+        self.assertNotIn("Expand Into", plan)
+
+        result = redis_con.execute_command("GRAPH.QUERY", "K", q)[0][1:]
+        # Every ordered triple of distinct nodes forms a cycle.
+        self.assertEqual(len(result), 8 * 7 * 6)
+        for a, b, c in result:
+            self.assertEqual(len(set([a, b, c])), 3)
+
+        q = "MATCH (a)-[:r]->(b)-[:r]->(c)<-[:r]-(a) WHERE a.v = 0 RETURN b.v, c.v"
+        result = redis_con.execute_command("GRAPH.QUERY", "K", q)[0][1:]
+        self.assertEqual(len(result), 7 * 6)
+
+if __name__ == '__main__':
+    unittest.main()
@@ -1,5 +1,6 @@
 import os
 import sys
+import time
 import unittest
 from redisgraph import Graph, Node, Edge
 
@@ -137,5 +138,30 @@ class GraphDeletionFlowTest(FlowTestsBase):
         except:
             pass
 
+    # Deleted graph memory should be reclaimed in the background.
+    def test09_lazyfree_deleted_graph(self):
+        redis_con = self.r.client()
+
+        def lazyfree_stats():
+            info = redis_con.execute_command("GRAPH.INFO")
+            return dict(zip(info[0::2], info[1::2]))
+
+        # Counters are process wide, compare against their current values.
+        before = lazyfree_stats()
+
+        graph = Graph("lazyfree", redis_con)
+        graph.query("CREATE (:person {name:'a'})-[:knows]->(:person {name:'b'})")
+        graph.delete()
+
+        for _ in range(100):
+            stats = lazyfree_stats()
+            if stats["lazyfree_freed_graphs"] > before["lazyfree_freed_graphs"]:
+                break
+            time.sleep(0.1)
+
+        assert(stats["lazyfree_freed_graphs"] == before["lazyfree_freed_graphs"] + 1)
+        assert(stats["lazyfree_freed_entities"] > before["lazyfree_freed_entities"])
+        assert(stats["lazyfree_reclaimed_bytes"] > before["lazyfree_reclaimed_bytes"])
+
 if __name__ == '__main__':
     unittest.main()
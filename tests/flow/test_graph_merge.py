@@ -105,5 +105,43 @@ class GraphMergeFlowTest(FlowTestsBase):
         assert(result.properties_set == 0)
         assert(result.relationships_created == 0)
 
+    # Merge resolves the pattern through an index, which tracks the nodes merge creates.
+    def test09_merge_through_index(self):
+        global redis_graph
+        redis_graph.query("CREATE (:USER {id: 1})")
+        redis_graph.query("CREATE INDEX ON :USER(id)")
+
+        query = """MERGE (u:USER {id: 42})"""
+        plan = redis_graph.execution_plan(query)
+        assert("Index Scan" in plan)
+        assert("Filter" not in plan)
+
+        result = redis_graph.query(query)
+        assert(result.nodes_created == 1)
+        result = redis_graph.query(query)
+        assert(result.nodes_created == 0)
+
+        result = redis_graph.query("""MATCH (u:USER {id: 42}) RETURN count(u)""")
+        assert(result.result_set[1][0] == "1.000000")
+
+    # Deleted and updated nodes no longer match their previous value through the index.
+    def test10_merge_after_delete_and_set(self):
+        global redis_graph
+        result = redis_graph.query("""MATCH (u:USER {id: 42}) DELETE u""")
+        assert(result.nodes_deleted == 1)
+
+        result = redis_graph.query("""MERGE (u:USER {id: 42})""")
+        assert(result.nodes_created == 1)
+        result = redis_graph.query("""MATCH (u:USER {id: 42}) RETURN count(u)""")
+        assert(result.result_set[1][0] == "1.000000")
+
+        result = redis_graph.query("""MATCH (u:USER {id: 42}) SET u.id = 43""")
+        assert(result.properties_set == 1)
+
+        result = redis_graph.query("""MERGE (u:USER {id: 43})""")
+        assert(result.nodes_created == 0)
+        result = redis_graph.query("""MERGE (u:USER {id: 42})""")
+        assert(result.nodes_created == 1)
+
 if __name__ == '__main__':
     unittest.main()
@@ -9,6 +9,7 @@ from .disposableredis import DisposableRedis
 from base import FlowTestsBase
 
 redis_graph = None
+redis_con = None
 
 def redis():
     return DisposableRedis(loadmodule=os.path.dirname(os.path.abspath(__file__)) + '/../../src/redisgraph.so')
@@ -18,6 +19,7 @@ class GraphMultiPatternQueryFlowTest(FlowTestsBase):
     def setUpClass(cls):
         print "GraphMultiPatternQueryFlowTest"
         global redis_graph
+        global redis_con
         cls.r = redis()
         cls.r.start()
         redis_con = cls.r.client()
@@ -87,5 +89,40 @@ class GraphMultiPatternQueryFlowTest(FlowTestsBase):
         except Exception, e:
             assert("may not be referenced in multiple patterns") in e.message
 
+    # Equality between patterns is evaluated by a hash join.
+    def test07_hash_join(self):
+        query = """MATCH(a:person), (b:person) WHERE a.name = b.name RETURN a.name, b.name"""
+        plan = redis_con.execute_command("GRAPH.EXPLAIN", "G", query)
+        assert("Hash Join" in plan)
+        assert("Cartesian Product" not in plan)
+
+        actual_result = redis_graph.query(query)
+        # Header and a record per person.
+        assert(len(actual_result.result_set) == 8)
+        for record in actual_result.result_set[1:]:
+            assert(record[0] == record[1])
+
+    # Hash join result matches cartesian product followed by a filter.
+    def test08_hash_join_multiple_patterns(self):
+        join = """MATCH(a:person), (b:person)-[:friend]->(c:person) WHERE a.name = c.name RETURN count(b)"""
+        product = """MATCH(a:person), (b:person)-[:friend]->(c:person) WHERE a.name >= c.name AND a.name <= c.name RETURN count(b)"""
+        join_result = redis_graph.query(join)
+        product_result = redis_graph.query(product)
+        assert(join_result.result_set == product_result.result_set)
+        assert(int(float(join_result.result_set[1][0])) == 42)
+
+    # Streams are ordered by their estimated size, traversal streams are rescanned.
+    def test09_cartesian_product_stream_order(self):
+        query = """MATCH(a:person)-[:friend]->(b:person), (c:person) WHERE c.name != "Roi" RETURN count(c)"""
+        plan = redis_con.execute_command("GRAPH.EXPLAIN", "G", query)
+        assert("Estimated records" in plan)
+
+        actual_result = redis_graph.query(query)
+        assert(int(float(actual_result.result_set[1][0])) == 252)
+
+        query = """MATCH(c:person), (a:person)-[:friend]->(b:person) WHERE c.name != "Roi" RETURN count(c)"""
+        actual_result = redis_graph.query(query)
+        assert(int(float(actual_result.result_set[1][0])) == 252)
+
 if __name__ == '__main__':
     unittest.main()
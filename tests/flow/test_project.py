@@ -0,0 +1,102 @@
+import os
+import sys
+import unittest
+from redisgraph import Graph, Node, Edge
+
+import redis
+from .disposableredis import DisposableRedis
+from base import FlowTestsBase
+
+GRAPH_ID = "G"
+PROJECTION_ID = "P"
+redis_con = None
+
+def disposable_redis():
+    return DisposableRedis(loadmodule=os.path.dirname(os.path.abspath(__file__)) + '/../../src/redisgraph.so')
+
+class ProjectFlowTest(FlowTestsBase):
+    @classmethod
+    def setUpClass(cls):
+        print "ProjectFlowTest"
+        global redis_con
+        cls.r = disposable_redis()
+        cls.r.start()
+        redis_con = cls.r.client()
+
+        # person 0->1->2->0 by knows, person 0 -[:owns]-> dog 3.
+        redis_graph = Graph(GRAPH_ID, redis_con)
+        nodes = [Node(label="person", properties={"name": name}) for name in ["a", "b", "c"]]
+        nodes.append(Node(label="dog", properties={"name": "d"}))
+        for n in nodes:
+            redis_graph.add_node(n)
+        for src, dest in [(0, 1), (1, 2), (2, 0)]:
+            redis_graph.add_edge(Edge(nodes[src], "knows", nodes[dest], properties={"since": src}))
+        redis_graph.add_edge(Edge(nodes[0], "owns", nodes[3]))
+        redis_graph.commit()
+        redis_con.execute_command("GRAPH.QUERY", GRAPH_ID, "CREATE INDEX ON :person(name)")
+
+    @classmethod
+    def tearDownClass(cls):
+        cls.r.stop()
+
+    def project(self, *args):
+        return redis_con.execute_command("GRAPH.PROJECT", GRAPH_ID, PROJECTION_ID, *args)
+
+    def test01_project(self):
+        result = self.project("LABELS", "person", "RELATIONS", "knows")
+        self.assertEqual(result, "3 Nodes projected, 3 Edges projected")
+
+        projection = Graph(PROJECTION_ID, redis_con)
+        query = """MATCH (a:person)-[e:knows]->(b:person) RETURN a.name, e.since, b.name ORDER BY e.since"""
+        result = projection.query(query)
+        self.assertEqual(result.result_set[1:], [['a', '0.000000', 'b'],
+                                                 ['b', '1.000000', 'c'],
+                                                 ['c', '2.000000', 'a']])
+
+        # Projected label index is rebuilt.
+        plan = redis_con.execute_command("GRAPH.EXPLAIN", PROJECTION_ID, "MATCH (p:person) WHERE p.name = 'a' RETURN p")
+        self.assertIn("Index Scan", plan)
+
+    def test02_read_only(self):
+        projection = Graph(PROJECTION_ID, redis_con)
+        with self.assertRaises(redis.exceptions.ResponseError):
+            projection.query("CREATE (:person {name:'e'})")
+        with self.assertRaises(redis.exceptions.ResponseError):
+            redis_con.execute_command("GRAPH.ALGO", PROJECTION_ID, "PAGERANK", "WRITE", "rank")
+
+        # Reading queries and algorithms are served.
+        result = projection.query("MATCH (p) RETURN count(p)")
+        self.assertEqual(int(float(result.result_set[1][0])), 3)
+        result = redis_con.execute_command("GRAPH.ALGO", PROJECTION_ID, "WCC")
+        self.assertEqual([component for _, component in result], [0, 0, 0])
+
+    def test03_snapshot(self):
+        # Modifications to the source graph don't affect the projection.
+        redis_graph = Graph(GRAPH_ID, redis_con)
+        redis_graph.query("MATCH (a:person {name:'a'}), (b:person {name:'b'}) CREATE (b)-[:knows]->(a)")
+        projection = Graph(PROJECTION_ID, redis_con)
+        result = projection.query("MATCH ()-[e]->() RETURN count(e)")
+        self.assertEqual(int(float(result.result_set[1][0])), 3)
+
+    def test04_errors(self):
+        # Projection key already exists.
+        with self.assertRaises(redis.exceptions.ResponseError):
+            self.project("LABELS", "person")
+        with self.assertRaises(redis.exceptions.ResponseError):
+            redis_con.execute_command("GRAPH.PROJECT", GRAPH_ID, "Q", "LABELS", "cat")
+        with self.assertRaises(redis.exceptions.ResponseError):
+            redis_con.execute_command("GRAPH.PROJECT", GRAPH_ID, "Q", "RELATIONS", "likes")
+        with self.assertRaises(redis.exceptions.ResponseError):
+            redis_con.execute_command("GRAPH.PROJECT", GRAPH_ID, "Q", "WHERE", "x")
+        self.assertFalse(redis_con.exists("Q"))
+
+    def test05_delete(self):
+        redis_con.execute_command("GRAPH.DELETE", PROJECTION_ID)
+        self.assertFalse(redis_con.exists(PROJECTION_ID))
+
+        # Entire graph is projected when no labels or relationship types are given.
+        result = self.project()
+        self.assertEqual(result, "4 Nodes projected, 5 Edges projected")
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,104 @@
+import os
+import sys
+import unittest
+from redisgraph import Graph, Node, Edge
+
+import redis
+from .disposableredis import DisposableRedis
+
+from base import FlowTestsBase
+
+GRAPH_ID = "G"
+redis_con = None
+
+def disposable_redis():
+    return DisposableRedis(loadmodule=os.path.dirname(os.path.abspath(__file__)) + '/../../src/redisgraph.so')
+
+def info():
+    reply = redis_con.execute_command("GRAPH.INFO")
+    return dict(zip(reply[0::2], reply[1::2]))
+
+class QueryParamsFlowTest(FlowTestsBase):
+    @classmethod
+    def setUpClass(cls):
+        print "QueryParamsFlowTest"
+        global redis_con
+        cls.r = disposable_redis()
+        cls.r.start()
+        redis_con = cls.r.client()
+
+        redis_graph = Graph(GRAPH_ID, redis_con)
+        for name, age in [("Roi", 34), ("Alon", 32), ("Ailon", 33)]:
+            redis_graph.add_node(Node(label="person", properties={"name": name, "age": age}))
+        redis_graph.commit()
+
+    @classmethod
+    def tearDownClass(cls):
+        cls.r.stop()
+
+    def query(self, q, *params):
+        # Drop execution time from result.
+        return redis_con.execute_command("GRAPH.QUERY", GRAPH_ID, q, *params)[0]
+
+    # Parameterized query returns the same result as its literal counterpart.
+    def test01_bind_parameters(self):
+        expected = self.query("MATCH (p:person {name: 'Roi'}) WHERE p.age > 30 RETURN p.name, p.age")
+        actual = self.query("MATCH (p:person {name: $name}) WHERE p.age > $age RETURN p.name, p.age",
+                            "name", "'Roi'", "age", "30")
+        self.assertEqual(actual, expected)
+
+    # Cached query is rebound on every call.
+    def test02_rebind_parameters(self):
+        q = "MATCH (p:person) WHERE p.name = $name RETURN p.age"
+        for name in ["Roi", "Alon", "Ailon", "Roi"]:
+            expected = self.query("MATCH (p:person) WHERE p.name = '%s' RETURN p.age" % name)
+            actual = self.query(q, "name", "'%s'" % name)
+            self.assertEqual(actual, expected)
+
+        # All but the first call were served from cache.
+        self.assertGreaterEqual(info()["query_cache_hits"], 3)
+
+    def test03_create_with_parameters(self):
+        q = "CREATE (:person {name: $name, age: $age})"
+        self.query(q, "name", "'Tal'", "age", "28")
+        self.query(q, "name", "'Omri'", "age", "29")
+
+        actual = self.query("MATCH (p:person) WHERE p.age < $age RETURN p.name ORDER BY p.name", "age", "30")
+        expected = self.query("MATCH (p:person) WHERE p.age < 30 RETURN p.name ORDER BY p.name")
+        self.assertEqual(actual, expected)
+        self.assertEqual(len(actual), 3)    # Header and two records.
+
+    # Cached query observes schema modifications.
+    def test04_schema_change(self):
+        q = "MATCH (p:person) WHERE p.name = $name RETURN p"
+        before = self.query(q, "name", "'Roi'")
+        self.query("MATCH (p:person) WHERE p.name = 'Roi' SET p.height = 180")
+        after = self.query(q, "name", "'Roi'")
+        # Collapsed node is expanded to include the new property.
+        self.assertEqual(len(after[0]), len(before[0]) + 1)
+
+    def test05_missing_parameter(self):
+        try:
+            self.query("MATCH (p:person) WHERE p.name = $name RETURN p")
+            assert(False)
+        except redis.exceptions.ResponseError:
+            # Expecting an error.
+            pass
+
+    def test06_invalid_parameters(self):
+        try:
+            # Parameters must come in pairs.
+            self.query("MATCH (p:person) WHERE p.name = $name RETURN p", "name")
+            assert(False)
+        except redis.exceptions.ResponseError:
+            pass
+
+        try:
+            # Strings must be quoted.
+            self.query("MATCH (p:person) WHERE p.name = $name RETURN p", "name", "Roi")
+            assert(False)
+        except redis.exceptions.ResponseError:
+            pass
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,92 @@
+import os
+import sys
+import unittest
+from redisgraph import Graph, Node, Edge
+
+import redis
+from .disposableredis import DisposableRedis
+
+from base import FlowTestsBase
+
+GRAPH_ID = "string_predicates"
+redis_con = None
+
+def disposable_redis():
+    return DisposableRedis(loadmodule=os.path.dirname(os.path.abspath(__file__)) + '/../../src/redisgraph.so')
+
+class StringPredicatesFlowTest(FlowTestsBase):
+    @classmethod
+    def setUpClass(cls):
+        print "StringPredicatesFlowTest"
+        global redis_con
+        cls.r = disposable_redis()
+        cls.r.start()
+        redis_con = cls.r.client()
+
+        redis_graph = Graph(GRAPH_ID, redis_con)
+        names = ["apple", "apple pie", "applesauce", "banana", "bandana", "cherry pie", "pineapple"]
+        for name in names:
+            redis_graph.add_node(Node(label="product", properties={"name": name}))
+        redis_graph.commit()
+
+    @classmethod
+    def tearDownClass(cls):
+        cls.r.stop()
+
+    def query(self, q):
+        return redis_con.execute_command("GRAPH.QUERY", GRAPH_ID, q)[0]
+
+    def explain(self, q):
+        return redis_con.execute_command("GRAPH.EXPLAIN", GRAPH_ID, q)
+
+    def names(self, predicate):
+        q = "MATCH (p:product) WHERE %s RETURN p.name ORDER BY p.name" % predicate
+        return [row[0] for row in self.query(q)[1:]]
+
+    def assert_predicates(self):
+        self.assertEqual(self.names("p.name STARTS WITH 'app'"), ["apple", "apple pie", "applesauce"])
+        self.assertEqual(self.names("p.name ENDS WITH 'pie'"), ["apple pie", "cherry pie"])
+        self.assertEqual(self.names("p.name CONTAINS 'ana'"), ["banana", "bandana"])
+        self.assertEqual(self.names("p.name contains 'an'"), ["banana", "bandana"])
+        self.assertEqual(self.names("p.name CONTAINS 'apple' AND p.name ENDS WITH 'ple'"), ["apple", "pineapple"])
+        self.assertEqual(self.names("p.name CONTAINS 'xyz'"), [])
+
+    # String predicates are evaluated by filters.
+    def test01_string_predicates(self):
+        self.assert_predicates()
+
+    # Indexed properties serve STARTS WITH, substrings require trigrams.
+    def test02_indexed_string_predicates(self):
+        self.query("CREATE INDEX ON :product(name)")
+
+        plan = self.explain("MATCH (p:product) WHERE p.name STARTS WITH 'app' RETURN p")
+        self.assertIn("Index Scan", plan)
+        self.assertNotIn("Filter", plan)
+
+        plan = self.explain("MATCH (p:product) WHERE p.name CONTAINS 'ana' RETURN p")
+        self.assertNotIn("Index Scan", plan)
+
+        self.assert_predicates()
+
+    # Trigram indices serve CONTAINS and ENDS WITH.
+    def test03_trigram_string_predicates(self):
+        self.query("DROP INDEX ON :product(name)")
+        self.query("CREATE INDEX ON :product(name) TRIGRAM")
+
+        plan = self.explain("MATCH (p:product) WHERE p.name STARTS WITH 'app' RETURN p")
+        self.assertIn("Index Scan", plan)
+        self.assertNotIn("Filter", plan)
+
+        # Trigram candidates are still filtered.
+        plan = self.explain("MATCH (p:product) WHERE p.name CONTAINS 'ana' RETURN p")
+        self.assertIn("Index Scan", plan)
+        self.assertIn("Filter", plan)
+
+        # Substrings shorter than a trigram can't be looked up.
+        plan = self.explain("MATCH (p:product) WHERE p.name CONTAINS 'an' RETURN p")
+        self.assertNotIn("Index Scan", plan)
+
+        self.assert_predicates()
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,89 @@
+import os
+import sys
+import unittest
+from redisgraph import Graph, Node, Edge
+
+import redis
+from .disposableredis import DisposableRedis
+
+from base import FlowTestsBase
+
+GRAPH_ID = "G"
+redis_con = None
+
+def disposable_redis():
+    return DisposableRedis(loadmodule=os.path.dirname(os.path.abspath(__file__)) + '/../../src/redisgraph.so')
+
+class TraverseOrderFlowTest(FlowTestsBase):
+    @classmethod
+    def setUpClass(cls):
+        print "TraverseOrderFlowTest"
+        global redis_con
+        cls.r = disposable_redis()
+        cls.r.start()
+        redis_con = cls.r.client()
+
+        # 3 chains of the form (:A)->(:B)->(:C)->(:D)->(:E)->(:F), 'C' is the least populated label.
+        redis_graph = Graph(GRAPH_ID, redis_con)
+        labels = ["A", "B", "C", "D", "E", "F"]
+        for v in range(3):
+            chain = [Node(label=l, properties={"v": v}) for l in labels]
+            for n in chain:
+                redis_graph.add_node(n)
+            for src, dest in zip(chain, chain[1:]):
+                redis_graph.add_edge(Edge(src, "r", dest))
+        for v in range(3, 20):
+            for l in labels:
+                if l != "C":
+                    redis_graph.add_node(Node(label=l, properties={"v": v}))
+        redis_graph.commit()
+
+    @classmethod
+    def tearDownClass(cls):
+        cls.r.stop()
+
+    def query(self, q):
+        return redis_con.execute_command("GRAPH.QUERY", GRAPH_ID, q)[0]
+
+    # Traversal begins at an intermediate node, when it is the cheapest to scan.
+    def test01_intermediate_entry_point(self):
+        q = """MATCH (a:A)-[:r]->(b:B)-[:r]->(c:C)-[:r]->(d:D)-[:r]->(e:E)-[:r]->(f:F)
+               WHERE c.v = 1 RETURN a.v, b.v, c.v, d.v, e.v, f.v"""
+        plan = redis_con.execute_command("GRAPH.EXPLAIN", GRAPH_ID, q)
+        ops = [line.split("|")[0].strip() for line in plan.split("\n") if line.strip()]
+        # Scan C, filter it, then traverse in both directions.
+        self.assertEqual(ops[-1], "Node By Label Scan")
+        self.assertEqual(ops[-2], "Filter")
+        self.assertEqual(ops.count("Conditional Traverse"), 5)
+
+        result = self.query(q)
+        self.assertEqual(result[1:], [["1.000000"] * 6])
+
+    # Entering at an intermediate node produces the same records as entering at either end.
+    def test02_intermediate_entry_point_results(self):
+        q = """MATCH (a:A)-[:r]->(b:B)-[:r]->(c:C)-[:r]->(d:D)-[:r]->(e:E)-[:r]->(f:F)
+               RETURN a.v, b.v, c.v, d.v, e.v, f.v"""
+        result = self.query(q)
+        expected = [[("%d.000000" % v)] * 6 for v in range(3)]
+        self.assertEqual(sorted(result[1:]), expected)
+
+    # Traversals from an index range expand all indexed nodes at once.
+    def test03_index_traverse(self):
+        self.query("CREATE INDEX ON :C(v)")
+
+        q = """MATCH (c:C)-[:r]->(d:D) WHERE c.v > 0 RETURN c.v, d.v"""
+        plan = redis_con.execute_command("GRAPH.EXPLAIN", GRAPH_ID, q)
+        self.assertIn("Index Traverse", plan)
+        self.assertNotIn("Index Scan", plan)
+        result = self.query(q)
+        self.assertEqual(sorted(result[1:]), [["1.000000", "1.000000"], ["2.000000", "2.000000"]])
+
+        # Traverse against relationship direction.
+        q = """MATCH (b:B)-[e:r]->(c:C) WHERE c.v <= 1 RETURN b.v, c.v"""
+        result = self.query(q)
+        self.assertEqual(sorted(result[1:]), [["0.000000", "0.000000"], ["1.000000", "1.000000"]])
+
+        self.query("DROP INDEX ON :C(v)")
+
+if __name__ == '__main__':
+    unittest.main()
@@ -170,3 +170,17 @@ TEST_F(AggregateTest, StDevTest) {
 
 }
 
+
+TEST_F(AggregateTest, CountAddTest) {
+  AR_ExpNode *count = AR_EXP_NewOpNode("count", 1);
+  count->op.children[0] = AR_EXP_NewConstOperandNode(SI_DoubleVal(1));
+
+  // Adding to a count is equivalent to stepping it.
+  AR_EXP_Aggregate(count, r);
+  Agg_CountAdd(count->op.agg_func, 41);
+  AR_EXP_Reduce(count);
+  SIValue result = AR_EXP_Evaluate(count, r);
+
+  EXPECT_EQ(result.doubleval, 42);
+  AR_EXP_Free(count);
+}
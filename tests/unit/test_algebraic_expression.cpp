@@ -18,6 +18,7 @@ extern "C" {
 #include "../../src/graph/query_graph.h"
 #include "../../src/util/simple_timer.h"
 #include "../../src/arithmetic/algebraic_expression.h"
+#include "../../src/GraphBLASExt/tuples_iter.h"
 #include "../../src/util/rmalloc.h"
 
 #ifdef __cplusplus
@@ -525,3 +526,57 @@ TEST_F(AlgebraicExpressionTest, ExpressionExecute) {
     GrB_Matrix_free(&expected);
     GrB_Matrix_free(&M);
 }
+
+TEST_F(AlgebraicExpressionTest, ExpressionExecuteEdgeIDs) {
+    const char *query = query_return_intermidate_edge;
+    AST_Query *ast = ParseQuery(query, strlen(query), NULL);
+    size_t exp_count = 0;
+    AlgebraicExpression **ae = AlgebraicExpression_From_Query(ast, ast->matchNode->_mergedPatterns, query_graph, &exp_count);
+    EXPECT_EQ(exp_count, 3);
+
+    // Expressions without a typed edge do not carry edge IDs.
+    AlgebraicExpressionResult *res = AlgebraicExpression_Execute(ae[0]);
+    EXPECT_FALSE(res->edge_ids);
+    AlgebraicExpressionResult_Free(res);
+
+    // Filter visit relation by its source nodes, similar to conditional traverse.
+    AlgebraicExpression *exp = ae[1];
+    GrB_Matrix visit = exp->edge->mat;
+    GrB_Index dim = Graph_RequiredMatrixDim(g);
+    GrB_Matrix F;
+    GrB_Matrix_new(&F, GrB_BOOL, dim, dim);
+    GrB_Matrix_setElement_BOOL(F, true, 0, 0);
+    GrB_Matrix_setElement_BOOL(F, true, 2, 2);
+    AlgebraicExpression_AppendTerm(exp, F, false, true);
+
+    res = AlgebraicExpression_Execute(exp);
+    EXPECT_TRUE(res->edge_ids);
+
+    GrB_Type t;
+    GxB_Matrix_type(&t, res->m);
+    EXPECT_EQ(t, GrB_UINT64);
+
+    // Nodes 0 and 2 have 2 and 3 outgoing visit edges respectively.
+    GrB_Index nvals;
+    GrB_Matrix_nvals(&nvals, res->m);
+    EXPECT_EQ(nvals, 5);
+
+    // Each entry holds the ID of the edge connecting its column to its row.
+    GrB_Index row;
+    GrB_Index col;
+    EdgeID edge_id;
+    TuplesIter *it = TuplesIter_new(res->m);
+    while(TuplesIter_next_UINT64(it, &row, &col, &edge_id) != TuplesIter_DEPLETED) {
+        EXPECT_TRUE(col == 0 || col == 2);
+        EdgeID expected_id;
+        EXPECT_EQ(GrB_Matrix_extractElement_UINT64(&expected_id, visit, row, col), GrB_SUCCESS);
+        EXPECT_EQ(edge_id, expected_id);
+    }
+
+    // Clean up.
+    TuplesIter_free(it);
+    AlgebraicExpressionResult_Free(res);
+    Free_AST_Query(ast);
+    for(int i = 0; i < exp_count; i++) AlgebraicExpression_Free(ae[i]);
+    free(ae);
+}
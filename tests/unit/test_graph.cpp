@@ -118,11 +118,11 @@ class GraphTest : public ::testing::Test
             EXPECT_EQ(GrB_Matrix_extractElement_BOOL(&v, adj, dest_id, src_id), GrB_SUCCESS);
             EXPECT_TRUE(v);
 
-            // Test relation matrix.
-            v = false;
+            // Test relation matrix, entry holds edge ID.
+            EdgeID edge_id;
             GrB_Matrix mat = Graph_GetRelationMatrix(g, r);
-            EXPECT_EQ(GrB_Matrix_extractElement_BOOL(&v, mat, dest_id, src_id), GrB_SUCCESS);
-            EXPECT_TRUE(v);
+            EXPECT_EQ(GrB_Matrix_extractElement_UINT64(&edge_id, mat, dest_id, src_id), GrB_SUCCESS);
+            EXPECT_EQ(edge_id, i);
         }
     }
 
@@ -641,6 +641,129 @@ TEST_F(GraphTest, RemoveEdges)
     Graph_Free(g);
 }
 
+TEST_F(GraphTest, BulkDelete)
+{
+    Node n;
+    Edge e;
+    GrB_Index nnz;
+    Graph *g = Graph_New(32, 32);
+    Graph_AcquireWriteLock(g);
+    int label = Graph_AddLabel(g);
+    int friends = Graph_AddRelationType(g);
+    int visits = Graph_AddRelationType(g);
+    for(int i = 0; i < 6; i++) Graph_CreateNode(g, label, &n);
+
+    /* Connections:
+     * 0 -friends-> 1, 0 -visits-> 1
+     * 1 -friends-> 2
+     * 2 -friends-> 3
+     * 3 -friends-> 4, 4 -friends-> 3
+     * 4 -friends-> 5 */
+    Edge explicit_edges[4];
+    Graph_ConnectNodes(g, 0, 1, friends, &explicit_edges[0]);
+    Graph_ConnectNodes(g, 0, 1, visits, &e);
+    Graph_ConnectNodes(g, 1, 2, friends, &explicit_edges[1]);
+    Graph_ConnectNodes(g, 2, 3, friends, &e);
+    Graph_ConnectNodes(g, 3, 4, friends, &e);
+    Graph_ConnectNodes(g, 4, 3, friends, &explicit_edges[2]);
+    Graph_ConnectNodes(g, 4, 5, friends, &e);
+    EXPECT_EQ(Graph_EdgeCount(g), 7);
+
+    // Edge 1->2 requested twice, edge 4->3 is attached to a deleted node.
+    explicit_edges[3] = explicit_edges[1];
+
+    // Delete nodes 3 and 4, node 3 requested twice.
+    Node nodes[3];
+    Graph_GetNode(g, 3, nodes);
+    Graph_GetNode(g, 4, nodes+1);
+    Graph_GetNode(g, 3, nodes+2);
+
+    size_t node_deleted;
+    size_t edge_deleted;
+    Graph_BulkDelete(g, nodes, 3, explicit_edges, 4, &node_deleted, &edge_deleted);
+    EXPECT_EQ(node_deleted, 2);
+    EXPECT_EQ(edge_deleted, 3);
+
+    // Only 0 -visits-> 1 remains.
+    EXPECT_EQ(Graph_NodeCount(g), 4);
+    EXPECT_EQ(Graph_EdgeCount(g), 1);
+
+    GrB_Matrix_nvals(&nnz, Graph_GetRelationMatrix(g, friends));
+    EXPECT_EQ(nnz, 0);
+    GrB_Matrix_nvals(&nnz, Graph_GetRelationMatrix(g, visits));
+    EXPECT_EQ(nnz, 1);
+
+    // Nodes 0 and 1 are still connected via visits.
+    bool x;
+    GrB_Matrix adj = Graph_GetAdjacencyMatrix(g);
+    GrB_Matrix_nvals(&nnz, adj);
+    EXPECT_EQ(nnz, 1);
+    EXPECT_EQ(GrB_Matrix_extractElement_BOOL(&x, adj, 1, 0), GrB_SUCCESS);
+
+    // Deleted nodes are removed from label matrix.
+    GrB_Matrix_nvals(&nnz, Graph_GetLabel(g, label));
+    EXPECT_EQ(nnz, 4);
+
+    // Statistics reflect deletions.
+    EXPECT_EQ(Graph_LabeledNodeCount(g, label), 4);
+    EXPECT_EQ(Graph_RelationEdgeCount(g, friends), 0);
+    EXPECT_EQ(Graph_RelationEdgeCount(g, visits), 1);
+
+    Graph_Free(g);
+}
+
+TEST_F(GraphTest, EntityCounts)
+{
+    /* Create a graph with labeled and unlabeled nodes,
+     * connected by multiple relation types,
+     * make sure per label and per relation counts are maintained. */
+
+    Node n;
+    Edge e;
+    Graph *g = Graph_New(16, 16);
+    Graph_AcquireWriteLock(g);
+    int person = Graph_AddLabel(g);
+    int city = Graph_AddLabel(g);
+    int friends = Graph_AddRelationType(g);
+    int visits = Graph_AddRelationType(g);
+
+    EXPECT_EQ(Graph_LabeledNodeCount(g, person), 0);
+    EXPECT_EQ(Graph_RelationEdgeCount(g, friends), 0);
+
+    for(int i = 0; i < 4; i++) Graph_CreateNode(g, person, &n);
+    for(int i = 0; i < 2; i++) Graph_CreateNode(g, city, &n);
+    Graph_CreateNode(g, GRAPH_NO_LABEL, &n);
+
+    EXPECT_EQ(Graph_LabeledNodeCount(g, person), 4);
+    EXPECT_EQ(Graph_LabeledNodeCount(g, city), 2);
+    EXPECT_EQ(Graph_LabeledNodeCount(g, GRAPH_NO_LABEL), 7);
+
+    Graph_ConnectNodes(g, 0, 1, friends, &e);
+    Graph_ConnectNodes(g, 1, 2, friends, &e);
+    Graph_ConnectNodes(g, 2, 3, friends, &e);
+    Graph_ConnectNodes(g, 0, 4, visits, &e);
+    Graph_ConnectNodes(g, 0, 5, visits, &e);
+
+    EXPECT_EQ(Graph_RelationEdgeCount(g, friends), 3);
+    EXPECT_EQ(Graph_RelationEdgeCount(g, visits), 2);
+    EXPECT_EQ(Graph_RelationEdgeCount(g, GRAPH_NO_RELATION), 5);
+
+    // Delete a person, removing its friends and visits edges.
+    Node nodes[1];
+    Graph_GetNode(g, 0, nodes);
+    size_t node_deleted;
+    size_t edge_deleted;
+    Graph_BulkDelete(g, nodes, 1, NULL, 0, &node_deleted, &edge_deleted);
+    EXPECT_EQ(node_deleted, 1);
+
+    EXPECT_EQ(Graph_LabeledNodeCount(g, person), 3);
+    EXPECT_EQ(Graph_LabeledNodeCount(g, city), 2);
+    EXPECT_EQ(Graph_RelationEdgeCount(g, friends), 2);
+    EXPECT_EQ(Graph_RelationEdgeCount(g, visits), 0);
+
+    Graph_Free(g);
+}
+
 TEST_F(GraphTest, GetNode)
 {
     /* Create a graph with nodeCount nodes,
@@ -776,3 +899,64 @@ TEST_F(GraphTest, GetEdge)
     array_free(edges);
     Graph_Free(g);
 }
+
+TEST_F(GraphTest, NodeDegree)
+{
+    Edge e;
+    Node n;
+    Graph *g = Graph_New(32, 32);
+    Graph_AcquireWriteLock(g);
+    for(int i = 0; i < 4; i++) Graph_CreateNode(g, GRAPH_NO_LABEL, &n);
+    int r0 = Graph_AddRelationType(g);
+    int r1 = Graph_AddRelationType(g);
+
+    /* Connections:
+     * 0 -r0-> 1
+     * 0 -r0-> 2
+     * 0 -r1-> 1
+     * 2 -r1-> 0
+     * 3 is isolated. */
+    Graph_ConnectNodes(g, 0, 1, r0, &e);
+    Graph_ConnectNodes(g, 0, 2, r0, &e);
+    Graph_ConnectNodes(g, 0, 1, r1, &e);
+    Graph_ConnectNodes(g, 2, 0, r1, &e);
+
+    EXPECT_EQ(Graph_GetNodeDegree(g, 0, GRAPH_EDGE_DIR_OUTGOING, GRAPH_NO_RELATION), 3);
+    EXPECT_EQ(Graph_GetNodeDegree(g, 0, GRAPH_EDGE_DIR_INCOMING, GRAPH_NO_RELATION), 1);
+    EXPECT_EQ(Graph_GetNodeDegree(g, 0, GRAPH_EDGE_DIR_BOTH, GRAPH_NO_RELATION), 4);
+    EXPECT_EQ(Graph_GetNodeDegree(g, 0, GRAPH_EDGE_DIR_OUTGOING, r0), 2);
+    EXPECT_EQ(Graph_GetNodeDegree(g, 0, GRAPH_EDGE_DIR_INCOMING, r0), 0);
+    EXPECT_EQ(Graph_GetNodeDegree(g, 1, GRAPH_EDGE_DIR_INCOMING, GRAPH_NO_RELATION), 2);
+    EXPECT_EQ(Graph_GetNodeDegree(g, 1, GRAPH_EDGE_DIR_INCOMING, r1), 1);
+    EXPECT_EQ(Graph_GetNodeDegree(g, 3, GRAPH_EDGE_DIR_BOTH, GRAPH_NO_RELATION), 0);
+
+    // Degree vector holds an entry for each connected node.
+    GrB_Index nvals;
+    uint64_t degree;
+    GrB_Vector v = Graph_GetDegreeVector(g, GRAPH_EDGE_DIR_OUTGOING, GRAPH_NO_RELATION);
+    GrB_Vector_nvals(&nvals, v);
+    EXPECT_EQ(nvals, 2);
+    GrB_Vector_extractElement_UINT64(&degree, v, 0);
+    EXPECT_EQ(degree, 3);
+    GrB_Vector_extractElement_UINT64(&degree, v, 2);
+    EXPECT_EQ(degree, 1);
+    GrB_Vector_free(&v);
+
+    // Deleting an edge updates both of its ends.
+    Edge *edges = (Edge *)array_new(Edge, 1);
+    Graph_GetEdgesConnectingNodes(g, 0, 2, r0, &edges);
+    ASSERT_EQ(array_len(edges), 1);
+    Graph_DeleteEdge(g, edges);
+    EXPECT_EQ(Graph_GetNodeDegree(g, 0, GRAPH_EDGE_DIR_OUTGOING, r0), 1);
+    EXPECT_EQ(Graph_GetNodeDegree(g, 2, GRAPH_EDGE_DIR_INCOMING, GRAPH_NO_RELATION), 0);
+
+    // Deleting a node removes its edges from its neighbours' degrees.
+    Graph_GetNode(g, 0, &n);
+    Graph_DeleteNode(g, &n);
+    for(NodeID id = 0; id < 4; id++) {
+        EXPECT_EQ(Graph_GetNodeDegree(g, id, GRAPH_EDGE_DIR_BOTH, GRAPH_NO_RELATION), 0);
+    }
+
+    array_free(edges);
+    Graph_Free(g);
+}
@@ -49,3 +49,72 @@ TEST_F(GxB_DeleteTest, GxB_Delete) {
     GrB_Matrix_nvals(&nvals, M);
     EXPECT_EQ(nvals, 0);
 }
+
+TEST_F(GxB_DeleteTest, GxB_Delete_Batch) {
+    // Create a 10X10 UINT64 matrix, M[i,j] = i*10+j.
+    GrB_Matrix M;
+    GrB_Matrix_new(&M, GrB_UINT64, 10, 10);
+    for(GrB_Index i = 0; i < 10; i++) {
+        for(GrB_Index j = 0; j < 10; j++) {
+            GrB_Matrix_setElement_UINT64(M, i*10+j, i, j);
+        }
+    }
+
+    // Clear the diagonal, including a duplicated and an already empty entry.
+    GrB_Index rows[11];
+    GrB_Index cols[11];
+    for(GrB_Index i = 0; i < 10; i++) {
+        rows[i] = i;
+        cols[i] = i;
+    }
+    rows[10] = 3;
+    cols[10] = 3;
+    EXPECT_EQ(GxB_Matrix_Delete_Batch(M, rows, cols, 11), GrB_SUCCESS);
+
+    GrB_Index nvals;
+    GrB_Matrix_nvals(&nvals, M);
+    EXPECT_EQ(nvals, 90);
+
+    // Remaining entries retain their values.
+    uint64_t x;
+    for(GrB_Index i = 0; i < 10; i++) {
+        for(GrB_Index j = 0; j < 10; j++) {
+            GrB_Info res = GrB_Matrix_extractElement_UINT64(&x, M, i, j);
+            if(i == j) {
+                EXPECT_EQ(res, GrB_NO_VALUE);
+            } else {
+                EXPECT_EQ(res, GrB_SUCCESS);
+                EXPECT_EQ(x, i*10+j);
+            }
+        }
+    }
+
+    GrB_Matrix_free(&M);
+}
+
+TEST_F(GxB_DeleteTest, GxB_Delete_RowsCols) {
+    // Create a full 10X10 matrix.
+    GrB_Matrix M;
+    GrB_Matrix_new(&M, GrB_BOOL, 10, 10);
+    for(GrB_Index i = 0; i < 10; i++) {
+        for(GrB_Index j = 0; j < 10; j++) {
+            GrB_Matrix_setElement_BOOL(M, true, i, j);
+        }
+    }
+
+    // Clear rows and columns 2 and 7.
+    GrB_Index I[2] = {2, 7};
+    EXPECT_EQ(GxB_Matrix_Delete_RowsCols(M, I, 2), GrB_SUCCESS);
+
+    GrB_Index nvals;
+    GrB_Matrix_nvals(&nvals, M);
+    EXPECT_EQ(nvals, 8*8);
+
+    bool x;
+    for(GrB_Index i = 0; i < 10; i++) {
+        EXPECT_EQ(GrB_Matrix_extractElement_BOOL(&x, M, 2, i), GrB_NO_VALUE);
+        EXPECT_EQ(GrB_Matrix_extractElement_BOOL(&x, M, i, 7), GrB_NO_VALUE);
+    }
+
+    GrB_Matrix_free(&M);
+}
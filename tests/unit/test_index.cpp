@@ -86,7 +86,7 @@ class IndexTest: public ::testing::Test {
 
 TEST_F(IndexTest, StringIndex) {
   // Index the label's string property
-  Index* str_idx = Index_Create(g, label_id, label, str_key);
+  Index* str_idx = Index_Create(g, label_id, label, str_key, false);
   // Check the label and property tags on the index
   EXPECT_STREQ(label, str_idx->label);
   EXPECT_STREQ(str_key, str_idx->property);
@@ -117,15 +117,26 @@ TEST_F(IndexTest, StringIndex) {
     num_vals ++;
   }
   EXPECT_EQ(num_vals, expected_n);
+  IndexIter_Free(iter);
+
+  // Trigrams are only built on request, substrings don't narrow the iterator.
+  EXPECT_TRUE(str_idx->trigrams == NULL);
+  SIValue sub = SI_StringVal("abc");
+  iter = IndexIter_Create(str_idx, T_STRING);
+  EXPECT_FALSE(IndexIter_ApplyBound(iter, &sub, CONTAINS));
+  num_vals = 0;
+  while (IndexIter_Next(iter) != NULL) num_vals ++;
+  EXPECT_EQ(num_vals, expected_n);
 
   SIValue_Free(&lb);
+  SIValue_Free(&sub);
   IndexIter_Free(iter);
   Index_Free(str_idx);
 }
 
 TEST_F(IndexTest, NumericIndex) {
   // Index the label's numeric property
-  Index *num_idx = Index_Create(g, label_id, label, num_key);
+  Index *num_idx = Index_Create(g, label_id, label, num_key, false);
   // Check the label and property tags on the index
   EXPECT_STREQ(label, num_idx->label);
   EXPECT_STREQ(num_key, num_idx->property);
@@ -172,7 +183,7 @@ static int count_iter_vals(IndexIter *iter) {
 /* Validate the progressive application of iterator bounds
  * on the numeric skiplist. */
 TEST_F(IndexTest, IteratorBounds) {
-  Index *num_idx = Index_Create(g, label_id, label, num_key);
+  Index *num_idx = Index_Create(g, label_id, label, num_key, false);
   IndexIter *iter = IndexIter_Create(num_idx, T_DOUBLE);
   // Verify total number of values in index without range
   int prev_vals = count_iter_vals(iter);
@@ -241,3 +252,277 @@ TEST_F(IndexTest, IteratorBounds) {
   Index_Free(num_idx);
 }
 
+
+/* Validate that an iterator's range survives its bound's value,
+ * and is materialized on the diagonal of a filter matrix. */
+TEST_F(IndexTest, IteratorToDiagonal) {
+  Index *num_idx = Index_Create(g, label_id, label, num_key, false);
+  IndexIter *iter = IndexIter_Create(num_idx, T_DOUBLE);
+
+  // Bound is modified once applied, as filters are freed once folded into the iterator.
+  SIValue lb = SI_DoubleVal(10);
+  IndexIter_ApplyBound(iter, &lb, GE);
+  lb.doubleval = 100;
+  IndexIter_Reset(iter);
+
+  bool expected[expected_n];
+  int expected_vals = 0;
+  Node cur;
+  for (NodeID i = 0; i < expected_n; i ++) {
+    Graph_GetNode(g, i, &cur);
+    SIValue *v = GraphEntity_Get_Property((GraphEntity*)&cur, num_key);
+    expected[i] = (v->doubleval >= 10);
+    if (expected[i]) expected_vals ++;
+  }
+  EXPECT_EQ(count_iter_vals(iter), expected_vals);
+
+  GrB_Matrix D;
+  GrB_Matrix_new(&D, GrB_BOOL, expected_n, expected_n);
+  IndexIter_ToDiagonal(iter, D);
+
+  GrB_Index nvals;
+  GrB_Matrix_nvals(&nvals, D);
+  EXPECT_EQ(nvals, expected_vals);
+  for (NodeID i = 0; i < expected_n; i ++) {
+    bool x = false;
+    GrB_Info res = GrB_Matrix_extractElement_BOOL(&x, D, i, i);
+    EXPECT_EQ(res == GrB_SUCCESS, expected[i]);
+  }
+
+  // Iterator is left at its original position.
+  EXPECT_EQ(count_iter_vals(iter), expected_vals);
+
+  GrB_Matrix_free(&D);
+  IndexIter_Free(iter);
+  Index_Free(num_idx);
+}
+
+/* Validate that a relationship index resolves edges along with their endpoints. */
+TEST_F(IndexTest, RelationIndex) {
+  int relation_id = Graph_AddRelationType(g);
+  Graph_AllocateEdges(g, expected_n);
+
+  // Connect each node to its successor, weighted by the source's ID.
+  Edge e;
+  char *prop_keys[1] = {num_key};
+  for (NodeID i = 0; i < expected_n; i ++) {
+    SIValue prop_vals[1] = {SI_DoubleVal(i)};
+    Graph_ConnectNodes(g, i, (i + 1) % expected_n, relation_id, &e);
+    GraphEntity_Add_Properties((GraphEntity*)&e, 1, prop_keys, prop_vals);
+  }
+
+  Index *edge_idx = Index_CreateRelationIndex(g, relation_id, "test_relation", num_key, false);
+  EXPECT_EQ(edge_idx->entity_type, STORE_EDGE);
+  EXPECT_EQ(edge_idx->numeric_sl->length, expected_n);
+
+  SIValue lb = SI_DoubleVal(90);
+  IndexIter *iter = IndexIter_Create(edge_idx, T_DOUBLE);
+  IndexIter_ApplyBound(iter, &lb, GE);
+
+  int num_vals = 0;
+  skiplistVal *val;
+  while ((val = IndexIter_Next(iter)) != NULL) {
+    IndexedEdge *indexed = Index_GetEdge(edge_idx, val);
+    EXPECT_GE(indexed->src, 90);
+    EXPECT_EQ(indexed->dest, (indexed->src + 1) % expected_n);
+
+    Graph_GetEdge(g, indexed->id, &e);
+    SIValue *v = GraphEntity_Get_Property((GraphEntity*)&e, num_key);
+    EXPECT_EQ(v->doubleval, indexed->src);
+    num_vals ++;
+  }
+  EXPECT_EQ(num_vals, 10);
+
+  IndexIter_Free(iter);
+  Index_Free(edge_idx);
+}
+
+// Returns a bitmap of the node IDs an iterator produces.
+static int collect_iter_ids(IndexIter *iter) {
+  int ids = 0;
+  NodeID *node_id;
+  while ((node_id = IndexIter_Next(iter)) != NULL) ids |= 1 << *node_id;
+  return ids;
+}
+
+/* Validate STARTS WITH ranges and trigram candidates of CONTAINS and ENDS WITH. */
+TEST_F(IndexTest, StringPredicates) {
+  const char *names[] = {"banana", "bandana", "ananas", "apple", "pineapple", "a\xff", "a\xff\xff", "b"};
+  int name_count = sizeof(names) / sizeof(names[0]);
+
+  Graph *sg = Graph_New(name_count, name_count);
+  Graph_AcquireWriteLock(sg);
+  int name_label = Graph_AddLabel(sg);
+  Graph_AllocateNodes(sg, name_count);
+
+  Node node;
+  char *prop_keys[1] = {str_key};
+  for (int i = 0; i < name_count; i ++) {
+    SIValue prop_vals[1] = {SI_StringVal(names[i])};
+    Graph_CreateNode(sg, name_label, &node);
+    GraphEntity_Add_Properties((GraphEntity*)&node, 1, prop_keys, prop_vals);
+  }
+  Index *idx = Index_Create(sg, name_label, label, str_key, true);
+
+  // Prefix ranges are exact, filters become redundant.
+  SIValue prefix = SI_StringVal("ban");
+  IndexIter *iter = IndexIter_Create(idx, T_STRING);
+  EXPECT_TRUE(IndexIter_ApplyBound(iter, &prefix, STARTS));
+  EXPECT_EQ(collect_iter_ids(iter), (1 << 0) | (1 << 1));
+  IndexIter_Free(iter);
+
+  // Trailing characters which cannot be incremented are dropped from the range's end.
+  SIValue max_prefix = SI_StringVal("a\xff");
+  iter = IndexIter_Create(idx, T_STRING);
+  EXPECT_TRUE(IndexIter_ApplyBound(iter, &max_prefix, STARTS));
+  EXPECT_EQ(collect_iter_ids(iter), (1 << 5) | (1 << 6));
+  IndexIter_Free(iter);
+
+  // Candidates hold every trigram, filters remain required.
+  SIValue sub = SI_StringVal("ana");
+  iter = IndexIter_Create(idx, T_STRING);
+  EXPECT_FALSE(IndexIter_ApplyBound(iter, &sub, CONTAINS));
+  EXPECT_EQ(collect_iter_ids(iter), (1 << 0) | (1 << 1) | (1 << 2));
+
+  // Trigrams of additional filters narrow candidates down.
+  SIValue suffix = SI_StringVal("nas");
+  EXPECT_FALSE(IndexIter_ApplyBound(iter, &suffix, ENDS));
+  IndexIter_Reset(iter);
+  EXPECT_EQ(collect_iter_ids(iter), 1 << 2);
+
+  // Ranges no longer apply once candidates are set.
+  EXPECT_FALSE(IndexIter_ApplyBound(iter, &prefix, STARTS));
+  IndexIter_Free(iter);
+
+  // Absent trigrams leave no candidates.
+  SIValue missing = SI_StringVal("xyz");
+  iter = IndexIter_Create(idx, T_STRING);
+  IndexIter_ApplyBound(iter, &missing, CONTAINS);
+  EXPECT_EQ(collect_iter_ids(iter), 0);
+  IndexIter_Free(iter);
+
+  SIValue_Free(&prefix);
+  SIValue_Free(&max_prefix);
+  SIValue_Free(&sub);
+  SIValue_Free(&suffix);
+  SIValue_Free(&missing);
+  Index_Free(idx);
+  Graph_Free(sg);
+}
+
+/* Validate that entities created after an index was built are found by it,
+ * regardless of the order in which they are inserted. */
+TEST_F(IndexTest, InsertNodes) {
+  const char *names[] = {"banana", "bandana", "ananas", "apple"};
+  int name_count = sizeof(names) / sizeof(names[0]);
+
+  Graph *sg = Graph_New(name_count, name_count);
+  Graph_AcquireWriteLock(sg);
+  int name_label = Graph_AddLabel(sg);
+  Graph_AllocateNodes(sg, name_count);
+
+  Node nodes[name_count];
+  char *prop_keys[1] = {str_key};
+  for (int i = 0; i < name_count; i ++) {
+    SIValue prop_vals[1] = {SI_StringVal(names[i])};
+    Graph_CreateNode(sg, name_label, nodes + i);
+    GraphEntity_Add_Properties((GraphEntity*)(nodes + i), 1, prop_keys, prop_vals);
+  }
+
+  // Build an index over a label without nodes, then insert nodes in descending order.
+  Index *idx = Index_Create(sg, Graph_AddLabel(sg), label, str_key, true);
+  EXPECT_EQ(idx->string_sl->length, 0);
+  for (int i = name_count - 1; i >= 0; i --) Index_InsertNode(idx, nodes + i);
+  EXPECT_EQ(idx->string_sl->length, name_count);
+
+  SIValue eq = SI_StringVal("apple");
+  IndexIter *iter = IndexIter_Create(idx, T_STRING);
+  IndexIter_ApplyBound(iter, &eq, EQ);
+  EXPECT_EQ(collect_iter_ids(iter), 1 << 3);
+  IndexIter_Free(iter);
+
+  // Trigram candidates remain sorted.
+  SIValue sub = SI_StringVal("ana");
+  iter = IndexIter_Create(idx, T_STRING);
+  IndexIter_ApplyBound(iter, &sub, CONTAINS);
+  NodeID *node_id;
+  NodeID prev = 0;
+  int num_vals = 0;
+  while ((node_id = IndexIter_Next(iter)) != NULL) {
+    if (num_vals > 0) {
+      EXPECT_GT(*node_id, prev);
+    }
+    prev = *node_id;
+    num_vals ++;
+  }
+  EXPECT_EQ(num_vals, 3);
+  IndexIter_Free(iter);
+
+  SIValue_Free(&eq);
+  SIValue_Free(&sub);
+  Index_Free(idx);
+  Graph_Free(sg);
+}
+
+/* Validate that deleted nodes are removed from an index,
+ * and that updated nodes are found by their new value only. */
+TEST_F(IndexTest, DeleteAndUpdateNodes) {
+  const char *names[] = {"banana", "bandana", "ananas"};
+  int name_count = sizeof(names) / sizeof(names[0]);
+
+  Graph *sg = Graph_New(name_count, name_count);
+  Graph_AcquireWriteLock(sg);
+  int name_label = Graph_AddLabel(sg);
+  Graph_AllocateNodes(sg, name_count);
+
+  Node nodes[name_count];
+  char *prop_keys[1] = {str_key};
+  for (int i = 0; i < name_count; i ++) {
+    SIValue prop_vals[1] = {SI_StringVal(names[i])};
+    Graph_CreateNode(sg, name_label, nodes + i);
+    GraphEntity_Add_Properties((GraphEntity*)(nodes + i), 1, prop_keys, prop_vals);
+  }
+
+  Index *idx = Index_Create(sg, name_label, label, str_key, true);
+  Index_DeleteNode(idx, nodes + 1);
+  // Deleting a node which isn't indexed has no effect.
+  Index_DeleteNode(idx, nodes + 1);
+  EXPECT_EQ(idx->string_sl->length, name_count - 1);
+
+  SIValue sub = SI_StringVal("ana");
+  IndexIter *iter = IndexIter_Create(idx, T_STRING);
+  IndexIter_ApplyBound(iter, &sub, CONTAINS);
+  EXPECT_EQ(collect_iter_ids(iter), (1 << 0) | (1 << 2));
+  IndexIter_Free(iter);
+
+  // Node 0 is about to be set to "apple".
+  SIValue apple = SI_StringVal("apple");
+  Index_UpdateNode(idx, nodes + 0, &apple);
+
+  SIValue eq = SI_StringVal("banana");
+  iter = IndexIter_Create(idx, T_STRING);
+  IndexIter_ApplyBound(iter, &eq, EQ);
+  EXPECT_EQ(collect_iter_ids(iter), 0);
+  IndexIter_Free(iter);
+
+  iter = IndexIter_Create(idx, T_STRING);
+  IndexIter_ApplyBound(iter, &apple, EQ);
+  EXPECT_EQ(collect_iter_ids(iter), 1 << 0);
+  IndexIter_Free(iter);
+
+  iter = IndexIter_Create(idx, T_STRING);
+  IndexIter_ApplyBound(iter, &sub, CONTAINS);
+  EXPECT_EQ(collect_iter_ids(iter), 1 << 2);
+  IndexIter_Free(iter);
+
+  // Values which can't be indexed remove the node.
+  SIValue flag = SI_BoolVal(true);
+  Index_UpdateNode(idx, nodes + 2, &flag);
+  EXPECT_EQ(idx->string_sl->length, 1);
+
+  SIValue_Free(&sub);
+  SIValue_Free(&apple);
+  SIValue_Free(&eq);
+  Index_Free(idx);
+  Graph_Free(sg);
+}
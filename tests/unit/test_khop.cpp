@@ -0,0 +1,134 @@
+/*
+ * Copyright 2018-2019 Redis Labs Ltd. and Contributors
+ *
+ * This file is available under the Apache License, Version 2.0,
+ * modified with the Commons Clause restriction.
+ */
+
+#include "../../deps/googletest/include/gtest/gtest.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include "../../src/algorithms/algorithms.h"
+#include "../../src/util/rmalloc.h"
+
+#ifdef __cplusplus
+}
+#endif
+
+class KHopTest: public ::testing::Test {
+    protected:
+    static void SetUpTestCase()
+    {
+        // Initialize GraphBLAS.
+        GrB_init(GrB_NONBLOCKING);
+
+        // Use the malloc family for allocations
+        Alloc_Reset();
+    }
+
+    static void TearDownTestCase()
+    {
+        GrB_finalize();
+    }
+
+    // Directed cycle 0->1->...->n-1->0.
+    static GrB_Matrix BuildCycle(GrB_Index n)
+    {
+        GrB_Matrix A;
+        GrB_Matrix_new(&A, GrB_BOOL, n, n);
+        for(GrB_Index i = 0; i < n; i++) GrB_Matrix_setElement_BOOL(A, true, (i + 1) % n, i);
+        return A;
+    }
+};
+
+TEST_F(KHopTest, Cycle)
+{
+    GrB_Matrix A = BuildCycle(6);
+    uint64_t level_counts[11];
+    GrB_Vector levels;
+
+    // Source isn't revisited once the cycle closes.
+    int reached = KHop(&levels, level_counts, A, false, 0, 10);
+    EXPECT_EQ(reached, 5);
+    EXPECT_EQ(level_counts[0], 1);
+    for(int i = 1; i <= 5; i++) EXPECT_EQ(level_counts[i], 1);
+    for(int i = 6; i <= 10; i++) EXPECT_EQ(level_counts[i], 0);
+
+    for(GrB_Index i = 0; i < 6; i++) {
+        uint64_t level;
+        GrB_Vector_extractElement_UINT64(&level, levels, i);
+        EXPECT_EQ(level, i);
+    }
+    GrB_Vector_free(&levels);
+
+    // Reversed, node 5 is a single hop away.
+    reached = KHop(&levels, level_counts, A, true, 0, 2);
+    EXPECT_EQ(reached, 2);
+    uint64_t level;
+    GrB_Vector_extractElement_UINT64(&level, levels, 5);
+    EXPECT_EQ(level, 1);
+    GrB_Vector_extractElement_UINT64(&level, levels, 4);
+    EXPECT_EQ(level, 2);
+    GrB_Index nvals;
+    GrB_Vector_nvals(&nvals, levels);
+    EXPECT_EQ(nvals, 3);
+
+    GrB_Vector_free(&levels);
+    GrB_Matrix_free(&A);
+}
+
+TEST_F(KHopTest, RandomGraph)
+{
+    srand(5);
+    const GrB_Index n = 200;
+    const int k = 3;
+    static bool adj[n][n];
+
+    GrB_Matrix A;
+    GrB_Matrix_new(&A, GrB_BOOL, n, n);
+    for(int i = 0; i < 400; i++) {
+        GrB_Index src = rand() % n;
+        GrB_Index dest = rand() % n;
+        adj[src][dest] = true;
+        GrB_Matrix_setElement_BOOL(A, true, dest, src);
+    }
+
+    // Reference breadth first search.
+    int expected_level[n];
+    uint64_t expected_counts[k + 1] = {1};
+    for(GrB_Index i = 0; i < n; i++) expected_level[i] = -1;
+    expected_level[0] = 0;
+    for(int level = 0; level < k; level++) {
+        for(GrB_Index src = 0; src < n; src++) {
+            if(expected_level[src] != level) continue;
+            for(GrB_Index dest = 0; dest < n; dest++) {
+                if(adj[src][dest] && expected_level[dest] == -1) {
+                    expected_level[dest] = level + 1;
+                    expected_counts[level + 1]++;
+                }
+            }
+        }
+    }
+
+    uint64_t level_counts[k + 1];
+    GrB_Vector levels;
+    KHop(&levels, level_counts, A, false, 0, k);
+
+    for(int i = 0; i <= k; i++) EXPECT_EQ(level_counts[i], expected_counts[i]);
+    for(GrB_Index i = 0; i < n; i++) {
+        uint64_t level;
+        if(expected_level[i] == -1) {
+            EXPECT_EQ(GrB_Vector_extractElement_UINT64(&level, levels, i), GrB_NO_VALUE);
+        } else {
+            ASSERT_EQ(GrB_Vector_extractElement_UINT64(&level, levels, i), GrB_SUCCESS);
+            EXPECT_EQ(level, expected_level[i]);
+        }
+    }
+
+    GrB_Vector_free(&levels);
+    GrB_Matrix_free(&A);
+}
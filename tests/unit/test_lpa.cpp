@@ -0,0 +1,142 @@
+/*
+ * Copyright 2018-2019 Redis Labs Ltd. and Contributors
+ *
+ * This file is available under the Apache License, Version 2.0,
+ * modified with the Commons Clause restriction.
+ */
+
+#include "../../deps/googletest/include/gtest/gtest.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "../../src/algorithms/algorithms.h"
+#include "../../src/util/rmalloc.h"
+
+#ifdef __cplusplus
+}
+#endif
+
+class LPATest: public ::testing::Test {
+    protected:
+    static void SetUpTestCase()
+    {
+        // Initialize GraphBLAS.
+        GrB_init(GrB_NONBLOCKING);
+
+        // Use the malloc family for allocations
+        Alloc_Reset();
+    }
+
+    static void TearDownTestCase()
+    {
+        GrB_finalize();
+    }
+
+    // Two cliques, 0-4 and 5-9, bridged by a single link 4->5.
+    static GrB_Matrix BuildCliques()
+    {
+        GrB_Matrix A;
+        GrB_Matrix_new(&A, GrB_BOOL, 10, 10);
+        for(GrB_Index i = 0; i < 5; i++) {
+            for(GrB_Index j = i + 1; j < 5; j++) {
+                GrB_Matrix_setElement_BOOL(A, true, j, i);
+                GrB_Matrix_setElement_BOOL(A, true, j + 5, i + 5);
+            }
+        }
+        GrB_Matrix_setElement_BOOL(A, true, 5, 4);
+        return A;
+    }
+
+    static GrB_Vector BuildNodes(GrB_Index n, GrB_Index node_count)
+    {
+        GrB_Vector nodes;
+        GrB_Vector_new(&nodes, GrB_BOOL, n);
+        for(GrB_Index i = 0; i < node_count; i++) GrB_Vector_setElement_BOOL(nodes, true, i);
+        return nodes;
+    }
+
+    static uint64_t Community(GrB_Vector communities, GrB_Index i)
+    {
+        uint64_t c;
+        GrB_Vector_extractElement_UINT64(&c, communities, i);
+        return c;
+    }
+};
+
+TEST_F(LPATest, Cliques)
+{
+    GrB_Matrix A = BuildCliques();
+    GrB_Vector nodes = BuildNodes(10, 10);
+
+    GrB_Vector communities;
+    int iterations = LabelPropagation(&communities, A, nodes, 20, 0);
+    EXPECT_LT(iterations, 20);
+
+    // Each clique forms a community.
+    for(GrB_Index i = 1; i < 5; i++) {
+        EXPECT_EQ(Community(communities, i), Community(communities, 0));
+        EXPECT_EQ(Community(communities, i + 5), Community(communities, 5));
+    }
+    EXPECT_NE(Community(communities, 0), Community(communities, 5));
+
+    GrB_Vector_free(&communities);
+    GrB_Vector_free(&nodes);
+    GrB_Matrix_free(&A);
+}
+
+TEST_F(LPATest, Deterministic)
+{
+    GrB_Matrix A = BuildCliques();
+    GrB_Vector nodes = BuildNodes(10, 10);
+
+    GrB_Vector first;
+    GrB_Vector second;
+    LabelPropagation(&first, A, nodes, 20, 7);
+    LabelPropagation(&second, A, nodes, 20, 7);
+
+    for(GrB_Index i = 0; i < 10; i++) {
+        EXPECT_EQ(Community(first, i), Community(second, i));
+    }
+
+    GrB_Vector_free(&first);
+    GrB_Vector_free(&second);
+    GrB_Vector_free(&nodes);
+    GrB_Matrix_free(&A);
+}
+
+TEST_F(LPATest, IsolatedNodes)
+{
+    // No links, nodes 4 and 5 aren't considered.
+    GrB_Matrix A;
+    GrB_Matrix_new(&A, GrB_BOOL, 6, 6);
+    GrB_Vector nodes = BuildNodes(6, 4);
+
+    GrB_Vector communities;
+    int iterations = LabelPropagation(&communities, A, nodes, 20, 0);
+    EXPECT_EQ(iterations, 1);
+
+    GrB_Index nvals;
+    GrB_Vector_nvals(&nvals, communities);
+    EXPECT_EQ(nvals, 4);
+    for(GrB_Index i = 0; i < 4; i++) EXPECT_EQ(Community(communities, i), i);
+
+    GrB_Vector_free(&communities);
+    GrB_Vector_free(&nodes);
+    GrB_Matrix_free(&A);
+}
+
+TEST_F(LPATest, Iterations)
+{
+    GrB_Matrix A = BuildCliques();
+    GrB_Vector nodes = BuildNodes(10, 10);
+
+    GrB_Vector communities;
+    int iterations = LabelPropagation(&communities, A, nodes, 1, 0);
+    EXPECT_EQ(iterations, 1);
+
+    GrB_Vector_free(&communities);
+    GrB_Vector_free(&nodes);
+    GrB_Matrix_free(&A);
+}
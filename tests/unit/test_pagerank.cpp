@@ -0,0 +1,147 @@
+/*
+ * Copyright 2018-2019 Redis Labs Ltd. and Contributors
+ *
+ * This file is available under the Apache License, Version 2.0,
+ * modified with the Commons Clause restriction.
+ */
+
+#include "../../deps/googletest/include/gtest/gtest.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "../../src/algorithms/algorithms.h"
+#include "../../src/util/rmalloc.h"
+
+#ifdef __cplusplus
+}
+#endif
+
+class PageRankTest: public ::testing::Test {
+    protected:
+    static void SetUpTestCase()
+    {
+        // Initialize GraphBLAS.
+        GrB_init(GrB_NONBLOCKING);
+
+        // Use the malloc family for allocations
+        Alloc_Reset();
+    }
+
+    static void TearDownTestCase()
+    {
+        GrB_finalize();
+    }
+
+    // Builds A[dest, src] from an array of src, dest pairs.
+    static GrB_Matrix BuildLinks(GrB_Index n, GrB_Index links[][2], int link_count)
+    {
+        GrB_Matrix A;
+        GrB_Matrix_new(&A, GrB_BOOL, n, n);
+        for(int i = 0; i < link_count; i++) {
+            GrB_Matrix_setElement_BOOL(A, true, links[i][1], links[i][0]);
+        }
+        return A;
+    }
+
+    // Vector holding an entry for each of the first node_count nodes.
+    static GrB_Vector BuildNodes(GrB_Index n, GrB_Index node_count)
+    {
+        GrB_Vector nodes;
+        GrB_Vector_new(&nodes, GrB_BOOL, n);
+        for(GrB_Index i = 0; i < node_count; i++) GrB_Vector_setElement_BOOL(nodes, true, i);
+        return nodes;
+    }
+
+    static void ExpectRanks(GrB_Vector ranks, const double *expected, GrB_Index n)
+    {
+        GrB_Index nvals;
+        GrB_Vector_nvals(&nvals, ranks);
+        ASSERT_EQ(nvals, n);
+        for(GrB_Index i = 0; i < n; i++) {
+            double rank;
+            GrB_Vector_extractElement_FP64(&rank, ranks, i);
+            EXPECT_NEAR(rank, expected[i], 1e-6);
+        }
+    }
+};
+
+TEST_F(PageRankTest, Cycle)
+{
+    GrB_Index links[3][2] = {{0, 1}, {1, 2}, {2, 0}};
+    GrB_Matrix A = BuildLinks(3, links, 3);
+    GrB_Vector nodes = BuildNodes(3, 3);
+
+    GrB_Vector ranks;
+    int iterations = PageRank(&ranks, A, nodes, 100, 0.85, 1e-9);
+    // Uniform distribution is stable.
+    EXPECT_EQ(iterations, 1);
+
+    double expected[3] = {1.0/3, 1.0/3, 1.0/3};
+    ExpectRanks(ranks, expected, 3);
+
+    GrB_Vector_free(&ranks);
+    GrB_Vector_free(&nodes);
+    GrB_Matrix_free(&A);
+}
+
+TEST_F(PageRankTest, Converge)
+{
+    GrB_Index links[5][2] = {{0, 1}, {0, 2}, {1, 2}, {2, 0}, {3, 2}};
+    GrB_Matrix A = BuildLinks(4, links, 5);
+    GrB_Vector nodes = BuildNodes(4, 4);
+
+    GrB_Vector ranks;
+    PageRank(&ranks, A, nodes, 100, 0.85, 1e-9);
+
+    // Node 3 isn't linked to, its rank is the teleport probability.
+    double expected[4] = {0.372526851, 0.195823912, 0.394149237, 0.0375};
+    ExpectRanks(ranks, expected, 4);
+
+    GrB_Vector_free(&ranks);
+    GrB_Vector_free(&nodes);
+    GrB_Matrix_free(&A);
+}
+
+TEST_F(PageRankTest, DanglingNodes)
+{
+    // Node 0 has no outgoing links, its rank is spread over all nodes.
+    GrB_Index links[3][2] = {{1, 0}, {2, 0}, {3, 0}};
+    GrB_Matrix A = BuildLinks(4, links, 3);
+    GrB_Vector nodes = BuildNodes(4, 4);
+
+    GrB_Vector ranks;
+    PageRank(&ranks, A, nodes, 100, 0.85, 1e-9);
+
+    double expected[4] = {0.541984733, 0.152671756, 0.152671756, 0.152671756};
+    ExpectRanks(ranks, expected, 4);
+
+    double total;
+    GrB_Vector_reduce_FP64(&total, NULL, GxB_PLUS_FP64_MONOID, ranks, NULL);
+    EXPECT_NEAR(total, 1.0, 1e-9);
+
+    GrB_Vector_free(&ranks);
+    GrB_Vector_free(&nodes);
+    GrB_Matrix_free(&A);
+}
+
+TEST_F(PageRankTest, Iterations)
+{
+    GrB_Index links[5][2] = {{0, 1}, {0, 2}, {1, 2}, {2, 0}, {3, 2}};
+    GrB_Matrix A = BuildLinks(6, links, 5);
+    // Nodes 4 and 5 are not ranked.
+    GrB_Vector nodes = BuildNodes(6, 4);
+
+    GrB_Vector ranks;
+    int iterations = PageRank(&ranks, A, nodes, 2, 0.85, 0);
+    EXPECT_EQ(iterations, 2);
+
+    GrB_Index nvals;
+    GrB_Vector_nvals(&nvals, ranks);
+    EXPECT_EQ(nvals, 4);
+
+    GrB_Vector_free(&ranks);
+    GrB_Vector_free(&nodes);
+    GrB_Matrix_free(&A);
+}
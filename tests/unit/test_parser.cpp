@@ -0,0 +1,228 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#include "../../deps/googletest/include/gtest/gtest.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <pthread.h>
+#include <string.h>
+#include "../../src/util/rmalloc.h"
+#include "../../src/parser/ast.h"
+#include "../../src/parser/parser_common.h"
+#include "../../src/parser/grammar.h"
+#include "../../src/arithmetic/arithmetic_expression.h"
+#include "../../src/arithmetic/agg_funcs.h"
+
+#ifdef __cplusplus
+}
+#endif
+
+#define PARSER_THREAD_COUNT 8
+#define PARSER_ITERATIONS 200
+
+class ParserTest: public ::testing::Test {
+    protected:
+    static void SetUpTestCase() {
+        // Use the malloc family for allocations
+        Alloc_Reset();
+        // Validation checks referred functions.
+        AR_RegisterFuncs();
+        Agg_RegisterFuncs();
+    }
+};
+
+// Parses a query repeatedly, returns number of failed parses.
+static void* _parse_repeatedly(void *arg) {
+    intptr_t failures = 0;
+    // Each thread parses a query of a different length.
+    char q[128];
+    int id = (int)(intptr_t)arg;
+    snprintf(q, sizeof(q), "MATCH (a%d:person)-[:knows]->(b) WHERE a%d.age > $age RETURN b.name", id, id);
+
+    for(int i = 0; i < PARSER_ITERATIONS; i++) {
+        char *err = NULL;
+        AST_Query *ast = Query_Parse(q, strlen(q), &err);
+        if(!ast || err || !ast->matchNode || !ast->whereNode || !ast->returnNode ||
+           Vector_Size(ast->parameters) != 1) {
+            failures++;
+            free(err);
+        }
+        if(ast) Free_AST_Query(ast);
+    }
+    return (void*)failures;
+}
+
+TEST_F(ParserTest, ConcurrentParse) {
+    pthread_t threads[PARSER_THREAD_COUNT];
+    for(intptr_t i = 0; i < PARSER_THREAD_COUNT; i++) {
+        ASSERT_EQ(pthread_create(&threads[i], NULL, _parse_repeatedly, (void*)(i * 1000)), 0);
+    }
+
+    for(int i = 0; i < PARSER_THREAD_COUNT; i++) {
+        void *failures;
+        pthread_join(threads[i], &failures);
+        EXPECT_EQ((intptr_t)failures, 0);
+    }
+}
+
+TEST_F(ParserTest, SyntaxErrorOffset) {
+    char *err = NULL;
+    const char *q = "MATCH (a) RETURN a a";
+    AST_Query *ast = Query_Parse(q, strlen(q), &err);
+    ASSERT_TRUE(ast == NULL);
+    ASSERT_TRUE(err != NULL);
+    // Token positions are tracked per scanner, starting at column 1.
+    EXPECT_STREQ(err, "Syntax error at offset 21 near 'a'");
+    free(err);
+
+    // Position tracking is reset between queries.
+    ast = Query_Parse(q, strlen(q), &err);
+    ASSERT_TRUE(ast == NULL);
+    EXPECT_STREQ(err, "Syntax error at offset 21 near 'a'");
+    free(err);
+}
+
+TEST_F(ParserTest, ReadOnly) {
+    const char *queries[] = {
+        "MATCH (a) RETURN a",
+        "MATCH (a {name: 'CREATE'}) WHERE a.v = \"SET\" RETURN a.deleted",
+        "MATCH (a) WHERE a.v = $setting RETURN a ORDER BY a.v LIMIT 1",
+        "CREATE (:person {name: 'a'})",
+        "MATCH (a) SET a.v = 1",
+        "MATCH (a) DELETE a",
+        "MERGE (:person {name: 'a'})",
+        "create index on :person(name)",
+        "DROP INDEX ON :person(name)",
+        "CREATE INDEX ON :person(name) TRIGRAM",
+    };
+
+    for(size_t i = 0; i < sizeof(queries) / sizeof(queries[0]); i++) {
+        const char *q = queries[i];
+        AST_Query *ast = Query_Parse(q, strlen(q), NULL);
+        ASSERT_TRUE(ast != NULL) << q;
+        // Token scan agrees with parsed AST.
+        EXPECT_EQ(Query_ReadOnly(q, strlen(q)), AST_ReadOnly(ast)) << q;
+        Free_AST_Query(ast);
+    }
+}
+
+TEST_F(ParserTest, StringPredicates) {
+    const char *queries[] = {
+        "MATCH (a) WHERE a.name STARTS WITH 'x' RETURN a",
+        "MATCH (a) WHERE a.name ends with 'x' RETURN a",
+        "MATCH (a) WHERE a.name Contains $with RETURN a",
+    };
+    int ops[] = {STARTS, ENDS, CONTAINS};
+
+    for(size_t i = 0; i < sizeof(queries) / sizeof(queries[0]); i++) {
+        const char *q = queries[i];
+        char *err = NULL;
+        AST_Query *ast = Query_Parse(q, strlen(q), &err);
+        ASSERT_TRUE(ast != NULL) << err;
+        AST_FilterNode *filter = ast->whereNode->filters;
+        ASSERT_EQ(filter->t, N_PRED);
+        EXPECT_EQ(filter->pn.op, ops[i]) << q;
+        Free_AST_Query(ast);
+    }
+
+    // Keywords following '$' name parameters.
+    const char *q = queries[2];
+    AST_Query *ast = Query_Parse(q, strlen(q), NULL);
+    EXPECT_EQ(Vector_Size(ast->parameters), 1);
+    Free_AST_Query(ast);
+}
+
+TEST_F(ParserTest, IndexTrigrams) {
+    // Trigrams are only indexed on request.
+    const char *q = "CREATE INDEX ON :person(name)";
+    AST_Query *ast = Query_Parse(q, strlen(q), NULL);
+    ASSERT_TRUE(ast != NULL);
+    EXPECT_FALSE(ast->indexNode->trigrams);
+    Free_AST_Query(ast);
+
+    q = "create index on :person(name) trigram";
+    ast = Query_Parse(q, strlen(q), NULL);
+    ASSERT_TRUE(ast != NULL);
+    EXPECT_EQ(ast->indexNode->operation, CREATE_INDEX);
+    EXPECT_TRUE(ast->indexNode->trigrams);
+    Free_AST_Query(ast);
+
+    // Dropped indices are identified by label and property alone.
+    char *err = NULL;
+    q = "DROP INDEX ON :person(name) TRIGRAM";
+    ast = Query_Parse(q, strlen(q), &err);
+    EXPECT_TRUE(ast == NULL);
+    free(err);
+}
+
+TEST_F(ParserTest, DegreeArguments) {
+    // Degree functions only accept node aliases.
+    const char *valid[] = {
+        "MATCH (a)-[r]->(b) RETURN degree(a), indegree(b, 'knows')",
+        "MATCH (a)-[r]->(b) WHERE outdegree(a) > 1 RETURN a",
+    };
+    const char *invalid[] = {
+        "MATCH (a)-[r]->(b) RETURN degree(r)",
+        "MATCH (a)-[r]->(b) WHERE InDegree(r) > 0 RETURN a",
+        "MATCH (a)-[r]->(b) SET a.d = outdegree(r)",
+        "MATCH (a) RETURN degree(a.name)",
+        "MATCH (a) RETURN abs(degree(1))",
+    };
+
+    for(size_t i = 0; i < sizeof(valid) / sizeof(valid[0]); i++) {
+        char *reason = NULL;
+        AST_Query *ast = Query_Parse(valid[i], strlen(valid[i]), NULL);
+        ASSERT_TRUE(ast != NULL) << valid[i];
+        EXPECT_EQ(AST_Validate(ast, &reason), AST_VALID) << valid[i];
+        free(reason);
+        Free_AST_Query(ast);
+    }
+
+    for(size_t i = 0; i < sizeof(invalid) / sizeof(invalid[0]); i++) {
+        char *reason = NULL;
+        AST_Query *ast = Query_Parse(invalid[i], strlen(invalid[i]), NULL);
+        ASSERT_TRUE(ast != NULL) << invalid[i];
+        EXPECT_EQ(AST_Validate(ast, &reason), AST_INVALID) << invalid[i];
+        EXPECT_TRUE(reason != NULL) << invalid[i];
+        free(reason);
+        Free_AST_Query(ast);
+    }
+}
+
+TEST_F(ParserTest, UnmatchedCharacters) {
+    // Characters matched by no lexer rule are reported, not skipped.
+    const char *queries[] = {
+        "MATCH (a) RETURN $1",
+        "MATCH (a) WHERE a.v = $ name RETURN a",
+        "MATCH (a) RETURN a ~ 1",
+    };
+
+    for(size_t i = 0; i < sizeof(queries) / sizeof(queries[0]); i++) {
+        const char *q = queries[i];
+        char *err = NULL;
+        AST_Query *ast = Query_Parse(q, strlen(q), &err);
+        EXPECT_TRUE(ast == NULL) << q;
+        EXPECT_TRUE(err != NULL) << q;
+        if(ast) Free_AST_Query(ast);
+        free(err);
+    }
+
+    char *err = NULL;
+    const char *q = queries[0];
+    Query_Parse(q, strlen(q), &err);
+    EXPECT_STREQ(err, "Syntax error at offset 19 near '$'");
+    free(err);
+
+    // Carriage returns are whitespace.
+    q = "MATCH (a)\r\nRETURN a";
+    AST_Query *ast = Query_Parse(q, strlen(q), &err);
+    ASSERT_TRUE(ast != NULL);
+    Free_AST_Query(ast);
+}
@@ -0,0 +1,111 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#include "../../deps/googletest/include/gtest/gtest.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "../../src/util/hll.h"
+#include "../../src/graph/graph.h"
+#include "../../src/stats/property_stats.h"
+#include "../../src/parser/grammar.h"
+#include "../../src/util/arr.h"
+#include "../../src/util/rmalloc.h"
+
+#ifdef __cplusplus
+}
+#endif
+
+class PropertyStatsTest: public ::testing::Test {
+  protected:
+    static void SetUpTestCase() {
+      // Use the malloc family for allocations
+      Alloc_Reset();
+    }
+};
+
+TEST_F(PropertyStatsTest, HLLCount) {
+  HLL *hll = HLL_New();
+  EXPECT_EQ(HLL_Count(hll), 0);
+
+  // Duplicates do not affect estimate.
+  for(int i = 0; i < 10; i++) {
+    for(int64_t v = 0; v < 100; v++) HLL_Add(hll, &v, sizeof(v));
+  }
+  EXPECT_NEAR(HLL_Count(hll), 100, 5);
+
+  for(int64_t v = 100; v < 100000; v++) HLL_Add(hll, &v, sizeof(v));
+  EXPECT_NEAR(HLL_Count(hll), 100000, 100000 * 0.1);
+
+  HLL_Free(hll);
+}
+
+TEST_F(PropertyStatsTest, Collect) {
+  size_t n = 1000;
+  Graph *g = Graph_New(n, n);
+  Graph_AcquireWriteLock(g);
+  int label_id = Graph_AddLabel(g);
+  Graph_AllocateNodes(g, n);
+
+  /* num_prop holds values 0 - 999, str_prop one of 10 strings,
+   * every fourth node is missing str_prop. */
+  char *keys[2] = {(char*)"num_prop", (char*)"str_prop"};
+  LabelStore *store = LabelStore_New("test_label", label_id);
+  LabelStore_UpdateSchema(store, 2, keys);
+
+  Node node;
+  char str[16];
+  for(int i = 0; i < n; i++) {
+    Graph_CreateNode(g, label_id, &node);
+    sprintf(str, "value%d", i % 10);
+    SIValue vals[2] = {SI_LongVal(i), SI_StringVal(str)};
+    int prop_count = (i % 4 == 0) ? 1 : 2;
+    GraphEntity_Add_Properties((GraphEntity*)&node, prop_count, keys, vals);
+  }
+  Graph_ReleaseLock(g);
+
+  PropertyStats **stats = PropertyStats_Collect(g, store);
+  ASSERT_EQ(array_len(stats), 2);
+
+  PropertyStats *num_stats = NULL;
+  PropertyStats *str_stats = NULL;
+  for(int i = 0; i < array_len(stats); i++) {
+    EXPECT_STREQ(stats[i]->label, "test_label");
+    EXPECT_EQ(stats[i]->entity_count, n);
+    if(!strcmp(stats[i]->property, "num_prop")) num_stats = stats[i];
+    if(!strcmp(stats[i]->property, "str_prop")) str_stats = stats[i];
+  }
+  ASSERT_TRUE(num_stats != NULL);
+  ASSERT_TRUE(str_stats != NULL);
+
+  // Numeric property.
+  EXPECT_EQ(num_stats->null_count, 0);
+  EXPECT_EQ(num_stats->numeric_count, n);
+  EXPECT_EQ(num_stats->bucket_count, STATS_HISTOGRAM_BUCKETS);
+  EXPECT_NEAR(num_stats->distinct, n, n * 0.1);
+  EXPECT_NEAR(PropertyStats_Selectivity(num_stats, EQ, SI_LongVal(5)), 1.0 / n, 0.0002);
+  EXPECT_NEAR(PropertyStats_Selectivity(num_stats, LT, SI_LongVal(250)), 0.25, 0.02);
+  EXPECT_NEAR(PropertyStats_Selectivity(num_stats, GE, SI_DoubleVal(900)), 0.1, 0.02);
+  EXPECT_EQ(PropertyStats_Selectivity(num_stats, LT, SI_LongVal(-1)), 0);
+  EXPECT_EQ(PropertyStats_Selectivity(num_stats, GT, SI_LongVal(-1)), 1);
+
+  // String property.
+  EXPECT_EQ(str_stats->null_count, n / 4);
+  EXPECT_EQ(str_stats->numeric_count, 0);
+  EXPECT_NEAR(str_stats->distinct, 10, 1);
+  EXPECT_NEAR(PropertyStats_Selectivity(str_stats, EQ, SI_StringVal("value1")), 0.075, 0.01);
+  EXPECT_NEAR(PropertyStats_Selectivity(str_stats, NE, SI_StringVal("value1")), 0.675, 0.01);
+  // Histograms only cover numeric values.
+  EXPECT_EQ(PropertyStats_Selectivity(str_stats, LT, SI_StringVal("value1")), STATS_UNKNOWN);
+
+  for(int i = 0; i < array_len(stats); i++) PropertyStats_Free(stats[i]);
+  array_free(stats);
+  LabelStore_Free(store);
+  Graph_Free(g);
+}
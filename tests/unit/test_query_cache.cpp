@@ -0,0 +1,156 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Apache License, Version 2.0,
+* modified with the Commons Clause restriction.
+*/
+
+#include "../../deps/googletest/include/gtest/gtest.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdio.h>
+#include <string.h>
+#include "../../src/util/arr.h"
+#include "../../src/util/rmalloc.h"
+#include "../../src/query_cache.h"
+#include "../../src/query_executor.h"
+
+#ifdef __cplusplus
+}
+#endif
+
+class QueryCacheTest: public ::testing::Test {
+    protected:
+
+    GraphContext *gc;
+
+    static void SetUpTestCase() {
+        // Use the malloc family for allocations
+        Alloc_Reset();
+    }
+
+    void SetUp() {
+        // Queries below do not access graph data.
+        gc = (GraphContext*)calloc(1, sizeof(GraphContext));
+        gc->schema_version = 1;
+    }
+
+    void TearDown() {
+        free(gc);
+    }
+
+    QueryParam* _params(const char *name, double age) {
+        QueryParam *params = (QueryParam*)array_newlen(QueryParam, 2);
+        params[0].name = strdup("name");
+        params[0].value = SI_StringVal(name);
+        params[1].name = strdup("age");
+        params[1].value = SI_DoubleVal(age);
+        return params;
+    }
+
+    // Returns constant compared against within WHERE clause predicate.
+    SIValue _predicate_constant(AST_FilterNode *filter) {
+        EXPECT_EQ(filter->t, N_PRED);
+        return filter->pn.rhs->operand.constant;
+    }
+};
+
+TEST_F(QueryCacheTest, ParseParameters) {
+    const char *q = "MATCH (a:person {name: $name}) WHERE a.age > $age RETURN a.age";
+    AST_Query *ast = ParseQuery(q, strlen(q), NULL);
+    ASSERT_TRUE(ast != NULL);
+    ASSERT_EQ(Vector_Size(ast->parameters), 2);
+
+    char *name;
+    Vector_Get(ast->parameters, 0, &name);
+    EXPECT_STREQ(name, "name");
+    Vector_Get(ast->parameters, 1, &name);
+    EXPECT_STREQ(name, "age");
+
+    // Placeholder is recognized by identity, not by content.
+    SIValue placeholder = _predicate_constant(ast->whereNode->filters);
+    EXPECT_STREQ(AST_GetParameterName(ast, placeholder), "age");
+    SIValue literal = SI_StringVal("age");
+    EXPECT_TRUE(AST_GetParameterName(ast, literal) == NULL);
+
+    SIValue_Free(&literal);
+    Free_AST_Query(ast);
+}
+
+TEST_F(QueryCacheTest, BindParameters) {
+    const char *graph = "cache_bind";
+    const char *q = "MATCH (a:person {name: $name}) WHERE a.age > $age RETURN a.age";
+    AST_Query *ast = ParseQuery(q, strlen(q), NULL);
+    CachedQuery *cq = CachedQuery_New(graph, q, ast);
+
+    ASSERT_EQ(CachedQuery_Prepare(NULL, cq, gc), AST_VALID);
+    // $name within MATCH properties and its copy migrated to WHERE, $age.
+    ASSERT_EQ(array_len(cq->slots), 3);
+
+    QueryParam *params = _params("Roi", 33);
+    ASSERT_TRUE(CachedQuery_Bind(NULL, cq, params));
+
+    // Inline property was migrated to WHERE clause: (a.age > $age) AND (a.name = $name)
+    AST_FilterNode *filters = cq->ast->whereNode->filters;
+    ASSERT_EQ(filters->t, N_COND);
+    SIValue age = _predicate_constant(filters->cn.left);
+    SIValue name = _predicate_constant(filters->cn.right);
+    EXPECT_EQ(age.type, T_DOUBLE);
+    EXPECT_EQ(age.doubleval, 33);
+    EXPECT_EQ(name.type, T_STRING);
+    EXPECT_STREQ(name.stringval, "Roi");
+
+    QueryCache_Release(cq);
+    QueryParams_Free(params);
+}
+
+TEST_F(QueryCacheTest, ReuseAST) {
+    const char *graph = "cache_reuse";
+    const char *q = "MATCH (a:person) WHERE a.age > $age RETURN a.age";
+    EXPECT_TRUE(QueryCache_Checkout(graph, q) == NULL);
+
+    AST_Query *ast = ParseQuery(q, strlen(q), NULL);
+    CachedQuery *cq = CachedQuery_New(graph, q, ast);
+    ASSERT_EQ(CachedQuery_Prepare(NULL, cq, gc), AST_VALID);
+    QueryParam *params = _params("Roi", 33);
+    ASSERT_TRUE(CachedQuery_Bind(NULL, cq, params));
+    QueryCache_Release(cq);
+    QueryParams_Free(params);
+
+    // Query is cached per graph.
+    EXPECT_TRUE(QueryCache_Checkout("cache_other", q) == NULL);
+
+    CachedQuery *reused = QueryCache_Checkout(graph, q);
+    ASSERT_EQ(reused, cq);
+    ASSERT_EQ(reused->ast, ast);
+    // Only a single idle AST was cached.
+    EXPECT_TRUE(QueryCache_Checkout(graph, q) == NULL);
+
+    // Schema didn't change, AST is used as is.
+    ASSERT_EQ(CachedQuery_Prepare(NULL, reused, gc), AST_VALID);
+    ASSERT_EQ(reused->ast, ast);
+    params = _params("Roi", 45);
+    ASSERT_TRUE(CachedQuery_Bind(NULL, reused, params));
+    SIValue age = _predicate_constant(reused->ast->whereNode->filters);
+    EXPECT_EQ(age.doubleval, 45);
+    QueryParams_Free(params);
+
+    // Schema changed, query is parsed again.
+    gc->schema_version++;
+    ASSERT_EQ(CachedQuery_Prepare(NULL, reused, gc), AST_VALID);
+    EXPECT_EQ(reused->schema_version, gc->schema_version);
+    params = _params("Roi", 50);
+    ASSERT_TRUE(CachedQuery_Bind(NULL, reused, params));
+    age = _predicate_constant(reused->ast->whereNode->filters);
+    EXPECT_EQ(age.doubleval, 50);
+    QueryCache_Release(reused);
+    QueryParams_Free(params);
+
+    QueryCacheStats stats;
+    QueryCache_GetStats(&stats);
+    EXPECT_GE(stats.hits, 1);
+    EXPECT_GE(stats.size, 1);
+}
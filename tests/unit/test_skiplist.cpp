@@ -109,8 +109,8 @@ TEST_F(SkiplistTest, SkiplistRange) {
     last_id = *ret_node;
   }
 
-  skiplistFree(sl);
   skiplistIterate_Free(iter);
+  skiplistFree(sl);
 }
 
 TEST_F(SkiplistTest, SkiplistDelete) {
@@ -0,0 +1,171 @@
+/*
+ * Copyright 2018-2019 Redis Labs Ltd. and Contributors
+ *
+ * This file is available under the Apache License, Version 2.0,
+ * modified with the Commons Clause restriction.
+ */
+
+#include "../../deps/googletest/include/gtest/gtest.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include "../../src/algorithms/algorithms.h"
+#include "../../src/util/rmalloc.h"
+
+#ifdef __cplusplus
+}
+#endif
+
+class TrianglesTest: public ::testing::Test {
+    protected:
+    static void SetUpTestCase()
+    {
+        // Initialize GraphBLAS.
+        GrB_init(GrB_NONBLOCKING);
+
+        // Use the malloc family for allocations
+        Alloc_Reset();
+    }
+
+    static void TearDownTestCase()
+    {
+        GrB_finalize();
+    }
+
+    static GrB_Vector AllNodes(GrB_Index n)
+    {
+        GrB_Vector nodes;
+        GrB_Vector_new(&nodes, GrB_BOOL, n);
+        for(GrB_Index i = 0; i < n; i++) GrB_Vector_setElement_BOOL(nodes, true, i);
+        return nodes;
+    }
+};
+
+TEST_F(TrianglesTest, Clique)
+{
+    // Complete directed graph over 5 nodes, including self loops.
+    GrB_Index n = 5;
+    GrB_Matrix A;
+    GrB_Matrix_new(&A, GrB_BOOL, n, n);
+    for(GrB_Index i = 0; i < n; i++) {
+        for(GrB_Index j = 0; j < n; j++) GrB_Matrix_setElement_BOOL(A, true, i, j);
+    }
+    GrB_Vector nodes = AllNodes(n);
+
+    // n choose 3.
+    EXPECT_EQ(TriangleCount(A), 10);
+
+    GrB_Vector triangles;
+    GrB_Vector coefficients;
+    LocalTriangles(&triangles, &coefficients, A, nodes);
+    for(GrB_Index i = 0; i < n; i++) {
+        uint64_t t;
+        double cc;
+        GrB_Vector_extractElement_UINT64(&t, triangles, i);
+        GrB_Vector_extractElement_FP64(&cc, coefficients, i);
+        EXPECT_EQ(t, 6);
+        EXPECT_DOUBLE_EQ(cc, 1.0);
+    }
+
+    GrB_Vector_free(&triangles);
+    GrB_Vector_free(&coefficients);
+    GrB_Vector_free(&nodes);
+    GrB_Matrix_free(&A);
+}
+
+TEST_F(TrianglesTest, NoTriangles)
+{
+    // Star centered at node 0, node 5 isn't considered.
+    GrB_Index n = 6;
+    GrB_Matrix A;
+    GrB_Matrix_new(&A, GrB_BOOL, n, n);
+    for(GrB_Index i = 1; i < 5; i++) GrB_Matrix_setElement_BOOL(A, true, 0, i);
+    GrB_Vector nodes;
+    GrB_Vector_new(&nodes, GrB_BOOL, n);
+    for(GrB_Index i = 0; i < 5; i++) GrB_Vector_setElement_BOOL(nodes, true, i);
+
+    EXPECT_EQ(TriangleCount(A), 0);
+
+    GrB_Vector triangles;
+    GrB_Vector coefficients;
+    LocalTriangles(&triangles, &coefficients, A, nodes);
+
+    GrB_Index nvals;
+    GrB_Vector_nvals(&nvals, triangles);
+    EXPECT_EQ(nvals, 5);
+    GrB_Vector_nvals(&nvals, coefficients);
+    EXPECT_EQ(nvals, 5);
+    for(GrB_Index i = 0; i < 5; i++) {
+        uint64_t t;
+        double cc;
+        GrB_Vector_extractElement_UINT64(&t, triangles, i);
+        GrB_Vector_extractElement_FP64(&cc, coefficients, i);
+        EXPECT_EQ(t, 0);
+        EXPECT_EQ(cc, 0);
+    }
+
+    GrB_Vector_free(&triangles);
+    GrB_Vector_free(&coefficients);
+    GrB_Vector_free(&nodes);
+    GrB_Matrix_free(&A);
+}
+
+TEST_F(TrianglesTest, RandomGraph)
+{
+    srand(11);
+    const GrB_Index n = 60;
+    bool adj[n][n] = {};
+
+    GrB_Matrix A;
+    GrB_Matrix_new(&A, GrB_BOOL, n, n);
+    for(int i = 0; i < 400; i++) {
+        GrB_Index src = rand() % n;
+        GrB_Index dest = rand() % n;
+        GrB_Matrix_setElement_BOOL(A, true, dest, src);
+        if(src != dest) adj[src][dest] = adj[dest][src] = true;
+    }
+    GrB_Vector nodes = AllNodes(n);
+
+    // Enumerate triangles.
+    uint64_t expected_total = 0;
+    uint64_t expected[n] = {};
+    for(GrB_Index i = 0; i < n; i++) {
+        for(GrB_Index j = i + 1; j < n; j++) {
+            if(!adj[i][j]) continue;
+            for(GrB_Index k = j + 1; k < n; k++) {
+                if(adj[i][k] && adj[j][k]) {
+                    expected_total++;
+                    expected[i]++;
+                    expected[j]++;
+                    expected[k]++;
+                }
+            }
+        }
+    }
+
+    EXPECT_EQ(TriangleCount(A), expected_total);
+
+    GrB_Vector triangles;
+    GrB_Vector coefficients;
+    LocalTriangles(&triangles, &coefficients, A, nodes);
+    for(GrB_Index i = 0; i < n; i++) {
+        uint64_t degree = 0;
+        for(GrB_Index j = 0; j < n; j++) degree += adj[i][j];
+        double expected_cc = (degree < 2) ? 0 : (2.0 * expected[i]) / (degree * (degree - 1));
+
+        uint64_t t;
+        double cc;
+        GrB_Vector_extractElement_UINT64(&t, triangles, i);
+        GrB_Vector_extractElement_FP64(&cc, coefficients, i);
+        EXPECT_EQ(t, expected[i]);
+        EXPECT_DOUBLE_EQ(cc, expected_cc);
+    }
+
+    GrB_Vector_free(&triangles);
+    GrB_Vector_free(&coefficients);
+    GrB_Vector_free(&nodes);
+    GrB_Matrix_free(&A);
+}
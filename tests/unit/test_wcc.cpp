@@ -0,0 +1,153 @@
+/*
+ * Copyright 2018-2019 Redis Labs Ltd. and Contributors
+ *
+ * This file is available under the Apache License, Version 2.0,
+ * modified with the Commons Clause restriction.
+ */
+
+#include "../../deps/googletest/include/gtest/gtest.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdlib.h>
+#include "../../src/algorithms/algorithms.h"
+#include "../../src/util/rmalloc.h"
+
+#ifdef __cplusplus
+}
+#endif
+
+class WCCTest: public ::testing::Test {
+    protected:
+    static void SetUpTestCase()
+    {
+        // Initialize GraphBLAS.
+        GrB_init(GrB_NONBLOCKING);
+
+        // Use the malloc family for allocations
+        Alloc_Reset();
+    }
+
+    static void TearDownTestCase()
+    {
+        GrB_finalize();
+    }
+
+    static GrB_Vector AllNodes(GrB_Index n)
+    {
+        GrB_Vector nodes;
+        GrB_Vector_new(&nodes, GrB_BOOL, n);
+        for(GrB_Index i = 0; i < n; i++) GrB_Vector_setElement_BOOL(nodes, true, i);
+        return nodes;
+    }
+
+    static GrB_Index Find(GrB_Index *parent, GrB_Index i)
+    {
+        while(parent[i] != i) i = parent[i];
+        return i;
+    }
+
+    // Smallest node ID within each node's component, computed by union find.
+    static void ReferenceComponents(GrB_Index n, GrB_Index links[][2], int link_count, GrB_Index *components)
+    {
+        GrB_Index *parent = (GrB_Index*)malloc(sizeof(GrB_Index) * n);
+        for(GrB_Index i = 0; i < n; i++) parent[i] = i;
+        for(int i = 0; i < link_count; i++) {
+            GrB_Index a = Find(parent, links[i][0]);
+            GrB_Index b = Find(parent, links[i][1]);
+            if(a < b) parent[b] = a;
+            else parent[a] = b;
+        }
+        for(GrB_Index i = 0; i < n; i++) components[i] = Find(parent, i);
+        free(parent);
+    }
+
+    static void ExpectComponents(GrB_Vector components, const GrB_Index *expected, GrB_Index n)
+    {
+        for(GrB_Index i = 0; i < n; i++) {
+            uint64_t component;
+            ASSERT_EQ(GrB_Vector_extractElement_UINT64(&component, components, i), GrB_SUCCESS);
+            EXPECT_EQ(component, expected[i]);
+        }
+    }
+};
+
+TEST_F(WCCTest, Chain)
+{
+    // Directed chain n-1 -> n-2 -> ... -> 0, followed against link direction.
+    GrB_Index n = 64;
+    GrB_Matrix A;
+    GrB_Matrix_new(&A, GrB_BOOL, n, n);
+    for(GrB_Index i = 1; i < n; i++) GrB_Matrix_setElement_BOOL(A, true, i - 1, i);
+    GrB_Vector nodes = AllNodes(n);
+
+    GrB_Vector components;
+    WCC(&components, A, nodes);
+
+    GrB_Index *expected = (GrB_Index*)calloc(n, sizeof(GrB_Index));
+    ExpectComponents(components, expected, n);
+
+    free(expected);
+    GrB_Vector_free(&components);
+    GrB_Vector_free(&nodes);
+    GrB_Matrix_free(&A);
+}
+
+TEST_F(WCCTest, Isolated)
+{
+    // No links, every node is its own component.
+    GrB_Index n = 8;
+    GrB_Matrix A;
+    GrB_Matrix_new(&A, GrB_BOOL, n, n);
+    GrB_Vector nodes;
+    GrB_Vector_new(&nodes, GrB_BOOL, n);
+    // Only even nodes are considered.
+    for(GrB_Index i = 0; i < n; i += 2) GrB_Vector_setElement_BOOL(nodes, true, i);
+
+    GrB_Vector components;
+    WCC(&components, A, nodes);
+
+    GrB_Index nvals;
+    GrB_Vector_nvals(&nvals, components);
+    EXPECT_EQ(nvals, n / 2);
+    for(GrB_Index i = 0; i < n; i += 2) {
+        uint64_t component;
+        GrB_Vector_extractElement_UINT64(&component, components, i);
+        EXPECT_EQ(component, i);
+    }
+
+    GrB_Vector_free(&components);
+    GrB_Vector_free(&nodes);
+    GrB_Matrix_free(&A);
+}
+
+TEST_F(WCCTest, RandomGraph)
+{
+    srand(7);
+    GrB_Index n = 500;
+    const int link_count = 400;
+    GrB_Index links[link_count][2];
+
+    GrB_Matrix A;
+    GrB_Matrix_new(&A, GrB_BOOL, n, n);
+    for(int i = 0; i < link_count; i++) {
+        links[i][0] = rand() % n;
+        links[i][1] = rand() % n;
+        GrB_Matrix_setElement_BOOL(A, true, links[i][1], links[i][0]);
+    }
+    GrB_Vector nodes = AllNodes(n);
+
+    GrB_Vector components;
+    WCC(&components, A, nodes);
+
+    GrB_Index *expected = (GrB_Index*)malloc(sizeof(GrB_Index) * n);
+    ReferenceComponents(n, links, link_count, expected);
+    ExpectComponents(components, expected, n);
+
+    free(expected);
+    GrB_Vector_free(&components);
+    GrB_Vector_free(&nodes);
+    GrB_Matrix_free(&A);
+}